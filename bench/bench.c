@@ -0,0 +1,644 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+// Load/processing benchmark over the `data/` corpus.
+//
+// Loads every .fbx/.obj file from memory multiple times with different load
+// options and times scene evaluation, animation baking, subdivision and
+// triangulation. Results are written as JSON for comparing between commits.
+//
+// Build (from the repository root), or run `python3 misc/run_tests.py bench`:
+//   cc -O2 -DTHREADS bench/bench.c -lm -lpthread -o build/bench
+//
+// Usage:
+//   bench [-d data] [-n iterations] [-f filter] [-o result.json] [-v]
+//
+// Each measurement is the fastest of `iterations` runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <sys/types.h>
+	#include <dirent.h>
+#endif
+
+static void bench_assert_fail(const char *file, int line, const char *msg)
+{
+	fprintf(stderr, "%s:%d: bench_assert(%s) failed\n", file, line, msg);
+	exit(2);
+}
+
+#define bench_assert(m_cond) do { if (!(m_cond)) bench_assert_fail(__FILE__, __LINE__, #m_cond); } while (0)
+#define bench_arraycount(arr) (sizeof(arr) / sizeof(*(arr)))
+
+#include "../ufbx.h"
+
+#if defined(THREADS)
+	#include "../extra/ufbx_os.h"
+#endif
+
+#include "../test/cputime.h"
+
+typedef enum {
+	BENCH_FORMAT_FBX_BINARY,
+	BENCH_FORMAT_FBX_ASCII,
+	BENCH_FORMAT_OBJ,
+
+	BENCH_FORMAT_COUNT,
+} bench_format;
+
+static const char *const bench_format_names[] = {
+	"fbx_binary",
+	"fbx_ascii",
+	"obj",
+};
+
+typedef enum {
+	BENCH_LOAD_DEFAULT,
+	BENCH_LOAD_THREADED,
+	BENCH_LOAD_IGNORE_GEOMETRY,
+	BENCH_LOAD_IGNORE_ANIMATION,
+
+	BENCH_LOAD_COUNT,
+} bench_load;
+
+static const char *const bench_load_names[] = {
+	"default",
+	"threaded",
+	"ignore_geometry",
+	"ignore_animation",
+};
+
+typedef enum {
+	BENCH_OP_EVALUATE,    // < `ufbx_evaluate_scene()`, work: elements
+	BENCH_OP_BAKE,        // < `ufbx_bake_anim()`, work: baked keyframes
+	BENCH_OP_SUBDIVIDE,   // < `ufbx_subdivide_mesh()`, work: source faces
+	BENCH_OP_TRIANGULATE, // < `ufbx_triangulate_face()`, work: triangles
+
+	BENCH_OP_COUNT,
+} bench_op;
+
+static const char *const bench_op_names[] = {
+	"evaluate",
+	"bake",
+	"subdivide",
+	"triangulate",
+};
+
+static const char *const bench_phase_names[] = {
+	"open",
+	"parse",
+	"inflate",
+	"read_elements",
+	"finalize",
+	"postprocess",
+	"external_files",
+	"skinning",
+};
+
+typedef struct {
+	char name[256];
+	bench_format format;
+	size_t size;
+
+	// Negative if not measured
+	double load_time[BENCH_LOAD_COUNT];
+	double op_time[BENCH_OP_COUNT];
+	size_t op_work[BENCH_OP_COUNT];
+
+	// Phase breakdown of the fastest `BENCH_LOAD_DEFAULT` load
+	double phase_time[UFBX_LOAD_PHASE_COUNT];
+} bench_file;
+
+typedef struct {
+	size_t num_files;
+	size_t bytes;
+	double time;
+	double phase_time[UFBX_LOAD_PHASE_COUNT];
+} bench_load_total;
+
+typedef struct {
+	size_t num_files;
+	size_t work;
+	double time;
+} bench_op_total;
+
+typedef struct {
+	int iterations;
+	bool verbose;
+#if defined(THREADS)
+	ufbx_os_thread_pool *thread_pool;
+#endif
+} bench_context;
+
+static double bench_clock(void *user)
+{
+	(void)user;
+	return cputime_os_tick_to_sec(NULL, cputime_os_tick());
+}
+
+static double bench_now()
+{
+	return bench_clock(NULL);
+}
+
+static void *bench_read_file(const char *path, size_t *p_size)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f) return NULL;
+
+	char *data = NULL;
+	size_t size = 0;
+	if (fseek(f, 0, SEEK_END) == 0) {
+		long pos = ftell(f);
+		if (pos >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+			size = (size_t)pos;
+			data = (char*)malloc(size + 1);
+			if (data && fread(data, 1, size, f) != size) {
+				free(data);
+				data = NULL;
+			}
+		}
+	}
+	fclose(f);
+
+	*p_size = size;
+	return data;
+}
+
+static bool bench_has_suffix(const char *str, const char *suffix)
+{
+	size_t len = strlen(str), suffix_len = strlen(suffix);
+	return len >= suffix_len && !strcmp(str + len - suffix_len, suffix);
+}
+
+static int bench_cmp_str(const void *va, const void *vb)
+{
+	return strcmp(*(const char* const*)va, *(const char* const*)vb);
+}
+
+static void bench_load_opts(bench_context *bc, ufbx_load_opts *opts, bench_load load)
+{
+	memset(opts, 0, sizeof(ufbx_load_opts));
+	opts->collect_stats = true;
+	opts->stats_clock_cb.fn = &bench_clock;
+
+	switch (load) {
+	case BENCH_LOAD_DEFAULT:
+		break;
+	case BENCH_LOAD_THREADED:
+		#if defined(THREADS)
+			ufbx_os_init_ufbx_thread_pool(&opts->thread_opts.pool, bc->thread_pool);
+		#endif
+		break;
+	case BENCH_LOAD_IGNORE_GEOMETRY:
+		opts->ignore_geometry = true;
+		break;
+	case BENCH_LOAD_IGNORE_ANIMATION:
+		opts->ignore_animation = true;
+		break;
+	default:
+		break;
+	}
+}
+
+static size_t bench_run_op(const ufbx_scene *scene, bench_op op, uint32_t *tri_indices)
+{
+	size_t work = 0;
+	ufbx_error error;
+
+	switch (op) {
+
+	case BENCH_OP_EVALUATE: {
+		const ufbx_anim_stack *stack = scene->anim_stacks.data[0];
+		double time = (stack->time_begin + stack->time_end) * 0.5;
+		ufbx_scene *state = ufbx_evaluate_scene(scene, stack->anim, time, NULL, &error);
+		if (!state) return 0;
+		work = state->elements.count;
+		ufbx_free_scene(state);
+	} break;
+
+	case BENCH_OP_BAKE: {
+		ufbx_baked_anim *bake = ufbx_bake_anim(scene, scene->anim_stacks.data[0]->anim, NULL, &error);
+		if (!bake) return 0;
+		for (size_t i = 0; i < bake->nodes.count; i++) {
+			const ufbx_baked_node *node = &bake->nodes.data[i];
+			work += node->translation_keys.count + node->rotation_keys.count + node->scale_keys.count;
+		}
+		for (size_t i = 0; i < bake->elements.count; i++) {
+			const ufbx_baked_element *elem = &bake->elements.data[i];
+			for (size_t j = 0; j < elem->props.count; j++) {
+				work += elem->props.data[j].keys.count;
+			}
+		}
+		ufbx_free_baked_anim(bake);
+	} break;
+
+	case BENCH_OP_SUBDIVIDE: {
+		for (size_t i = 0; i < scene->meshes.count; i++) {
+			const ufbx_mesh *mesh = scene->meshes.data[i];
+			if (mesh->num_faces == 0) continue;
+			ufbx_mesh *result = ufbx_subdivide_mesh(mesh, 1, NULL, &error);
+			if (!result) return 0;
+			work += mesh->num_faces;
+			ufbx_free_mesh(result);
+		}
+	} break;
+
+	case BENCH_OP_TRIANGULATE: {
+		for (size_t i = 0; i < scene->meshes.count; i++) {
+			const ufbx_mesh *mesh = scene->meshes.data[i];
+			size_t num_indices = mesh->max_face_triangles * 3;
+			for (size_t j = 0; j < mesh->faces.count; j++) {
+				work += ufbx_triangulate_face(tri_indices, num_indices, mesh, mesh->faces.data[j]);
+			}
+		}
+	} break;
+
+	default:
+		break;
+
+	}
+
+	return work;
+}
+
+static bool bench_op_applies(const ufbx_scene *scene, bench_op op)
+{
+	switch (op) {
+	case BENCH_OP_EVALUATE:
+	case BENCH_OP_BAKE:
+		return scene->anim_stacks.count > 0;
+	case BENCH_OP_SUBDIVIDE:
+	case BENCH_OP_TRIANGULATE:
+		return scene->meshes.count > 0;
+	default:
+		return false;
+	}
+}
+
+static bool bench_file_run(bench_context *bc, bench_file *file, const void *data)
+{
+	for (size_t i = 0; i < BENCH_LOAD_COUNT; i++) file->load_time[i] = -1.0;
+	for (size_t i = 0; i < BENCH_OP_COUNT; i++) file->op_time[i] = -1.0;
+
+	ufbx_scene *scene = NULL;
+
+	for (int load = 0; load < BENCH_LOAD_COUNT; load++) {
+		#if !defined(THREADS)
+			if (load == BENCH_LOAD_THREADED) continue;
+		#endif
+
+		ufbx_load_opts opts;
+		bench_load_opts(bc, &opts, (bench_load)load);
+
+		double best_time = -1.0;
+		for (int iter = 0; iter < bc->iterations; iter++) {
+			ufbx_error error;
+			double begin = bench_now();
+			ufbx_scene *result = ufbx_load_memory(data, file->size, &opts, &error);
+			double time = bench_now() - begin;
+			if (!result) {
+				if (bc->verbose) {
+					char buf[1024];
+					ufbx_format_error(buf, sizeof(buf), &error);
+					fprintf(stderr, "%s: %s\n", file->name, buf);
+				}
+				if (scene) ufbx_free_scene(scene);
+				return false;
+			}
+
+			if (best_time < 0.0 || time < best_time) {
+				best_time = time;
+				if (load == BENCH_LOAD_DEFAULT) {
+					memcpy(file->phase_time, result->metadata.load_stats.phase_time, sizeof(file->phase_time));
+				}
+			}
+
+			if (load == BENCH_LOAD_DEFAULT && !scene) {
+				scene = result;
+			} else {
+				ufbx_free_scene(result);
+			}
+		}
+		file->load_time[load] = best_time;
+	}
+
+	if (!scene) return false;
+
+	if (scene->metadata.file_format == UFBX_FILE_FORMAT_OBJ) {
+		file->format = BENCH_FORMAT_OBJ;
+	} else if (scene->metadata.ascii) {
+		file->format = BENCH_FORMAT_FBX_ASCII;
+	} else {
+		file->format = BENCH_FORMAT_FBX_BINARY;
+	}
+
+	size_t max_triangles = 0;
+	for (size_t i = 0; i < scene->meshes.count; i++) {
+		if (scene->meshes.data[i]->max_face_triangles > max_triangles) {
+			max_triangles = scene->meshes.data[i]->max_face_triangles;
+		}
+	}
+	uint32_t *tri_indices = (uint32_t*)malloc((max_triangles * 3 + 1) * sizeof(uint32_t));
+	bench_assert(tri_indices);
+
+	for (int op = 0; op < BENCH_OP_COUNT; op++) {
+		if (!bench_op_applies(scene, (bench_op)op)) continue;
+
+		double best_time = -1.0;
+		size_t work = 0;
+		for (int iter = 0; iter < bc->iterations; iter++) {
+			double begin = bench_now();
+			work = bench_run_op(scene, (bench_op)op, tri_indices);
+			double time = bench_now() - begin;
+			if (work == 0) break;
+			if (best_time < 0.0 || time < best_time) best_time = time;
+		}
+
+		if (work > 0) {
+			file->op_time[op] = best_time;
+			file->op_work[op] = work;
+		}
+	}
+
+	free(tri_indices);
+	ufbx_free_scene(scene);
+	return true;
+}
+
+static void bench_write_string(FILE *f, const char *str)
+{
+	fputc('"', f);
+	for (const char *c = str; *c; c++) {
+		if (*c == '"' || *c == '\\') {
+			fprintf(f, "\\%c", *c);
+		} else if ((unsigned char)*c < 0x20) {
+			fprintf(f, "\\u%04x", (unsigned)(unsigned char)*c);
+		} else {
+			fputc(*c, f);
+		}
+	}
+	fputc('"', f);
+}
+
+static double bench_rate(double amount, double time)
+{
+	return time > 0.0 ? amount / time : 0.0;
+}
+
+static void bench_write_json(FILE *f, bench_context *bc, const bench_file *files, size_t num_files, size_t num_failed)
+{
+	bench_load_total load_totals[BENCH_FORMAT_COUNT][BENCH_LOAD_COUNT];
+	bench_op_total op_totals[BENCH_OP_COUNT];
+	memset(load_totals, 0, sizeof(load_totals));
+	memset(op_totals, 0, sizeof(op_totals));
+
+	for (size_t i = 0; i < num_files; i++) {
+		const bench_file *file = &files[i];
+		for (size_t load = 0; load < BENCH_LOAD_COUNT; load++) {
+			if (file->load_time[load] < 0.0) continue;
+			bench_load_total *total = &load_totals[file->format][load];
+			total->num_files++;
+			total->bytes += file->size;
+			total->time += file->load_time[load];
+			if (load == BENCH_LOAD_DEFAULT) {
+				for (size_t p = 0; p < UFBX_LOAD_PHASE_COUNT; p++) {
+					total->phase_time[p] += file->phase_time[p];
+				}
+			}
+		}
+		for (size_t op = 0; op < BENCH_OP_COUNT; op++) {
+			if (file->op_time[op] < 0.0) continue;
+			bench_op_total *total = &op_totals[op];
+			total->num_files++;
+			total->work += file->op_work[op];
+			total->time += file->op_time[op];
+		}
+	}
+
+	fprintf(f, "{\n");
+	fprintf(f, "\t\"ufbx_version\": \"%u.%u.%u\",\n",
+		ufbx_version_major(UFBX_HEADER_VERSION), ufbx_version_minor(UFBX_HEADER_VERSION), ufbx_version_patch(UFBX_HEADER_VERSION));
+	fprintf(f, "\t\"iterations\": %d,\n", bc->iterations);
+	#if defined(THREADS)
+		fprintf(f, "\t\"threaded\": true,\n");
+	#else
+		fprintf(f, "\t\"threaded\": false,\n");
+	#endif
+	fprintf(f, "\t\"num_files\": %zu,\n", num_files);
+	fprintf(f, "\t\"num_failed\": %zu,\n", num_failed);
+
+	fprintf(f, "\t\"load\": {\n");
+	for (size_t format = 0; format < BENCH_FORMAT_COUNT; format++) {
+		fprintf(f, "\t\t\"%s\": {\n", bench_format_names[format]);
+		bool first = true;
+		for (size_t load = 0; load < BENCH_LOAD_COUNT; load++) {
+			const bench_load_total *total = &load_totals[format][load];
+			if (total->num_files == 0) continue;
+			fprintf(f, "%s\t\t\t\"%s\": { \"files\": %zu, \"bytes\": %zu, \"seconds\": %.6f, \"mb_per_sec\": %.3f",
+				first ? "" : ",\n", bench_load_names[load], total->num_files, total->bytes, total->time,
+				bench_rate((double)total->bytes * 1e-6, total->time));
+			if (load == BENCH_LOAD_DEFAULT) {
+				fprintf(f, ", \"phases\": {");
+				for (size_t p = 0; p < UFBX_LOAD_PHASE_COUNT; p++) {
+					fprintf(f, "%s \"%s\": %.6f", p > 0 ? "," : "", bench_phase_names[p], total->phase_time[p]);
+				}
+				fprintf(f, " }");
+			}
+			fprintf(f, " }");
+			first = false;
+		}
+		fprintf(f, "\n\t\t}%s\n", format + 1 < BENCH_FORMAT_COUNT ? "," : "");
+	}
+	fprintf(f, "\t},\n");
+
+	fprintf(f, "\t\"ops\": {\n");
+	for (size_t op = 0; op < BENCH_OP_COUNT; op++) {
+		const bench_op_total *total = &op_totals[op];
+		fprintf(f, "\t\t\"%s\": { \"files\": %zu, \"work\": %zu, \"seconds\": %.6f, \"work_per_sec\": %.1f }%s\n",
+			bench_op_names[op], total->num_files, total->work, total->time,
+			bench_rate((double)total->work, total->time), op + 1 < BENCH_OP_COUNT ? "," : "");
+	}
+	fprintf(f, "\t},\n");
+
+	fprintf(f, "\t\"files\": [\n");
+	for (size_t i = 0; i < num_files; i++) {
+		const bench_file *file = &files[i];
+		fprintf(f, "\t\t{ \"name\": ");
+		bench_write_string(f, file->name);
+		fprintf(f, ", \"format\": \"%s\", \"bytes\": %zu", bench_format_names[file->format], file->size);
+		for (size_t load = 0; load < BENCH_LOAD_COUNT; load++) {
+			if (file->load_time[load] < 0.0) continue;
+			fprintf(f, ", \"load_%s\": %.6f", bench_load_names[load], file->load_time[load]);
+		}
+		for (size_t op = 0; op < BENCH_OP_COUNT; op++) {
+			if (file->op_time[op] < 0.0) continue;
+			fprintf(f, ", \"%s\": %.6f", bench_op_names[op], file->op_time[op]);
+		}
+		fprintf(f, " }%s\n", i + 1 < num_files ? "," : "");
+	}
+	fprintf(f, "\t]\n");
+	fprintf(f, "}\n");
+}
+
+static size_t bench_list_files(const char *directory, const char *filter, char ***p_names)
+{
+	size_t count = 0, capacity = 0;
+	char **names = NULL;
+
+	#if defined(_WIN32)
+		char pattern[1024];
+		int res = snprintf(pattern, sizeof(pattern), "%s\\*", directory);
+		bench_assert(res > 0 && (size_t)res < sizeof(pattern));
+
+		WIN32_FIND_DATAA find_data;
+		HANDLE find_handle = FindFirstFileA(pattern, &find_data);
+		bench_assert(find_handle != INVALID_HANDLE_VALUE);
+		do {
+			const char *name = find_data.cFileName;
+	#else
+		DIR *dir = opendir(directory);
+		bench_assert(dir);
+		struct dirent *entry;
+		while ((entry = readdir(dir)) != NULL) {
+			const char *name = entry->d_name;
+	#endif
+
+			if (!bench_has_suffix(name, ".fbx") && !bench_has_suffix(name, ".obj")) continue;
+			if (filter && !strstr(name, filter)) continue;
+
+			if (count == capacity) {
+				capacity = capacity ? capacity * 2 : 256;
+				names = (char**)realloc(names, capacity * sizeof(char*));
+				bench_assert(names);
+			}
+			size_t len = strlen(name);
+			names[count] = (char*)malloc(len + 1);
+			bench_assert(names[count]);
+			memcpy(names[count], name, len + 1);
+			count++;
+
+	#if defined(_WIN32)
+		} while (FindNextFileA(find_handle, &find_data));
+		FindClose(find_handle);
+	#else
+		}
+		closedir(dir);
+	#endif
+
+	qsort(names, count, sizeof(char*), &bench_cmp_str);
+	*p_names = names;
+	return count;
+}
+
+int main(int argc, char **argv)
+{
+	bench_context bc;
+	memset(&bc, 0, sizeof(bc));
+	bc.iterations = 3;
+
+	const char *directory = "data";
+	const char *filter = NULL;
+	const char *output = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-d")) {
+			if (++i < argc) directory = argv[i];
+		} else if (!strcmp(argv[i], "-n")) {
+			if (++i < argc) bc.iterations = atoi(argv[i]);
+		} else if (!strcmp(argv[i], "-f")) {
+			if (++i < argc) filter = argv[i];
+		} else if (!strcmp(argv[i], "-o")) {
+			if (++i < argc) output = argv[i];
+		} else if (!strcmp(argv[i], "-v")) {
+			bc.verbose = true;
+		} else {
+			fprintf(stderr, "Usage: bench [-d data] [-n iterations] [-f filter] [-o result.json] [-v]\n");
+			return 1;
+		}
+	}
+	if (bc.iterations < 1) bc.iterations = 1;
+
+	bench_assert(bench_arraycount(bench_phase_names) == UFBX_LOAD_PHASE_COUNT);
+
+	cputime_init();
+
+	#if defined(THREADS)
+		bc.thread_pool = ufbx_os_create_thread_pool(NULL);
+		bench_assert(bc.thread_pool);
+	#endif
+
+	char **names = NULL;
+	size_t num_names = bench_list_files(directory, filter, &names);
+
+	bench_file *files = (bench_file*)calloc(num_names + 1, sizeof(bench_file));
+	bench_assert(files);
+
+	size_t num_files = 0, num_failed = 0;
+	double begin = bench_now();
+
+	for (size_t i = 0; i < num_names; i++) {
+		char path[1024];
+		int res = snprintf(path, sizeof(path), "%s/%s", directory, names[i]);
+		bench_assert(res > 0 && (size_t)res < sizeof(path));
+
+		bench_file *file = &files[num_files];
+		memset(file, 0, sizeof(bench_file));
+		snprintf(file->name, sizeof(file->name), "%s", names[i]);
+
+		void *data = bench_read_file(path, &file->size);
+		if (!data) continue;
+
+		if (bench_file_run(&bc, file, data)) {
+			if (bc.verbose) {
+				fprintf(stderr, "%s: %.3fms\n", file->name, file->load_time[BENCH_LOAD_DEFAULT] * 1e3);
+			}
+			num_files++;
+		} else {
+			num_failed++;
+		}
+
+		free(data);
+	}
+
+	fprintf(stderr, "Benchmarked %zu files (%zu failed to load) in %.2fs\n", num_files, num_failed, bench_now() - begin);
+
+	FILE *f = stdout;
+	if (output) {
+		f = fopen(output, "w");
+		bench_assert(f);
+	}
+	bench_write_json(f, &bc, files, num_files, num_failed);
+	if (f != stdout) fclose(f);
+
+	for (size_t i = 0; i < num_names; i++) {
+		free(names[i]);
+	}
+	free(names);
+	free(files);
+
+	#if defined(THREADS)
+		ufbx_os_free_thread_pool(bc.thread_pool);
+	#endif
+
+	return 0;
+}
+
+#define CPUTIME_IMPLEMENTATION
+#include "../test/cputime.h"
+
+#if defined(THREADS)
+	#define UFBX_OS_IMPLEMENTATION
+	#include "../extra/ufbx_os.h"
+#endif
+
+#ifndef EXTERNAL_UFBX
+	#include "../ufbx.c"
+#endif
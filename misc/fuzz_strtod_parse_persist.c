@@ -22,6 +22,43 @@
 #include <sys/mman.h>
 
 char g_buffer[1024*32];
+double g_list_f64[1024*32];
+float g_list_f32[1024*32];
+
+// Bulk parsing must be bit-identical to parsing each number separately
+static void check_double_list(const char *src, const char *end, char separator, uint32_t flags)
+{
+	size_t num_f64 = 0, num_f32 = 0;
+	const char *list_end = ufbxi_parse_double_list(g_list_f64, NULL, sizeof(g_list_f64) / sizeof(*g_list_f64), &num_f64, src, end, separator, flags);
+	const char *list_end_f32 = ufbxi_parse_double_list(NULL, g_list_f32, sizeof(g_list_f32) / sizeof(*g_list_f32), &num_f32, src, end, separator, flags);
+	ufbx_assert(list_end == list_end_f32 && num_f64 == num_f32);
+
+	size_t num = 0;
+	const char *accepted = src;
+	for (;;) {
+		while (src != end && ufbxi_is_space(*src)) src++;
+		if (src == end) break;
+
+		char *num_end = NULL;
+		double value = ufbxi_parse_double(src, (size_t)(end - src), &num_end, flags);
+		const char *next = num_end;
+		while (next != end && ufbxi_is_space(*next)) next++;
+		if (separator) {
+			if (next == end || *next != separator) break;
+			next++;
+		} else if (next == num_end && next != end) {
+			break;
+		}
+
+		float value_f32 = (float)value;
+		ufbx_assert(num < num_f64);
+		ufbx_assert(memcmp(&value, &g_list_f64[num], sizeof(double)) == 0);
+		ufbx_assert(memcmp(&value_f32, &g_list_f32[num], sizeof(float)) == 0);
+		num++;
+		accepted = src = next;
+	}
+	ufbx_assert(num == num_f64 && accepted == list_end);
+}
 
 __AFL_COVERAGE();
 __AFL_COVERAGE_START_OFF();
@@ -51,6 +88,10 @@ int main(int argc, char **argv)
 		char *p_end = NULL;
 		double ufbx_d = ufbxi_parse_double(value, size, &p_end, 0);
 
+		check_double_list(value, read_end, ',', 0);
+		check_double_list(value, read_end, ',', UFBXI_PARSE_DOUBLE_ALLOW_FAST_PATH);
+		check_double_list(value, read_end, 0, UFBXI_PARSE_DOUBLE_ALLOW_FAST_PATH);
+
 		__AFL_COVERAGE_OFF();
 	}
 
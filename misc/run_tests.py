@@ -1118,6 +1118,7 @@ async def main():
             "UFBX_NO_FORMAT_OBJ",
             "UFBX_NO_INDEX_GENERATION",
             "UFBX_NO_TRIANGULATION",
+            "UFBX_NO_LOAD_STATS",
             "UFBX_NO_ERROR_STACK",
             "UFBX_REAL_IS_FLOAT",
             "UFBX_NO_STDIO",
@@ -1515,6 +1516,26 @@ async def main():
             for line in best_target.log[1].splitlines(keepends=False):
                 log_comment(line)
 
+    if "bench" in tests:
+        log_comment("-- Compiling and running bench --")
+
+        target_tasks = []
+
+        bench_config = {
+            "sources": ["bench/bench.c"],
+            "output": "bench" + exe_suffix,
+            "optimize": True,
+            "threads": True,
+            "defines": {
+                "THREADS": "",
+            },
+        }
+        bench_output = os.path.join(build_path, "bench_%TARGET_SUFFIX%.json")
+        target_tasks += compile_permutations("bench", bench_config, arch_configs, ["-d", "data", "-o", bench_output])
+
+        targets = await gather(target_tasks)
+        all_targets += targets
+
     if "hashes" in tests:
 
         hash_file = argv.hash_file
@@ -2710,6 +2710,42 @@ bool ufbxt_parse_format(char *buf, size_t buf_len, const char *name, const char
 	return true;
 }
 
+static void ufbxt_check_dom_equal(const ufbx_dom_node *a, const ufbx_dom_node *b)
+{
+	ufbxt_assert(a && b);
+	ufbxt_assert(a->name.length == b->name.length);
+	ufbxt_assert(!memcmp(a->name.data, b->name.data, a->name.length));
+
+	ufbxt_assert(a->values.count == b->values.count);
+	for (size_t i = 0; i < a->values.count; i++) {
+		const ufbx_dom_value *va = &a->values.data[i];
+		const ufbx_dom_value *vb = &b->values.data[i];
+		ufbxt_assert(va->type == vb->type);
+		ufbxt_assert(va->value_int == vb->value_int);
+		ufbxt_assert(!memcmp(&va->value_float, &vb->value_float, sizeof(double)));
+		ufbxt_assert(va->value_str.length == vb->value_str.length);
+		ufbxt_assert(!memcmp(va->value_str.data, vb->value_str.data, va->value_str.length));
+		ufbxt_assert(va->value_blob.size == vb->value_blob.size);
+		if (va->type == UFBX_DOM_VALUE_ARRAY_BLOB) {
+			// Array elements are blobs themselves, compare their contents instead of the pointers
+			const ufbx_blob *ea = (const ufbx_blob*)va->value_blob.data;
+			const ufbx_blob *eb = (const ufbx_blob*)vb->value_blob.data;
+			size_t count = va->value_blob.size / sizeof(ufbx_blob);
+			for (size_t j = 0; j < count; j++) {
+				ufbxt_assert(ea[j].size == eb[j].size);
+				ufbxt_assert(!memcmp(ea[j].data, eb[j].data, ea[j].size));
+			}
+		} else if (va->value_blob.size > 0) {
+			ufbxt_assert(!memcmp(va->value_blob.data, vb->value_blob.data, va->value_blob.size));
+		}
+	}
+
+	ufbxt_assert(a->children.count == b->children.count);
+	for (size_t i = 0; i < a->children.count; i++) {
+		ufbxt_check_dom_equal(a->children.data[i], b->children.data[i]);
+	}
+}
+
 void ufbxt_do_file_test(const char *name, void (*test_fn)(ufbx_scene *s, ufbxt_diff_error *err, ufbx_error *load_error), const char *suffix, ufbx_load_opts user_opts, ufbxt_file_test_flags flags)
 {
 	const char *req_format = NULL;
@@ -2927,6 +2963,22 @@ void ufbxt_do_file_test(const char *name, void (*test_fn)(ufbx_scene *s, ufbxt_d
 				ufbxt_assert_fail(__FILE__, __LINE__, "Failed to parse streamed file");
 			}
 
+			// `data` outlives the scene so the arrays can be referenced directly
+			{
+				ufbx_load_opts no_copy_opts = load_opts;
+				no_copy_opts.no_copy_arrays = true;
+
+				ufbx_error no_copy_error;
+				ufbx_scene *no_copy_scene = ufbx_load_memory(data, size, &no_copy_opts, &no_copy_error);
+				if (no_copy_scene) {
+					ufbxt_check_scene(no_copy_scene);
+				} else if (!allow_error) {
+					ufbxt_log_error(&no_copy_error);
+					ufbxt_assert_fail(__FILE__, __LINE__, "Failed to parse file without copying arrays");
+				}
+				ufbx_free_scene(no_copy_scene);
+			}
+
 			#if defined(UFBXT_THREADS)
 			{
 				ufbx_load_opts thread_opts = load_opts;
@@ -2948,6 +3000,21 @@ void ufbxt_do_file_test(const char *name, void (*test_fn)(ufbx_scene *s, ufbxt_d
 					ufbxt_assert_fail(__FILE__, __LINE__, "Failed to parse threaded file");
 				}
 				ufbx_free_scene(thread_scene);
+
+				// Loading from memory lexes ASCII files in threads, the result should match exactly
+				ufbx_scene *thread_memory_scene = ufbx_load_memory(data, size, &thread_opts, &thread_error);
+				if (thread_memory_scene) {
+					ufbxt_check_scene(thread_memory_scene);
+					if (streamed_scene) {
+						ufbxt_check_dom_equal(streamed_scene->dom_root, thread_memory_scene->dom_root);
+					}
+				} else if (allow_thread_error) {
+					ufbxt_assert(thread_error.type == UFBX_ERROR_THREADED_ASCII_PARSE);
+				} else if (!allow_error) {
+					ufbxt_log_error(&thread_error);
+					ufbxt_assert_fail(__FILE__, __LINE__, "Failed to parse threaded file from memory");
+				}
+				ufbx_free_scene(thread_memory_scene);
 			}
 			#endif
 
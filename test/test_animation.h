@@ -2520,6 +2520,286 @@ UFBXT_FILE_TEST_OPTS_ALT_FLAGS(anim_bake_alloc_fail_alt, motionbuilder_sausage_r
 }
 #endif
 
+#if UFBXT_IMPL
+static void ufbxt_check_baked_vec3_equal(ufbx_baked_vec3_list a, ufbx_baked_vec3_list b)
+{
+	ufbxt_assert(a.count == b.count);
+	for (size_t i = 0; i < a.count; i++) {
+		ufbxt_assert(a.data[i].time == b.data[i].time);
+		ufbxt_assert(a.data[i].flags == b.data[i].flags);
+		ufbxt_assert(a.data[i].value.x == b.data[i].value.x);
+		ufbxt_assert(a.data[i].value.y == b.data[i].value.y);
+		ufbxt_assert(a.data[i].value.z == b.data[i].value.z);
+	}
+}
+
+static void ufbxt_check_baked_quat_equal(ufbx_baked_quat_list a, ufbx_baked_quat_list b)
+{
+	ufbxt_assert(a.count == b.count);
+	for (size_t i = 0; i < a.count; i++) {
+		ufbxt_assert(a.data[i].time == b.data[i].time);
+		ufbxt_assert(a.data[i].flags == b.data[i].flags);
+		ufbxt_assert(a.data[i].value.x == b.data[i].value.x);
+		ufbxt_assert(a.data[i].value.y == b.data[i].value.y);
+		ufbxt_assert(a.data[i].value.z == b.data[i].value.z);
+		ufbxt_assert(a.data[i].value.w == b.data[i].value.w);
+	}
+}
+
+static void ufbxt_check_baked_anim_equal(const ufbx_baked_anim *a, const ufbx_baked_anim *b)
+{
+	ufbxt_assert(a->nodes.count == b->nodes.count);
+	for (size_t i = 0; i < a->nodes.count; i++) {
+		const ufbx_baked_node *an = &a->nodes.data[i], *bn = &b->nodes.data[i];
+		ufbxt_assert(an->typed_id == bn->typed_id);
+		ufbxt_assert(an->element_id == bn->element_id);
+		ufbxt_assert(an->constant_translation == bn->constant_translation);
+		ufbxt_assert(an->constant_rotation == bn->constant_rotation);
+		ufbxt_assert(an->constant_scale == bn->constant_scale);
+		ufbxt_check_baked_vec3_equal(an->translation_keys, bn->translation_keys);
+		ufbxt_check_baked_quat_equal(an->rotation_keys, bn->rotation_keys);
+		ufbxt_check_baked_vec3_equal(an->scale_keys, bn->scale_keys);
+	}
+
+	ufbxt_assert(a->elements.count == b->elements.count);
+	for (size_t i = 0; i < a->elements.count; i++) {
+		const ufbx_baked_element *ae = &a->elements.data[i], *be = &b->elements.data[i];
+		ufbxt_assert(ae->element_id == be->element_id);
+		ufbxt_assert(ae->props.count == be->props.count);
+		for (size_t j = 0; j < ae->props.count; j++) {
+			const ufbx_baked_prop *ap = &ae->props.data[j], *bp = &be->props.data[j];
+			ufbxt_assert(!strcmp(ap->name.data, bp->name.data));
+			ufbxt_assert(ap->constant_value == bp->constant_value);
+			ufbxt_check_baked_vec3_equal(ap->keys, bp->keys);
+		}
+	}
+
+	ufbxt_assert(a->key_time_min == b->key_time_min);
+	ufbxt_assert(a->key_time_max == b->key_time_max);
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_count_free_allocator(void *user)
+{
+	size_t *p_num_frees = (size_t*)user;
+	(*p_num_frees)++;
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(anim_bake_threaded, maya_human_ik, ufbxt_scale_helper_opts)
+#if UFBXT_IMPL
+{
+#if defined(UFBXT_THREADS)
+	ufbx_bake_opts opts = { 0 };
+	opts.bake_transform_props = true;
+
+	ufbx_error error;
+	ufbx_baked_anim *bake = ufbx_bake_anim(scene, NULL, &opts, &error);
+	if (!bake) ufbxt_log_error(&error);
+	ufbxt_assert(bake);
+
+	ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+	ufbx_baked_anim *thread_bake = ufbxt_bake_anim(scene, NULL, &opts, &error);
+	if (!thread_bake) ufbxt_log_error(&error);
+	ufbxt_assert(thread_bake);
+
+	ufbxt_check_baked_anim_equal(bake, thread_bake);
+
+	// Tasks share the temporary allocator, it must be freed only once
+	size_t num_frees = 0;
+	opts.temp_allocator.allocator.free_allocator_fn = &ufbxt_count_free_allocator;
+	opts.temp_allocator.allocator.user = &num_frees;
+	ufbx_baked_anim *shared_bake = ufbx_bake_anim(scene, NULL, &opts, &error);
+	if (!shared_bake) ufbxt_log_error(&error);
+	ufbxt_assert(shared_bake);
+	ufbxt_assert(num_frees == 1);
+	ufbxt_check_baked_anim_equal(bake, shared_bake);
+
+	ufbx_free_baked_anim(shared_bake);
+	ufbx_free_baked_anim(thread_bake);
+	ufbx_free_baked_anim(bake);
+#endif
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(anim_cursor_evaluate, maya_human_ik, ufbxt_scale_helper_opts)
+#if UFBXT_IMPL
+{
+	ufbx_error error;
+	ufbx_anim_cursor *cursor = ufbx_create_anim_cursor(scene, NULL, NULL, &error);
+	if (!cursor) ufbxt_log_error(&error);
+	ufbxt_assert(cursor);
+	ufbxt_assert(cursor->anim == scene->anim);
+	ufbxt_assert(cursor->curve_keys.count == scene->anim_curves.count);
+
+	double begin = scene->anim->time_begin - 0.5;
+	double end = scene->anim->time_end + 0.5;
+	size_t num_steps = 64;
+
+	// Forward playback, backward playback and seeking back and forth
+	for (size_t pass = 0; pass < 3; pass++) {
+		for (size_t step = 0; step <= num_steps; step++) {
+			size_t ix = step;
+			if (pass == 1) ix = num_steps - step;
+			if (pass == 2) ix = (step * 37) % (num_steps + 1);
+			double time = begin + (end - begin) * (double)ix / (double)num_steps;
+
+			for (size_t i = 0; i < scene->nodes.count; i++) {
+				ufbx_node *node = scene->nodes.data[i];
+				ufbx_transform ref = ufbx_evaluate_transform(scene->anim, node, time);
+				ufbx_transform tr = ufbx_evaluate_transform_cursor(cursor, node, time, 0);
+				ufbxt_assert(!memcmp(&ref.translation, &tr.translation, sizeof(ufbx_vec3)));
+				ufbxt_assert(!memcmp(&ref.rotation, &tr.rotation, sizeof(ufbx_quat)));
+				ufbxt_assert(!memcmp(&ref.scale, &tr.scale, sizeof(ufbx_vec3)));
+
+				ufbx_prop ref_prop = ufbx_evaluate_prop(scene->anim, &node->element, "Lcl Rotation", time);
+				ufbx_prop prop = ufbx_evaluate_prop_cursor(cursor, &node->element, "Lcl Rotation", time, 0);
+				ufbxt_assert(!memcmp(&ref_prop.value_vec3, &prop.value_vec3, sizeof(ufbx_vec3)));
+			}
+		}
+	}
+
+	ufbx_free_anim_cursor(cursor);
+
+	for (size_t i = 0; i < scene->anim_curves.count; i++) {
+		ufbx_anim_curve *curve = scene->anim_curves.data[i];
+		ufbx_curve_cursor curve_cursor = { curve };
+		for (size_t pass = 0; pass < 2; pass++) {
+			for (size_t step = 0; step <= num_steps; step++) {
+				size_t ix = pass == 0 ? step : (step * 37) % (num_steps + 1);
+				double time = begin + (end - begin) * (double)ix / (double)num_steps;
+				ufbx_real ref = ufbx_evaluate_curve(curve, time, 0.0f);
+				ufbx_real value = ufbx_evaluate_curve_cursor(&curve_cursor, time, 0.0f, 0);
+				ufbxt_assert(ref == value);
+			}
+		}
+	}
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_check_compiled_anim(ufbx_scene *scene, const ufbx_anim *anim, const ufbx_compile_anim_opts *opts)
+{
+	ufbx_error error;
+	ufbx_compiled_anim *compiled = ufbx_compile_anim(scene, anim, opts, &error);
+	if (!compiled) ufbxt_log_error(&error);
+	ufbxt_assert(compiled);
+
+	uint32_t flags = opts ? opts->transform_flags : 0;
+	size_t num_nodes = compiled->nodes.count;
+	ufbx_transform *transforms = (ufbx_transform*)calloc(num_nodes + 1, sizeof(ufbx_transform));
+	ufbxt_assert(transforms);
+
+	double begin = compiled->anim->time_begin - 0.5;
+	double end = compiled->anim->time_end + 0.5;
+	size_t num_steps = 48;
+	for (size_t step = 0; step <= num_steps * 2; step++) {
+		// Play forward once and then seek around
+		size_t ix = step <= num_steps ? step : (step * 29) % (num_steps + 1);
+		double time = begin + (end - begin) * (double)ix / (double)num_steps;
+
+		size_t num_written = ufbx_evaluate_compiled_anim(compiled, time, transforms, num_nodes + 1);
+		ufbxt_assert(num_written == num_nodes);
+
+		for (size_t i = 0; i < num_nodes; i++) {
+			ufbx_transform ref = ufbx_evaluate_transform_flags(compiled->anim, compiled->nodes.data[i], time, flags);
+			ufbxt_assert(!memcmp(&ref.translation, &transforms[i].translation, sizeof(ufbx_vec3)));
+			ufbxt_assert(!memcmp(&ref.rotation, &transforms[i].rotation, sizeof(ufbx_quat)));
+			ufbxt_assert(!memcmp(&ref.scale, &transforms[i].scale, sizeof(ufbx_vec3)));
+		}
+	}
+
+	free(transforms);
+	ufbx_free_compiled_anim(compiled);
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(anim_compile_helpers, maya_anim_no_inherit_scale, ufbxt_scale_helper_opts)
+#if UFBXT_IMPL
+{
+	ufbxt_check_compiled_anim(scene, NULL, NULL);
+
+	ufbx_compile_anim_opts opts = { 0 };
+	opts.transform_flags = UFBX_TRANSFORM_FLAG_IGNORE_SCALE_HELPER|UFBX_TRANSFORM_FLAG_IGNORE_COMPONENTWISE_SCALE|UFBX_TRANSFORM_FLAG_NO_EXTRAPOLATION;
+	ufbxt_check_compiled_anim(scene, NULL, &opts);
+
+	ufbx_error error;
+	ufbx_compiled_anim *compiled = ufbx_compile_anim(scene, NULL, NULL, &error);
+	if (!compiled) ufbxt_log_error(&error);
+	ufbxt_assert(compiled);
+	ufbxt_assert(compiled->num_fallback_nodes > 0);
+	ufbx_free_compiled_anim(compiled);
+
+	compiled = ufbx_compile_anim(scene, NULL, &opts, &error);
+	if (!compiled) ufbxt_log_error(&error);
+	ufbxt_assert(compiled);
+	ufbxt_assert(compiled->num_curves > 0);
+	ufbxt_assert(compiled->num_fallback_nodes == 0);
+	ufbx_free_compiled_anim(compiled);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(anim_compile_stacks, blender_279_sausage)
+#if UFBXT_IMPL
+{
+	for (size_t i = 0; i < scene->anim_stacks.count; i++) {
+		ufbxt_check_compiled_anim(scene, scene->anim_stacks.data[i]->anim, NULL);
+	}
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(anim_compile_layers, maya_anim_layer_anim)
+#if UFBXT_IMPL
+{
+	ufbxt_check_compiled_anim(scene, NULL, NULL);
+	for (size_t i = 0; i < scene->anim_stacks.count; i++) {
+		ufbxt_check_compiled_anim(scene, scene->anim_stacks.data[i]->anim, NULL);
+	}
+	for (size_t i = 0; i < scene->anim_layers.count; i++) {
+		ufbxt_check_compiled_anim(scene, scene->anim_layers.data[i]->anim, NULL);
+	}
+
+	uint32_t node_ids[] = { (uint32_t)scene->nodes.count - 1, 0 };
+	ufbx_compile_anim_opts opts = { 0 };
+	opts.node_ids.data = node_ids;
+	opts.node_ids.count = ufbxt_arraycount(node_ids);
+
+	ufbx_error error;
+	ufbx_compiled_anim *compiled = ufbx_compile_anim(scene, NULL, &opts, &error);
+	if (!compiled) ufbxt_log_error(&error);
+	ufbxt_assert(compiled);
+	ufbxt_assert(compiled->nodes.count == 2);
+	ufbxt_assert(compiled->nodes.data[0] == scene->nodes.data[scene->nodes.count - 1]);
+	ufbxt_assert(compiled->nodes.data[1] == scene->nodes.data[0]);
+	ufbx_free_compiled_anim(compiled);
+	ufbxt_check_compiled_anim(scene, NULL, &opts);
+
+	node_ids[0] = (uint32_t)scene->nodes.count;
+	compiled = ufbx_compile_anim(scene, NULL, &opts, &error);
+	ufbxt_assert(!compiled);
+	ufbxt_assert(error.type == UFBX_ERROR_UNKNOWN);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(anim_compile_interpolation, maya_interpolation_modes)
+#if UFBXT_IMPL
+{
+	ufbxt_check_compiled_anim(scene, NULL, NULL);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(anim_compile_extrapolation, maya_anim_extrapolation)
+#if UFBXT_IMPL
+{
+	ufbxt_check_compiled_anim(scene, NULL, NULL);
+
+	ufbx_compile_anim_opts opts = { 0 };
+	opts.transform_flags = UFBX_TRANSFORM_FLAG_NO_EXTRAPOLATION;
+	ufbxt_check_compiled_anim(scene, NULL, &opts);
+}
+#endif
+
 UFBXT_FILE_TEST(maya_anim_pivot_rotate)
 #if UFBXT_IMPL
 {
@@ -179,7 +179,6 @@ static bool ufbxt_single_thread_pool_init_fn(void *user, ufbx_thread_pool_contex
 {
 	ufbxt_single_thread_pool *pool = (ufbxt_single_thread_pool*)user;
 	pool->initialized = true;
-
 	return true;
 }
 
@@ -364,6 +363,348 @@ UFBXT_TEST(single_thread_deferred_memory)
 }
 #endif
 
+#if UFBXT_IMPL
+static double ufbxt_stats_clock(void *user)
+{
+	(void)user;
+	return cputime_os_tick_to_sec(NULL, cputime_os_tick());
+}
+#endif
+
+UFBXT_TEST(load_stats)
+#if UFBXT_IMPL
+{
+	char path[512];
+	ufbxt_file_iterator iter = { "blender_293_barbarian" };
+	while (ufbxt_next_file(&iter, path, sizeof(path))) {
+		ufbxt_single_thread_pool pool;
+		ufbx_load_opts opts = { 0 };
+		ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, true);
+		opts.collect_stats = true;
+		opts.stats_clock_cb.fn = &ufbxt_stats_clock;
+
+		ufbx_error error;
+		ufbx_scene *scene = ufbx_load_file(path, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		const ufbx_load_stats *stats = &scene->metadata.load_stats;
+		ufbxt_assert(stats->enabled);
+		ufbxt_assert(stats->total_time > 0.0);
+		ufbxt_assert(stats->phase_time[UFBX_LOAD_PHASE_PARSE] > 0.0);
+		ufbxt_assert(stats->phase_time[UFBX_LOAD_PHASE_READ_ELEMENTS] > 0.0);
+		ufbxt_assert(stats->phase_time[UFBX_LOAD_PHASE_FINALIZE] > 0.0);
+		ufbxt_assert(stats->phase_time[UFBX_LOAD_PHASE_SKINNING] == 0.0);
+
+		double phase_total = 0.0;
+		for (size_t i = 0; i < UFBX_LOAD_PHASE_COUNT; i++) {
+			ufbxt_assert(stats->phase_time[i] >= 0.0);
+			phase_total += stats->phase_time[i];
+		}
+		ufbxt_assert(fabs(phase_total - stats->total_time) <= stats->total_time * 1e-6);
+
+		ufbxt_assert(stats->num_deflate_arrays > 0);
+		ufbxt_assert(stats->deflate_bytes_in > 0);
+		ufbxt_assert(stats->deflate_bytes_out > stats->deflate_bytes_in);
+		if (ufbxt_is_big_endian()) {
+			ufbxt_assert(stats->num_tasks == 0);
+			ufbxt_assert(stats->num_deflate_tasks == 0);
+		} else {
+			ufbxt_assert(stats->num_tasks >= 100);
+			ufbxt_assert(stats->num_deflate_tasks > 0);
+			ufbxt_assert(stats->num_deflate_tasks <= stats->num_tasks);
+			ufbxt_assert(stats->task_time > 0.0);
+		}
+		ufbxt_assert(stats->parallel_speedup > 0.0);
+
+		ufbxt_assert(stats->temp_memory_peak >= scene->metadata.temp_memory_used);
+		ufbxt_assert(stats->result_memory_peak > 0);
+		ufbxt_assert(stats->num_string_hits > 0);
+		ufbxt_assert(stats->num_string_hits <= stats->num_string_lookups);
+
+		ufbxt_check_scene(scene);
+		ufbx_free_scene(scene);
+
+		// Nothing should be reported without `collect_stats`
+		opts.collect_stats = false;
+		scene = ufbx_load_file(path, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		stats = &scene->metadata.load_stats;
+		ufbxt_assert(!stats->enabled);
+		ufbxt_assert(stats->total_time == 0.0);
+		ufbxt_assert(stats->num_deflate_arrays == 0);
+		ufbxt_assert(stats->num_string_lookups == 0);
+
+		ufbx_free_scene(scene);
+	}
+}
+#endif
+
+#if UFBXT_IMPL
+// Task indices start from zero in each thread pool context (see `ufbx_thread_pool_init_fn`).
+// The single thread pool keeps its state in `user` instead of per context, which works
+// here as the cache players using it are created one after another.
+static bool ufbxt_cache_player_pool_init_fn(void *user, ufbx_thread_pool_context ctx, const ufbx_thread_pool_info *info)
+{
+	ufbxt_single_thread_pool *pool = (ufbxt_single_thread_pool*)user;
+	pool->wait_index = 0;
+	return ufbxt_single_thread_pool_init_fn(user, ctx, info);
+}
+#endif
+
+UFBXT_TEST(thread_cache_player)
+#if UFBXT_IMPL
+{
+	for (int immediate = 0; immediate <= 1; immediate++) {
+		ufbx_thread_pool pool = { 0 };
+		ufbxt_single_thread_pool single_pool;
+		ufbxt_single_thread_pool_init(&pool, &single_pool, immediate != 0);
+		pool.init_fn = ufbxt_cache_player_pool_init_fn;
+
+		ufbxt_check_cache_player("max_cache_box_7500_binary_fpc/max_cache_box.pc2", &pool);
+		ufbxt_check_cache_player("caches/sine_mcsd_oversample/cache.xml", &pool);
+		ufbxt_assert(single_pool.dispatches > 0);
+		ufbxt_assert(single_pool.freed);
+	}
+}
+#endif
+
+UFBXT_TEST(thread_ascii_sections)
+#if UFBXT_IMPL
+{
+	char path[512];
+	ufbxt_file_iterator iter = { "maya_slime" };
+	while (ufbxt_next_file(&iter, path, sizeof(path))) {
+		if (!strstr(path, "_ascii")) continue;
+
+		ufbxt_single_thread_pool pool;
+		ufbx_load_opts opts = { 0 };
+		ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, false);
+		opts.collect_stats = true;
+
+		size_t size = 0;
+		void *data = ufbxt_read_file(path, &size);
+		ufbxt_assert(data);
+
+		ufbx_error error;
+		ufbx_scene *scene = ufbx_load_memory(data, size, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		const ufbx_load_stats *stats = &scene->metadata.load_stats;
+#if defined(UFBX_REGRESSION)
+		ufbxt_assert(stats->num_ascii_section_tasks > 0);
+#else
+		// Files below `UFBXI_MIN_THREADED_ASCII_LEX_BYTES` are lexed inline
+		ufbxt_assert(stats->num_ascii_section_tasks == 0);
+#endif
+		ufbxt_assert(stats->num_ascii_section_tasks <= stats->num_tasks);
+
+		ufbxt_check_scene(scene);
+		ufbx_free_scene(scene);
+
+		// Streamed loads cannot look ahead in the file
+		ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, false);
+		scene = ufbx_load_file(path, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		stats = &scene->metadata.load_stats;
+		ufbxt_assert(stats->num_ascii_section_tasks == 0);
+
+		ufbx_free_scene(scene);
+		free(data);
+	}
+}
+#endif
+
+#if UFBXT_IMPL
+static size_t ufbxt_format_ascii_split_mesh(char *dst, size_t dst_size, size_t num_verts, bool comment)
+{
+	size_t len = 0;
+	len += (size_t)snprintf(dst + len, dst_size - len,
+		"; FBX 7.5.0 project file\n"
+		"FBXHeaderExtension:  {\n\tFBXHeaderVersion: 1003\n\tFBXVersion: 7500\n}\n"
+		"Documents:  {\n\tCount: 0\n}\n"
+		"Definitions:  {\n\tVersion: 100\n}\n"
+		"Objects:  {\n\tGeometry: 1, \"Geometry::\", \"Mesh\" {\n\t\tVertices: *%zu {\n\t\t\ta: ", num_verts * 3);
+	for (size_t i = 0; i < num_verts * 3; i++) {
+		if (comment && i == num_verts) {
+			len += (size_t)snprintf(dst + len, dst_size - len, "; comment, with, commas\n");
+		}
+		len += (size_t)snprintf(dst + len, dst_size - len, "%s%.2f", i > 0 ? "," : "", (double)i * 0.25);
+	}
+	len += (size_t)snprintf(dst + len, dst_size - len, "\n\t\t}\n\t\tPolygonVertexIndex: *%zu {\n\t\t\ta: ", num_verts);
+	for (size_t i = 0; i < num_verts; i++) {
+		int32_t ix = (int32_t)i;
+		if (i % 3 == 2) ix = ~ix;
+		len += (size_t)snprintf(dst + len, dst_size - len, "%s%d", i > 0 ? "," : "", ix);
+	}
+	len += (size_t)snprintf(dst + len, dst_size - len, "\n\t\t}\n\t}\n}\n");
+	ufbxt_assert(len < dst_size);
+	return len;
+}
+#endif
+
+UFBXT_TEST(thread_ascii_array_split)
+#if UFBXT_IMPL
+{
+	size_t num_verts = 60000;
+	size_t data_size = num_verts * 48 + 1024;
+	char *data = (char*)malloc(data_size);
+	ufbxt_assert(data);
+
+	for (int comment = 0; comment <= 1; comment++) {
+		size_t size = ufbxt_format_ascii_split_mesh(data, data_size, num_verts, comment != 0);
+
+		ufbxt_single_thread_pool pool;
+		ufbx_load_opts opts = { 0 };
+		ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, false);
+		opts.collect_stats = true;
+
+		ufbx_error error;
+		ufbx_scene *scene = ufbx_load_memory(data, size, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		// Arrays are several times the split size, so each should be parsed in multiple tasks
+		ufbxt_assert(scene->metadata.load_stats.num_ascii_array_tasks > 2);
+
+		opts.thread_opts.pool.init_fn = NULL;
+		opts.thread_opts.pool.run_fn = NULL;
+		opts.thread_opts.pool.wait_fn = NULL;
+		opts.thread_opts.pool.free_fn = NULL;
+		opts.force_single_thread_ascii_parsing = true;
+		ufbx_scene *ref_scene = ufbx_load_memory(data, size, &opts, &error);
+		if (!ref_scene) ufbxt_log_error(&error);
+		ufbxt_assert(ref_scene);
+		ufbxt_assert(ref_scene->metadata.load_stats.num_ascii_array_tasks == 0);
+
+		ufbxt_assert(scene->meshes.count == 1 && ref_scene->meshes.count == 1);
+		ufbx_mesh *mesh = scene->meshes.data[0];
+		ufbx_mesh *ref_mesh = ref_scene->meshes.data[0];
+		ufbxt_assert(mesh->num_vertices == num_verts);
+		ufbxt_assert(mesh->num_indices == num_verts);
+		ufbxt_assert(ref_mesh->num_vertices == num_verts);
+		for (size_t i = 0; i < num_verts; i++) {
+			ufbx_vec3 v = mesh->vertices.data[i];
+			ufbx_vec3 ref = ref_mesh->vertices.data[i];
+			ufbxt_assert(v.x == ref.x && v.y == ref.y && v.z == ref.z);
+			ufbxt_assert(v.x == (ufbx_real)((double)(i * 3 + 0) * 0.25));
+			ufbxt_assert(mesh->vertex_indices.data[i] == ref_mesh->vertex_indices.data[i]);
+			ufbxt_assert(mesh->vertex_indices.data[i] == (uint32_t)i);
+		}
+
+		ufbxt_check_scene(scene);
+		ufbx_free_scene(scene);
+		ufbx_free_scene(ref_scene);
+	}
+
+	free(data);
+}
+#endif
+
+#if UFBXT_IMPL
+static size_t ufbxt_format_obj_chunks(char *dst, size_t dst_size, size_t num_quads)
+{
+	size_t len = 0;
+	for (size_t i = 0; i < num_quads; i++) {
+		if (i % 500 == 0) {
+			len += (size_t)snprintf(dst + len, dst_size - len, "o Part%zu\ng Group%zu\nusemtl Mat%zu\ns %s\n",
+				i / 500, i / 1000, i / 1500, i % 1000 == 0 ? "1" : "off");
+		}
+		double x = (double)i * 0.5;
+		for (size_t j = 0; j < 4; j++) {
+			double u = (double)(j & 1), v = (double)(j >> 1);
+			len += (size_t)snprintf(dst + len, dst_size - len, "v %.2f %.2f %.2f\nvt %.1f %.1f\n", x + u, v, x * 0.25, u, v);
+		}
+		len += (size_t)snprintf(dst + len, dst_size - len, "vn 0 0 1\n");
+		if (i % 7 == 3) {
+			// Line continuation in the middle of a face
+			len += (size_t)snprintf(dst + len, dst_size - len, "f -4/-4/-1 -3/-3/-1 \\\r\n -1/-1/-1 -2/-2/-1\n");
+		} else {
+			size_t b = i * 4 + 1;
+			len += (size_t)snprintf(dst + len, dst_size - len, "f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n",
+				b, b, i + 1, b + 1, b + 1, i + 1, b + 3, b + 3, i + 1, b + 2, b + 2, i + 1);
+		}
+	}
+	// Unterminated last line is parsed normally
+	len += (size_t)snprintf(dst + len, dst_size - len, "f 1 2 3");
+	ufbxt_assert(len < dst_size);
+	return len;
+}
+#endif
+
+UFBXT_TEST(thread_obj_chunks)
+#if UFBXT_IMPL
+{
+	size_t num_quads = 5000;
+	size_t data_size = num_quads * 256 + 1024;
+	char *data = (char*)malloc(data_size);
+	ufbxt_assert(data);
+
+	size_t size = ufbxt_format_obj_chunks(data, data_size, num_quads);
+
+	ufbxt_single_thread_pool pool;
+	ufbx_load_opts opts = { 0 };
+	ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, false);
+	opts.file_format = UFBX_FILE_FORMAT_OBJ;
+	opts.collect_stats = true;
+
+	ufbx_error error;
+	ufbx_scene *scene = ufbx_load_memory(data, size, &opts, &error);
+	if (!scene) ufbxt_log_error(&error);
+	ufbxt_assert(scene);
+	ufbxt_assert(scene->metadata.load_stats.num_obj_chunk_tasks > 2);
+
+	opts.thread_opts.pool.init_fn = NULL;
+	opts.thread_opts.pool.run_fn = NULL;
+	opts.thread_opts.pool.wait_fn = NULL;
+	opts.thread_opts.pool.free_fn = NULL;
+	ufbx_scene *ref_scene = ufbx_load_memory(data, size, &opts, &error);
+	if (!ref_scene) ufbxt_log_error(&error);
+	ufbxt_assert(ref_scene);
+	ufbxt_assert(ref_scene->metadata.load_stats.num_obj_chunk_tasks == 0);
+
+	ufbxt_assert(scene->meshes.count == ref_scene->meshes.count);
+	ufbxt_assert(scene->meshes.count == num_quads / 500);
+	ufbxt_assert(scene->materials.count == ref_scene->materials.count);
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		ufbx_mesh *ref = ref_scene->meshes.data[mesh_ix];
+		ufbxt_assert(mesh->num_faces == ref->num_faces);
+		ufbxt_assert(mesh->num_indices == ref->num_indices);
+		ufbxt_assert(mesh->face_groups.count == ref->face_groups.count);
+		ufbxt_assert(mesh->materials.count == ref->materials.count);
+		for (size_t i = 0; i < mesh->num_faces; i++) {
+			ufbxt_assert(mesh->faces.data[i].index_begin == ref->faces.data[i].index_begin);
+			ufbxt_assert(mesh->faces.data[i].num_indices == ref->faces.data[i].num_indices);
+			if (mesh->face_material.count > 0) ufbxt_assert(mesh->face_material.data[i] == ref->face_material.data[i]);
+			if (mesh->face_group.count > 0) ufbxt_assert(mesh->face_group.data[i] == ref->face_group.data[i]);
+			if (mesh->face_smoothing.count > 0) ufbxt_assert(mesh->face_smoothing.data[i] == ref->face_smoothing.data[i]);
+		}
+		for (size_t i = 0; i < mesh->num_indices; i++) {
+			ufbx_vec3 p = ufbx_get_vertex_vec3(&mesh->vertex_position, i);
+			ufbx_vec3 ref_p = ufbx_get_vertex_vec3(&ref->vertex_position, i);
+			ufbx_vec2 uv = ufbx_get_vertex_vec2(&mesh->vertex_uv, i);
+			ufbx_vec2 ref_uv = ufbx_get_vertex_vec2(&ref->vertex_uv, i);
+			ufbx_vec3 n = ufbx_get_vertex_vec3(&mesh->vertex_normal, i);
+			ufbx_vec3 ref_n = ufbx_get_vertex_vec3(&ref->vertex_normal, i);
+			ufbxt_assert(p.x == ref_p.x && p.y == ref_p.y && p.z == ref_p.z);
+			ufbxt_assert(uv.x == ref_uv.x && uv.y == ref_uv.y);
+			ufbxt_assert(n.x == ref_n.x && n.y == ref_n.y && n.z == ref_n.z);
+		}
+	}
+
+	ufbxt_check_scene(scene);
+	ufbx_free_scene(scene);
+	ufbx_free_scene(ref_scene);
+	free(data);
+}
+#endif
+
 UFBXT_TEST(thread_memory_limit)
 #if UFBXT_IMPL
 {
@@ -407,6 +748,155 @@ UFBXT_TEST(thread_memory_limit)
 }
 #endif
 
+UFBXT_TEST(memory_map_file)
+#if UFBXT_IMPL
+{
+	char path[512];
+	ufbxt_file_iterator iter = { "blender_293_barbarian" };
+	while (ufbxt_next_file(&iter, path, sizeof(path))) {
+		ufbxt_single_thread_pool pool;
+		ufbx_load_opts opts = { 0 };
+		ufbxt_single_thread_pool_init(&opts.thread_opts.pool, &pool, false);
+		opts.use_memory_map = true;
+		opts.collect_stats = true;
+
+		size_t size = 0;
+		void *data = ufbxt_read_file(path, &size);
+		ufbxt_assert(data);
+
+		ufbx_error error;
+		ufbx_scene *scene = ufbx_load_file(path, &opts, &error);
+		if (!scene) ufbxt_log_error(&error);
+		ufbxt_assert(scene);
+
+		// Platforms without `mmap()` fall back to stdio
+		uint64_t mapped_bytes = scene->metadata.load_stats.memory_mapped_bytes;
+		ufbxt_assert(mapped_bytes == 0 || mapped_bytes == size);
+		#if defined(__linux__)
+			ufbxt_assert(mapped_bytes == size);
+		#endif
+
+		ufbxt_assert(pool.initialized);
+		ufbxt_assert(pool.freed);
+		if (ufbxt_is_big_endian()) {
+			ufbxt_assert(pool.wait_index == 0);
+		} else {
+			ufbxt_assert(pool.wait_index >= 100);
+		}
+
+		ufbx_scene *ref_scene = ufbx_load_memory(data, size, NULL, &error);
+		if (!ref_scene) ufbxt_log_error(&error);
+		ufbxt_assert(ref_scene);
+
+		ufbxt_assert(scene->nodes.count == ref_scene->nodes.count);
+		ufbxt_assert(scene->meshes.count == ref_scene->meshes.count);
+		for (size_t i = 0; i < scene->meshes.count; i++) {
+			ufbx_mesh *mesh = scene->meshes.data[i];
+			ufbx_mesh *ref = ref_scene->meshes.data[i];
+			ufbxt_assert(mesh->num_vertices == ref->num_vertices);
+			ufbxt_assert(mesh->num_indices == ref->num_indices);
+			ufbxt_assert(!memcmp(mesh->vertex_indices.data, ref->vertex_indices.data, mesh->num_indices * sizeof(uint32_t)));
+			ufbxt_assert(!memcmp(mesh->vertices.data, ref->vertices.data, mesh->num_vertices * sizeof(ufbx_vec3)));
+		}
+
+		ufbxt_check_scene(scene);
+		ufbx_free_scene(scene);
+		ufbx_free_scene(ref_scene);
+		free(data);
+	}
+}
+#endif
+
+UFBXT_TEST(memory_map_file_not_found)
+#if UFBXT_IMPL
+{
+	ufbx_load_opts opts = { 0 };
+	opts.use_memory_map = true;
+
+	ufbx_error error;
+	ufbx_scene *scene = ufbx_load_file("<doesnotexist>.fbx", &opts, &error);
+	ufbxt_assert(!scene);
+	ufbxt_assert(error.type == UFBX_ERROR_FILE_NOT_FOUND);
+	ufbxt_assert(strstr(error.info, "<doesnotexist>.fbx"));
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_check_no_copy_arrays(const ufbx_load_opts *base_opts, const char *path, size_t *p_num_no_copy)
+{
+	size_t size = 0;
+	void *data = ufbxt_read_file(path, &size);
+	ufbxt_assert(data);
+	void *original = malloc(size);
+	ufbxt_assert(original);
+	memcpy(original, data, size);
+
+	ufbx_load_opts opts = *base_opts;
+	opts.collect_stats = true;
+
+	ufbx_error error;
+	ufbx_scene *ref_scene = ufbx_load_memory(data, size, &opts, &error);
+	if (!ref_scene) ufbxt_log_error(&error);
+	ufbxt_assert(ref_scene);
+	ufbxt_assert(ref_scene->metadata.load_stats.num_no_copy_arrays == 0);
+
+	opts.no_copy_arrays = true;
+	ufbx_scene *scene = ufbx_load_memory(data, size, &opts, &error);
+	if (!scene) ufbxt_log_error(&error);
+	ufbxt_assert(scene);
+	ufbxt_check_scene(scene);
+	*p_num_no_copy += scene->metadata.load_stats.num_no_copy_arrays;
+
+	// Referenced arrays must not be modified even if ufbx needs to patch them
+	ufbxt_assert(!memcmp(data, original, size));
+
+	ufbxt_assert(scene->meshes.count == ref_scene->meshes.count);
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		ufbx_mesh *ref = ref_scene->meshes.data[mesh_ix];
+		ufbxt_assert(mesh->num_indices == ref->num_indices);
+		ufbxt_assert(mesh->uv_sets.count == ref->uv_sets.count);
+		for (size_t set_ix = 0; set_ix < mesh->uv_sets.count; set_ix++) {
+			const ufbx_vertex_vec2 *uv = &mesh->uv_sets.data[set_ix].vertex_uv;
+			const ufbx_vertex_vec2 *ref_uv = &ref->uv_sets.data[set_ix].vertex_uv;
+			ufbxt_assert(uv->indices.count == ref_uv->indices.count);
+			ufbxt_assert(!memcmp(uv->indices.data, ref_uv->indices.data, uv->indices.count * sizeof(uint32_t)));
+		}
+		for (size_t i = 0; i < mesh->num_indices; i++) {
+			ufbx_vec3 n = ufbx_get_vertex_vec3(&mesh->vertex_normal, i);
+			ufbx_vec3 ref_n = ufbx_get_vertex_vec3(&ref->vertex_normal, i);
+			ufbxt_assert(n.x == ref_n.x && n.y == ref_n.y && n.z == ref_n.z);
+		}
+	}
+
+	ufbx_free_scene(scene);
+	ufbx_free_scene(ref_scene);
+	free(original);
+	free(data);
+}
+#endif
+
+UFBXT_TEST(no_copy_arrays)
+#if UFBXT_IMPL
+{
+	char path[512];
+	ufbxt_file_iterator iter = { "blender_279_uv_sets" };
+	size_t num_no_copy = 0, num_no_copy_reversed = 0;
+	while (ufbxt_next_file(&iter, path, sizeof(path))) {
+		ufbx_load_opts opts = { 0 };
+		ufbxt_check_no_copy_arrays(&opts, path, &num_no_copy);
+
+		// Reversing the winding modifies the indices in place
+		opts.reverse_winding = true;
+		ufbxt_check_no_copy_arrays(&opts, path, &num_no_copy_reversed);
+	}
+	if (!ufbxt_is_big_endian()) {
+		ufbxt_assert(num_no_copy > 0);
+		ufbxt_assert(num_no_copy_reversed > 0);
+	}
+}
+#endif
+
 UFBXT_TEST(single_thread_file_not_found)
 #if UFBXT_IMPL
 {
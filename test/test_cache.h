@@ -233,3 +233,193 @@ UFBXT_TEST(cache_skip_read)
 }
 #endif
 
+
+#if UFBXT_IMPL
+static bool ufbxt_open_file_counted(void *user, ufbx_stream *stream, const char *path, size_t path_len, const ufbx_open_file_info *info)
+{
+	++*(size_t*)user;
+	return ufbx_open_file(stream, path, path_len, NULL, NULL);
+}
+
+static void ufbxt_check_retained_cache(const char *path)
+{
+	char buffer[512];
+	snprintf(buffer, sizeof(buffer), "%s%s", data_root, path);
+
+	size_t num_opens = 0;
+	ufbx_geometry_cache_opts opts = { 0 };
+	opts.open_file_cb.fn = &ufbxt_open_file_counted;
+	opts.open_file_cb.user = &num_opens;
+
+	ufbx_error error;
+	ufbx_geometry_cache *ref_cache = ufbx_load_geometry_cache(buffer, &opts, &error);
+	if (!ref_cache) ufbxt_log_error(&error);
+	ufbxt_assert(ref_cache);
+
+	opts.retain_file_data = true;
+	ufbx_geometry_cache *cache = ufbx_load_geometry_cache(buffer, &opts, &error);
+	if (!cache) ufbxt_log_error(&error);
+	ufbxt_assert(cache);
+	ufbxt_assert(cache->frames.count == ref_cache->frames.count);
+	ufbxt_assert(cache->frames.count > 0);
+
+	ufbx_geometry_cache_data_opts data_opts = { 0 };
+	data_opts.open_file_cb.fn = &ufbxt_open_file_counted;
+	data_opts.open_file_cb.user = &num_opens;
+
+	for (size_t i = 0; i < cache->frames.count; i++) {
+		ufbx_cache_frame *frame = &cache->frames.data[i];
+		ufbx_cache_frame *ref_frame = &ref_cache->frames.data[i];
+		ufbxt_assert(ref_frame->data.size == 0);
+		ufbxt_assert(frame->data.size == frame->data_total_bytes);
+
+		size_t num_values = frame->data_count * 3;
+		ufbx_real *values = (ufbx_real*)calloc(num_values, sizeof(ufbx_real));
+		ufbx_real *ref_values = (ufbx_real*)calloc(num_values, sizeof(ufbx_real));
+		ufbxt_assert(values && ref_values);
+
+		size_t ref_read = ufbx_read_geometry_cache_real(ref_frame, ref_values, num_values, &data_opts);
+
+		// Retained frames should be read without opening any files
+		size_t opens_before = num_opens;
+		size_t num_read = ufbx_read_geometry_cache_real(frame, values, num_values, &data_opts);
+		ufbxt_assert(num_opens == opens_before);
+
+		ufbxt_assert(num_read > 0);
+		ufbxt_assert(num_read == ref_read);
+		for (size_t j = 0; j < num_read; j++) {
+			ufbxt_assert(values[j] == ref_values[j]);
+		}
+
+		free(values);
+		free(ref_values);
+	}
+
+	ufbx_free_geometry_cache(cache);
+	ufbx_free_geometry_cache(ref_cache);
+}
+#endif
+
+UFBXT_TEST(cache_retain_file_data)
+#if UFBXT_IMPL
+{
+	ufbxt_check_retained_cache("max_cache_box_7500_binary_fpc/max_cache_box.pc2");
+	ufbxt_check_retained_cache("caches/sine_mcmf_undersample/cache.xml");
+	ufbxt_check_retained_cache("caches/sine_mcsd_oversample/cache.xml");
+	ufbxt_check_retained_cache("caches/sine_mxmd_oversample/cache.xml");
+	ufbxt_check_retained_cache("caches/sine_mxsf_regular/cache.xml");
+}
+#endif
+
+UFBXT_TEST(cache_retain_scene_data)
+#if UFBXT_IMPL
+{
+	char buffer[512];
+	snprintf(buffer, sizeof(buffer), "%s%s", data_root, "max_cache_box_7500_binary.fbx");
+
+	ufbx_load_opts opts = { 0 };
+	opts.load_external_files = true;
+	opts.retain_geometry_cache_data = true;
+
+	ufbx_error error;
+	ufbx_scene *scene = ufbx_load_file(buffer, &opts, &error);
+	if (!scene) ufbxt_log_error(&error);
+	ufbxt_assert(scene);
+
+	ufbx_node *node = ufbx_find_node(scene, "Box001");
+	ufbxt_assert(node && node->mesh);
+	ufbxt_assert(node->mesh->cache_deformers.count == 1);
+	ufbx_cache_channel *channel = node->mesh->cache_deformers.data[0]->external_channel;
+	ufbxt_assert(channel && channel->frames.count == 11);
+	for (size_t i = 0; i < channel->frames.count; i++) {
+		const ufbx_cache_frame *frame = &channel->frames.data[i];
+		ufbxt_assert(frame->data.size == frame->data_total_bytes);
+		ufbxt_assert(frame->data.size == 770 * 12);
+	}
+
+	ufbxt_check_scene(scene);
+	ufbx_free_scene(scene);
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_check_cache_player_channel(const ufbx_cache_channel *channel, const ufbx_thread_pool *pool, size_t window_size, bool reverse)
+{
+	ufbx_cache_player_opts opts = { 0 };
+	if (pool) opts.thread_opts.pool = *pool;
+	opts.window_size = window_size;
+	opts.reverse = reverse;
+
+	ufbx_error error;
+	ufbx_cache_player *player = ufbx_create_cache_player(channel, &opts, &error);
+	if (!player) ufbxt_log_error(&error);
+	ufbxt_assert(player);
+	ufbxt_assert(player->channel == channel);
+
+	size_t num_values = player->max_values;
+	ufbxt_assert(num_values > 0);
+	ufbx_real *values = (ufbx_real*)calloc(num_values, sizeof(ufbx_real));
+	ufbx_real *ref_values = (ufbx_real*)calloc(num_values, sizeof(ufbx_real));
+	ufbxt_assert(values && ref_values);
+
+	double begin = channel->frames.data[0].time - 0.1;
+	double end = channel->frames.data[channel->frames.count - 1].time + 0.1;
+	double step = (end - begin) / (double)(channel->frames.count * 3 + 7);
+
+	ufbx_geometry_cache_data_opts data_opts = { 0 };
+	for (size_t i = 0; i <= channel->frames.count * 3 + 7; i++) {
+		double time = reverse ? end - step * (double)i : begin + step * (double)i;
+
+		// Exercise blending options and seeking against the playback direction
+		data_opts.additive = i % 5 == 3;
+		data_opts.use_weight = i % 4 == 1;
+		data_opts.weight = 0.5f;
+		if (i % 11 == 10) time = reverse ? end : begin;
+
+		for (size_t j = 0; j < num_values; j++) {
+			values[j] = ref_values[j] = (ufbx_real)j;
+		}
+
+		size_t ref_read = ufbx_sample_geometry_cache_real(channel, time, ref_values, num_values, &data_opts);
+		size_t num_read = ufbx_sample_cache_player_real(player, time, values, num_values, &data_opts);
+		ufbxt_assert(num_read == ref_read);
+		for (size_t j = 0; j < num_values; j++) {
+			ufbxt_assert(values[j] == ref_values[j]);
+		}
+	}
+
+	free(values);
+	free(ref_values);
+	ufbx_free_cache_player(player);
+}
+
+static void ufbxt_check_cache_player(const char *path, const ufbx_thread_pool *pool)
+{
+	char buffer[512];
+	snprintf(buffer, sizeof(buffer), "%s%s", data_root, path);
+
+	ufbx_error error;
+	ufbx_geometry_cache *cache = ufbx_load_geometry_cache(buffer, NULL, &error);
+	if (!cache) ufbxt_log_error(&error);
+	ufbxt_assert(cache);
+
+	for (size_t i = 0; i < cache->channels.count; i++) {
+		const ufbx_cache_channel *channel = &cache->channels.data[i];
+		ufbxt_check_cache_player_channel(channel, pool, 0, false);
+		ufbxt_check_cache_player_channel(channel, pool, 1, false);
+		ufbxt_check_cache_player_channel(channel, pool, 3, true);
+		ufbxt_check_cache_player_channel(channel, pool, 16, false);
+	}
+
+	ufbx_free_geometry_cache(cache);
+}
+#endif
+
+UFBXT_TEST(cache_player)
+#if UFBXT_IMPL
+{
+	ufbxt_check_cache_player("max_cache_box_7500_binary_fpc/max_cache_box.pc2", NULL);
+	ufbxt_check_cache_player("caches/sine_mcmf_undersample/cache.xml", NULL);
+	ufbxt_check_cache_player("caches/sine_mxmd_oversample/cache.xml", NULL);
+}
+#endif
@@ -1244,3 +1244,61 @@ UFBXT_TEST(synthetic_unnormalized)
 	}
 }
 #endif
+
+UFBXT_TEST(modify_geometry_threaded)
+#if UFBXT_IMPL
+{
+#if defined(UFBXT_THREADS)
+	static const char *const files[] = { "max_geometry_transform_types", "blender440_shape_weight_anim", "maya_ngon_maze" };
+	for (size_t file_ix = 0; file_ix < ufbxt_arraycount(files); file_ix++) {
+		char path[512];
+		ufbxt_file_iterator iter = { files[file_ix] };
+		while (ufbxt_next_file(&iter, path, sizeof(path))) {
+			ufbx_load_opts opts = { 0 };
+			opts.target_axes = ufbx_axes_left_handed_y_up;
+			opts.target_unit_meters = 1.0f;
+			opts.space_conversion = UFBX_SPACE_CONVERSION_MODIFY_GEOMETRY;
+			opts.geometry_transform_handling = UFBX_GEOMETRY_TRANSFORM_HANDLING_MODIFY_GEOMETRY;
+
+			ufbx_scene *scene = ufbx_load_file(path, &opts, NULL);
+			ufbxt_assert(scene);
+
+			ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+			ufbx_scene *thread_scene = ufbx_load_file(path, &opts, NULL);
+			ufbxt_assert(thread_scene);
+			ufbxt_check_scene(thread_scene);
+
+			ufbxt_assert(scene->meshes.count == thread_scene->meshes.count);
+			for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+				ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+				ufbx_mesh *thread_mesh = thread_scene->meshes.data[mesh_ix];
+				ufbxt_assert(mesh->vertex_position.values.count == thread_mesh->vertex_position.values.count);
+				ufbxt_assert(mesh->vertex_normal.values.count == thread_mesh->vertex_normal.values.count);
+				ufbxt_assert(!memcmp(mesh->vertex_position.values.data, thread_mesh->vertex_position.values.data, mesh->vertex_position.values.count * sizeof(ufbx_vec3)));
+				ufbxt_assert(!memcmp(mesh->vertex_position.indices.data, thread_mesh->vertex_position.indices.data, mesh->vertex_position.indices.count * sizeof(uint32_t)));
+				ufbxt_assert(!memcmp(mesh->vertex_normal.values.data, thread_mesh->vertex_normal.values.data, mesh->vertex_normal.values.count * sizeof(ufbx_vec3)));
+			}
+
+			ufbxt_assert(scene->blend_shapes.count == thread_scene->blend_shapes.count);
+			for (size_t shape_ix = 0; shape_ix < scene->blend_shapes.count; shape_ix++) {
+				ufbx_blend_shape *shape = scene->blend_shapes.data[shape_ix];
+				ufbx_blend_shape *thread_shape = thread_scene->blend_shapes.data[shape_ix];
+				ufbxt_assert(shape->position_offsets.count == thread_shape->position_offsets.count);
+				ufbxt_assert(!memcmp(shape->position_offsets.data, thread_shape->position_offsets.data, shape->position_offsets.count * sizeof(ufbx_vec3)));
+				ufbxt_assert(!memcmp(shape->normal_offsets.data, thread_shape->normal_offsets.data, shape->normal_offsets.count * sizeof(ufbx_vec3)));
+			}
+
+			ufbxt_assert(scene->nurbs_curves.count == thread_scene->nurbs_curves.count);
+			for (size_t curve_ix = 0; curve_ix < scene->nurbs_curves.count; curve_ix++) {
+				ufbx_nurbs_curve *curve = scene->nurbs_curves.data[curve_ix];
+				ufbx_nurbs_curve *thread_curve = thread_scene->nurbs_curves.data[curve_ix];
+				ufbxt_assert(!memcmp(curve->control_points.data, thread_curve->control_points.data, curve->control_points.count * sizeof(ufbx_vec4)));
+			}
+
+			ufbx_free_scene(thread_scene);
+			ufbx_free_scene(scene);
+		}
+	}
+#endif
+}
+#endif
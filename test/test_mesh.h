@@ -1747,3 +1747,43 @@ UFBXT_FILE_TEST_FLAGS(synthetic_missing_mapping, UFBXT_FILE_TEST_FLAG_ALLOW_STRI
 	}
 }
 #endif
+
+UFBXT_TEST(mesh_faces_threaded)
+#if UFBXT_IMPL
+{
+#if defined(UFBXT_THREADS)
+	char path[512];
+	ufbxt_file_iterator iter = { "maya_ngon_maze" };
+	while (ufbxt_next_file(&iter, path, sizeof(path))) {
+		ufbx_scene *scene = ufbx_load_file(path, NULL, NULL);
+		ufbxt_assert(scene);
+
+		ufbx_load_opts opts = { 0 };
+		ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+		ufbx_scene *thread_scene = ufbx_load_file(path, &opts, NULL);
+		ufbxt_assert(thread_scene);
+		ufbxt_check_scene(thread_scene);
+
+		ufbxt_assert(scene->meshes.count == thread_scene->meshes.count);
+		for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+			ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+			ufbx_mesh *thread_mesh = thread_scene->meshes.data[mesh_ix];
+
+			ufbxt_assert(mesh->num_indices == thread_mesh->num_indices);
+			ufbxt_assert(mesh->num_faces == thread_mesh->num_faces);
+			ufbxt_assert(mesh->num_triangles == thread_mesh->num_triangles);
+			ufbxt_assert(mesh->max_face_triangles == thread_mesh->max_face_triangles);
+			ufbxt_assert(mesh->num_empty_faces == thread_mesh->num_empty_faces);
+			ufbxt_assert(mesh->num_point_faces == thread_mesh->num_point_faces);
+			ufbxt_assert(mesh->num_line_faces == thread_mesh->num_line_faces);
+			ufbxt_assert(!memcmp(mesh->faces.data, thread_mesh->faces.data, mesh->num_faces * sizeof(ufbx_face)));
+			ufbxt_assert(!memcmp(mesh->vertex_indices.data, thread_mesh->vertex_indices.data, mesh->num_indices * sizeof(uint32_t)));
+			ufbxt_assert(!memcmp(mesh->vertex_first_index.data, thread_mesh->vertex_first_index.data, mesh->num_vertices * sizeof(uint32_t)));
+		}
+
+		ufbx_free_scene(thread_scene);
+		ufbx_free_scene(scene);
+	}
+#endif
+}
+#endif
@@ -1478,6 +1478,27 @@ UFBXT_FILE_TEST(synthetic_extended_points)
 }
 #endif
 
+UFBXT_FILE_TEST_ALT(synthetic_extended_points_subdivide, synthetic_extended_points)
+#if UFBXT_IMPL
+{
+	ufbx_node *node = ufbx_find_node(scene, "Points");
+	ufbxt_assert(node && node->mesh);
+	ufbx_mesh *mesh = node->mesh;
+
+	ufbx_error error;
+	ufbx_mesh *sub_mesh = ufbx_subdivide_mesh(mesh, 1, NULL, &error);
+	if (!sub_mesh) ufbxt_log_error(&error);
+	ufbxt_assert(sub_mesh);
+
+	ufbxt_check_mesh(scene, sub_mesh);
+	ufbxt_assert(sub_mesh->num_faces == 3);
+	ufbxt_assert(sub_mesh->num_point_faces == 0);
+	ufbxt_assert(sub_mesh->max_face_triangles == 2);
+
+	ufbx_free_mesh(sub_mesh);
+}
+#endif
+
 UFBXT_FILE_TEST_FLAGS(synthetic_empty_face, UFBXT_FILE_TEST_FLAG_ALLOW_WARNINGS)
 #if UFBXT_IMPL
 {
@@ -653,6 +653,202 @@ UFBXT_FILE_TEST(maya_dq_weights)
 }
 #endif
 
+UFBXT_FILE_TEST_ALT(skin_vertices_batched, maya_dq_weights)
+#if UFBXT_IMPL
+{
+	ufbx_scene *state = ufbx_evaluate_scene(scene, scene->anim, 10.0/24.0, NULL, NULL);
+	ufbxt_assert(state);
+
+	size_t num_skinned = 0;
+	for (size_t mesh_ix = 0; mesh_ix < state->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = state->meshes.data[mesh_ix];
+		if (mesh->skin_deformers.count == 0) continue;
+		ufbx_skin_deformer *skin = mesh->skin_deformers.data[0];
+		size_t num_vertices = mesh->num_vertices < skin->vertices.count ? mesh->num_vertices : skin->vertices.count;
+
+		ufbx_vec3 *positions = (ufbx_vec3*)calloc(num_vertices, sizeof(ufbx_vec3));
+		ufbx_vec3 *normals = (ufbx_vec3*)calloc(num_vertices, sizeof(ufbx_vec3));
+		ufbxt_assert(positions && normals);
+
+		ufbx_vec3 up = { 0.0f, 1.0f, 0.0f };
+		for (size_t i = 0; i < num_vertices; i++) {
+			positions[i] = mesh->vertices.data[i];
+			normals[i] = up;
+		}
+
+		ufbx_error error;
+		bool ok = ufbx_skin_vertices(skin, positions, positions, normals, normals, num_vertices, NULL, &error);
+		ufbxt_assert(ok);
+
+		for (size_t i = 0; i < num_vertices; i++) {
+			ufbx_matrix mat = ufbx_get_skin_vertex_matrix(skin, i, NULL);
+			ufbx_matrix normal_mat = ufbx_matrix_for_normals(&mat);
+			ufbx_vec3 ref_pos = ufbx_transform_position(&mat, mesh->vertices.data[i]);
+			ufbx_vec3 ref_normal = ufbx_vec3_normalize(ufbx_transform_direction(&normal_mat, up));
+			ufbxt_assert_close_vec3(err, positions[i], ref_pos);
+			ufbxt_assert_close_vec3(err, normals[i], ref_normal);
+		}
+
+		// Skin a sub-range of vertices
+		if (num_vertices >= 2) {
+			ufbx_skin_vertices_opts opts = { 0 };
+			opts.vertex_offset = 1;
+			ok = ufbx_skin_vertices(skin, mesh->vertices.data + 1, positions, NULL, NULL, 1, &opts, &error);
+			ufbxt_assert(ok);
+
+			ufbx_matrix mat = ufbx_get_skin_vertex_matrix(skin, 1, NULL);
+			ufbxt_assert_close_vec3(err, positions[0], ufbx_transform_position(&mat, mesh->vertices.data[1]));
+		}
+
+		// Out of bounds
+		ok = ufbx_skin_vertices(skin, positions, positions, NULL, NULL, skin->vertices.count + 1, NULL, &error);
+		ufbxt_assert(!ok);
+		ufbxt_assert(error.type == UFBX_ERROR_BAD_INDEX);
+
+		free(positions);
+		free(normals);
+		num_skinned++;
+	}
+	ufbxt_assert(num_skinned > 0);
+
+	ufbx_free_scene(state);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(evaluate_skinning_threaded, maya_dq_weights)
+#if UFBXT_IMPL
+{
+#if defined(UFBXT_THREADS)
+	ufbx_evaluate_opts opts = { 0 };
+	opts.evaluate_skinning = true;
+
+	ufbx_scene *state = ufbx_evaluate_scene(scene, scene->anim, 10.0/24.0, &opts, NULL);
+	ufbxt_assert(state);
+
+	ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+	ufbx_scene *thread_state = ufbx_evaluate_scene(scene, scene->anim, 10.0/24.0, &opts, NULL);
+	ufbxt_assert(thread_state);
+
+	ufbxt_assert(state->meshes.count == thread_state->meshes.count);
+	for (size_t mesh_ix = 0; mesh_ix < state->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = state->meshes.data[mesh_ix];
+		ufbx_mesh *thread_mesh = thread_state->meshes.data[mesh_ix];
+
+		ufbxt_assert(mesh->skinned_position.values.count == thread_mesh->skinned_position.values.count);
+		ufbxt_assert(mesh->skinned_normal.values.count == thread_mesh->skinned_normal.values.count);
+		ufbxt_assert(mesh->skinned_normal.indices.count == thread_mesh->skinned_normal.indices.count);
+		ufbxt_assert(!memcmp(mesh->skinned_position.values.data, thread_mesh->skinned_position.values.data, mesh->skinned_position.values.count * sizeof(ufbx_vec3)));
+		ufbxt_assert(!memcmp(mesh->skinned_normal.values.data, thread_mesh->skinned_normal.values.data, mesh->skinned_normal.values.count * sizeof(ufbx_vec3)));
+		ufbxt_assert(!memcmp(mesh->skinned_normal.indices.data, thread_mesh->skinned_normal.indices.data, mesh->skinned_normal.indices.count * sizeof(uint32_t)));
+	}
+
+	ufbx_free_scene(thread_state);
+	ufbx_free_scene(state);
+#endif
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(evaluate_scene_update, maya_dq_weights)
+#if UFBXT_IMPL
+{
+	ufbx_evaluate_opts opts = { 0 };
+	opts.evaluate_skinning = true;
+
+	ufbx_scene *state = ufbx_evaluate_scene(scene, scene->anim, 0.0, &opts, NULL);
+	ufbxt_assert(state);
+
+	for (int frame = 0; frame <= 20; frame += 5) {
+		double time = (double)frame / 24.0;
+
+		// Skinned vertices should not be left over when skipping skinning
+		opts.evaluate_skinning = frame != 10;
+
+		ufbx_error error;
+		bool ok = ufbx_evaluate_scene_update(state, NULL, time, &opts, &error);
+		if (!ok) ufbxt_log_error(&error);
+		ufbxt_assert(ok);
+
+		ufbx_scene *ref = ufbx_evaluate_scene(scene, scene->anim, time, &opts, NULL);
+		ufbxt_assert(ref);
+
+		ufbxt_assert(state->nodes.count == ref->nodes.count);
+		for (size_t node_ix = 0; node_ix < state->nodes.count; node_ix++) {
+			ufbx_node *node = state->nodes.data[node_ix];
+			ufbx_node *ref_node = ref->nodes.data[node_ix];
+			ufbxt_assert(!memcmp(&node->node_to_world, &ref_node->node_to_world, sizeof(ufbx_matrix)));
+		}
+
+		ufbxt_assert(state->meshes.count == ref->meshes.count);
+		for (size_t mesh_ix = 0; mesh_ix < state->meshes.count; mesh_ix++) {
+			ufbx_mesh *mesh = state->meshes.data[mesh_ix];
+			ufbx_mesh *ref_mesh = ref->meshes.data[mesh_ix];
+
+			ufbxt_assert(mesh->skinned_is_local == ref_mesh->skinned_is_local);
+			ufbxt_assert(mesh->skinned_position.values.count == ref_mesh->skinned_position.values.count);
+			ufbxt_assert(mesh->skinned_normal.values.count == ref_mesh->skinned_normal.values.count);
+			ufbxt_assert(!memcmp(mesh->skinned_position.values.data, ref_mesh->skinned_position.values.data, mesh->skinned_position.values.count * sizeof(ufbx_vec3)));
+			ufbxt_assert(!memcmp(mesh->skinned_normal.values.data, ref_mesh->skinned_normal.values.data, mesh->skinned_normal.values.count * sizeof(ufbx_vec3)));
+			if (!opts.evaluate_skinning) {
+				ufbxt_assert(mesh->skinned_position.values.data == ref_mesh->skinned_position.values.data);
+			}
+		}
+
+		ufbx_free_scene(ref);
+	}
+
+	// Updating a scene that has not been evaluated should fail
+	ufbx_error error;
+	ufbxt_assert(!ufbx_evaluate_scene_update(scene, NULL, 0.0, NULL, &error));
+	ufbxt_assert(error.type != UFBX_ERROR_NONE);
+
+	ufbx_free_scene(state);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(evaluate_scene_update_overrides, maya_dq_weights)
+#if UFBXT_IMPL
+{
+	ufbx_scene *state = ufbx_evaluate_scene(scene, NULL, 0.0, NULL, NULL);
+	ufbxt_assert(state);
+
+	for (int i = 0; i < 6; i++) {
+		ufbxt_hintf("i=%d", i);
+
+		// A new animation is created for every update so it may reuse the address of the previous one
+		ufbx_prop_override_desc over = { scene->root_node->element_id };
+		over.prop_name.data = "ufbxt_override";
+		over.prop_name.length = strlen(over.prop_name.data);
+		over.value.x = (ufbx_real)i;
+
+		bool has_override = i % 3 != 2;
+		ufbx_anim_opts anim_opts = { 0 };
+		anim_opts.prop_overrides.data = &over;
+		anim_opts.prop_overrides.count = has_override ? 1 : 0;
+
+		ufbx_error error;
+		ufbx_anim *anim = ufbx_create_anim(scene, &anim_opts, &error);
+		if (!anim) ufbxt_log_error(&error);
+		ufbxt_assert(anim);
+
+		bool ok = ufbx_evaluate_scene_update(state, anim, 0.0, NULL, &error);
+		if (!ok) ufbxt_log_error(&error);
+		ufbxt_assert(ok);
+
+		ufbx_prop *prop = ufbx_find_prop(&state->root_node->props, "ufbxt_override");
+		if (has_override) {
+			ufbxt_assert(prop);
+			ufbxt_assert(prop->value_real == (ufbx_real)i);
+		} else {
+			ufbxt_assert(!prop);
+		}
+
+		ufbx_free_anim(anim);
+	}
+
+	ufbx_free_scene(state);
+}
+#endif
+
 UFBXT_FILE_TEST(maya_bone_radius)
 #if UFBXT_IMPL
 {
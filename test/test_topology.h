@@ -136,6 +136,119 @@ UFBXT_FILE_TEST_ALT(subsurf_alloc_fail, maya_subsurf_cube)
 }
 #endif
 
+UFBXT_FILE_TEST_ALT(subsurf_stencils, blender_293_suzanne_subsurf)
+#if UFBXT_IMPL
+{
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		size_t num_source = mesh->num_vertices;
+
+		ufbx_vec3 *deformed = (ufbx_vec3*)calloc(num_source, sizeof(ufbx_vec3));
+		ufbxt_assert(deformed);
+		for (size_t i = 0; i < num_source; i++) {
+			deformed[i] = ufbxt_mul3(mesh->vertices.data[i], 2.0f);
+		}
+
+		for (size_t level = 0; level <= 2; level++) {
+			ufbxt_hintf("level=%zu", level);
+
+			ufbx_error error;
+			ufbx_subdivision_stencils *stencils = ufbx_create_subdivision_stencils(mesh, level, NULL, &error);
+			if (!stencils) ufbxt_log_error(&error);
+			ufbxt_assert(stencils);
+
+			ufbx_mesh *sub_mesh = ufbx_subdivide_mesh(mesh, level, NULL, &error);
+			ufbxt_assert(sub_mesh);
+
+			size_t num_vertices = sub_mesh->num_vertices;
+			ufbxt_assert(stencils->num_source_vertices == num_source);
+			ufbxt_assert(stencils->num_vertices == num_vertices);
+			ufbxt_assert(stencils->offsets.count == num_vertices + 1);
+			ufbxt_assert(stencils->offsets.data[num_vertices] == stencils->indices.count);
+			ufbxt_assert(stencils->indices.count == stencils->weights.count);
+			ufbxt_assert(stencils->vertex_indices.count == sub_mesh->vertex_indices.count);
+			ufbxt_assert(!memcmp(stencils->vertex_indices.data, sub_mesh->vertex_indices.data, sub_mesh->vertex_indices.count * sizeof(uint32_t)));
+
+			ufbx_vec3 *positions = (ufbx_vec3*)calloc(num_vertices, sizeof(ufbx_vec3));
+			ufbx_vec3 *scaled = (ufbx_vec3*)calloc(num_vertices, sizeof(ufbx_vec3));
+			ufbx_vec3 *ranged = (ufbx_vec3*)calloc(num_vertices, sizeof(ufbx_vec3));
+			ufbxt_assert(positions && scaled && ranged);
+
+			ufbx_apply_subdivision_stencils(stencils, mesh->vertices.data, positions);
+			ufbx_apply_subdivision_stencils(stencils, deformed, scaled);
+
+			// Stencils can be applied in independent ranges eg. from multiple threads
+			for (size_t begin = 0; begin < num_vertices; begin += 7) {
+				size_t count = num_vertices - begin < 7 ? num_vertices - begin : 7;
+				ufbx_apply_subdivision_stencils_range(stencils, deformed, ranged, begin, count);
+			}
+			ufbxt_assert(!memcmp(scaled, ranged, num_vertices * sizeof(ufbx_vec3)));
+
+			ufbxt_diff_error err = { 0 };
+			for (size_t i = 0; i < num_vertices; i++) {
+				ufbxt_assert_close_vec3(&err, positions[i], sub_mesh->vertices.data[i]);
+
+				// Scaling by two is exact so the result should match exactly
+				ufbx_vec3 ref = ufbxt_mul3(positions[i], 2.0f);
+				ufbxt_assert(!memcmp(&ref, &scaled[i], sizeof(ufbx_vec3)));
+			}
+			ufbxt_logf(".. Absolute diff: avg %.3g, max %.3g (%zu tests)", err.sum / (ufbx_real)err.num, err.max, err.num);
+
+			free(ranged);
+			free(scaled);
+			free(positions);
+			ufbx_free_mesh(sub_mesh);
+			ufbx_free_subdivision_stencils(stencils);
+		}
+
+		free(deformed);
+	}
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(subsurf_stencils_alloc_fail, maya_subsurf_cube)
+#if UFBXT_IMPL
+{
+	ufbx_node *node = ufbx_find_node(scene, "pCube1");
+	ufbxt_assert(node && node->mesh);
+	ufbx_mesh *mesh = node->mesh;
+
+	for (size_t max_temp = 1; max_temp < 10000; max_temp++) {
+		ufbx_subdivision_stencils_opts opts = { 0 };
+		opts.temp_allocator.huge_threshold = 1;
+		opts.temp_allocator.allocation_limit = max_temp;
+
+		ufbxt_hintf("Temp limit: %zu", max_temp);
+
+		ufbx_error error;
+		ufbx_subdivision_stencils *stencils = ufbx_create_subdivision_stencils(mesh, 2, &opts, &error);
+		if (stencils) {
+			ufbxt_logf(".. Tested up to %zu temporary allocations", max_temp);
+			ufbx_free_subdivision_stencils(stencils);
+			break;
+		}
+		ufbxt_assert(error.type == UFBX_ERROR_ALLOCATION_LIMIT);
+	}
+
+	for (size_t max_result = 1; max_result < 10000; max_result++) {
+		ufbx_subdivision_stencils_opts opts = { 0 };
+		opts.result_allocator.huge_threshold = 1;
+		opts.result_allocator.allocation_limit = max_result;
+
+		ufbxt_hintf("Result limit: %zu", max_result);
+
+		ufbx_error error;
+		ufbx_subdivision_stencils *stencils = ufbx_create_subdivision_stencils(mesh, 2, &opts, &error);
+		if (stencils) {
+			ufbxt_logf(".. Tested up to %zu result allocations", max_result);
+			ufbx_free_subdivision_stencils(stencils);
+			break;
+		}
+		ufbxt_assert(error.type == UFBX_ERROR_ALLOCATION_LIMIT);
+	}
+}
+#endif
+
 #if UFBXT_IMPL
 typedef struct {
 	const char *node_name;
@@ -813,3 +926,255 @@ UFBXT_FILE_TEST_ALT(subsurf_interpolate_ignore, maya_cube)
 }
 #endif
 
+
+#if UFBXT_IMPL
+static ufbx_load_opts ufbxt_retain_topology_opts()
+{
+	ufbx_load_opts opts = { 0 };
+	opts.retain_topology = true;
+	opts.generate_missing_normals = true;
+	opts.evaluate_skinning = true;
+	return opts;
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_check_retained_topology(ufbx_mesh *mesh)
+{
+	ufbx_mesh_topology *topology = mesh->topology;
+	ufbxt_assert(topology);
+	ufbxt_assert(topology->edges.count == mesh->num_indices);
+	ufbxt_assert(topology->normal_indices.count == mesh->num_indices);
+
+	ufbx_topo_edge *topo = calloc(mesh->num_indices + 1, sizeof(ufbx_topo_edge));
+	uint32_t *normal_indices = calloc(mesh->num_indices + 1, sizeof(uint32_t));
+	ufbxt_assert(topo && normal_indices);
+
+	ufbx_compute_topology(mesh, topo, mesh->num_indices);
+	size_t num_normals = ufbx_generate_normal_mapping(mesh, topo, mesh->num_indices, normal_indices, mesh->num_indices, false);
+
+	ufbxt_assert(!memcmp(topo, topology->edges.data, mesh->num_indices * sizeof(ufbx_topo_edge)));
+	ufbxt_assert(!memcmp(normal_indices, topology->normal_indices.data, mesh->num_indices * sizeof(uint32_t)));
+	ufbxt_assert(num_normals == topology->num_normals);
+
+	free(normal_indices);
+	free(topo);
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(retain_topology, maya_dq_weights, ufbxt_retain_topology_opts)
+#if UFBXT_IMPL
+{
+	ufbxt_assert(scene->meshes.count > 0);
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		ufbxt_check_retained_topology(mesh);
+
+		// Subdividing should match the result without the retained topology
+		ufbx_mesh copy = *mesh;
+		copy.topology = NULL;
+
+		ufbx_mesh *sub_mesh = ufbx_subdivide_mesh(mesh, 1, NULL, NULL);
+		ufbx_mesh *ref_mesh = ufbx_subdivide_mesh(&copy, 1, NULL, NULL);
+		ufbxt_assert(sub_mesh && ref_mesh);
+		ufbxt_assert(!sub_mesh->topology);
+
+		ufbxt_assert(sub_mesh->num_vertices == ref_mesh->num_vertices);
+		ufbxt_assert(sub_mesh->num_indices == ref_mesh->num_indices);
+		ufbxt_assert(!memcmp(sub_mesh->vertices.data, ref_mesh->vertices.data, sub_mesh->num_vertices * sizeof(ufbx_vec3)));
+		ufbxt_assert(!memcmp(sub_mesh->vertex_indices.data, ref_mesh->vertex_indices.data, sub_mesh->num_indices * sizeof(uint32_t)));
+
+		ufbx_free_mesh(ref_mesh);
+		ufbx_free_mesh(sub_mesh);
+	}
+
+	// Skinned normals should use the retained mapping
+	ufbx_evaluate_opts eval_opts = { 0 };
+	eval_opts.evaluate_skinning = true;
+	ufbx_scene *state = ufbx_evaluate_scene(scene, NULL, 10.0/24.0, &eval_opts, NULL);
+	ufbxt_assert(state);
+
+	for (size_t mesh_ix = 0; mesh_ix < state->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = state->meshes.data[mesh_ix];
+		if (mesh->skin_deformers.count == 0) continue;
+		ufbxt_assert(mesh->skinned_normal.indices.data == mesh->topology->normal_indices.data);
+		ufbxt_assert(mesh->skinned_normal.values.count == mesh->topology->num_normals);
+	}
+
+	ufbx_free_scene(state);
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(retain_topology_generated_normals, synthetic_missing_normals, ufbxt_retain_topology_opts)
+#if UFBXT_IMPL
+{
+	ufbx_node *node = ufbx_find_node(scene, "pCube1");
+	ufbxt_assert(node && node->mesh);
+	ufbx_mesh *mesh = node->mesh;
+	ufbxt_assert(mesh->generated_normals);
+	ufbxt_check_retained_topology(mesh);
+
+	// Generated normals should share the retained normal mapping
+	ufbxt_assert(mesh->topology->normal_indices.data == mesh->vertex_normal.indices.data);
+}
+#endif
+
+#if UFBXT_IMPL
+static ufbx_load_opts ufbxt_retain_topology_reverse_winding_opts()
+{
+	ufbx_load_opts opts = ufbxt_retain_topology_opts();
+	opts.reverse_winding = true;
+	return opts;
+}
+#endif
+
+UFBXT_FILE_TEST_OPTS_ALT(retain_topology_generated_normals_reversed, synthetic_missing_normals, ufbxt_retain_topology_reverse_winding_opts)
+#if UFBXT_IMPL
+{
+	ufbx_node *node = ufbx_find_node(scene, "pCube1");
+	ufbxt_assert(node && node->mesh);
+	ufbx_mesh *mesh = node->mesh;
+	ufbxt_assert(mesh->generated_normals);
+	ufbxt_assert(mesh->reversed_winding);
+	ufbxt_check_retained_topology(mesh);
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_assert_same_attrib(const ufbx_vertex_attrib *a, const ufbx_vertex_attrib *b)
+{
+	ufbxt_assert(a->exists == b->exists);
+	if (!a->exists) return;
+	ufbxt_assert(a->unique_per_vertex == b->unique_per_vertex);
+	ufbxt_assert(a->values.count == b->values.count);
+	ufbxt_assert(a->indices.count == b->indices.count);
+	ufbxt_assert(!memcmp(a->values.data, b->values.data, a->values.count * a->value_reals * sizeof(ufbx_real)));
+	ufbxt_assert(!memcmp(a->indices.data, b->indices.data, a->indices.count * sizeof(uint32_t)));
+}
+#endif
+
+UFBXT_TEST(subsurf_threaded)
+#if UFBXT_IMPL
+{
+#if defined(UFBXT_THREADS)
+	static const char *const files[] = {
+		"blender_293_suzanne_subsurf_uv",
+		"blender_293_ngon_subsurf",
+		"blender_293x_nonmanifold_subsurf",
+		"blender_293x_subsurf_boundary",
+		"blender_312x_vertex_crease",
+		"maya_subsurf_3x_cube_crease",
+	};
+
+	for (size_t file_ix = 0; file_ix < ufbxt_arraycount(files); file_ix++) {
+		char path[512];
+		ufbxt_file_iterator iter = { files[file_ix] };
+		while (ufbxt_next_file(&iter, path, sizeof(path))) {
+			ufbx_scene *scene = ufbx_load_file(path, NULL, NULL);
+			ufbxt_assert(scene);
+
+			for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+				ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+				for (size_t level = 1; level <= 2; level++) {
+					for (int interpolate = 0; interpolate <= 1; interpolate++) {
+						ufbxt_hintf("mesh=%zu level=%zu interpolate=%d", mesh_ix, level, interpolate);
+
+						ufbx_subdivide_opts opts = { 0 };
+						opts.interpolate_normals = interpolate != 0;
+						opts.interpolate_tangents = interpolate != 0;
+						opts.boundary = interpolate ? UFBX_SUBDIVISION_BOUNDARY_SHARP_BOUNDARY : UFBX_SUBDIVISION_BOUNDARY_DEFAULT;
+
+						ufbx_mesh *sub_mesh = ufbx_subdivide_mesh(mesh, level, &opts, NULL);
+						ufbxt_assert(sub_mesh);
+
+						ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+						ufbx_mesh *thread_mesh = ufbx_subdivide_mesh(mesh, level, &opts, NULL);
+						ufbxt_assert(thread_mesh);
+
+						ufbxt_assert(sub_mesh->num_vertices == thread_mesh->num_vertices);
+						ufbxt_assert(sub_mesh->num_indices == thread_mesh->num_indices);
+						ufbxt_assert(sub_mesh->num_faces == thread_mesh->num_faces);
+						ufbxt_assert(!memcmp(sub_mesh->vertex_indices.data, thread_mesh->vertex_indices.data, sub_mesh->num_indices * sizeof(uint32_t)));
+						ufbxt_assert_same_attrib((const ufbx_vertex_attrib*)&sub_mesh->vertex_position, (const ufbx_vertex_attrib*)&thread_mesh->vertex_position);
+						ufbxt_assert_same_attrib((const ufbx_vertex_attrib*)&sub_mesh->vertex_normal, (const ufbx_vertex_attrib*)&thread_mesh->vertex_normal);
+						ufbxt_assert_same_attrib((const ufbx_vertex_attrib*)&sub_mesh->vertex_crease, (const ufbx_vertex_attrib*)&thread_mesh->vertex_crease);
+
+						ufbxt_assert(sub_mesh->uv_sets.count == thread_mesh->uv_sets.count);
+						for (size_t set_ix = 0; set_ix < sub_mesh->uv_sets.count; set_ix++) {
+							ufbx_uv_set *set = &sub_mesh->uv_sets.data[set_ix];
+							ufbx_uv_set *thread_set = &thread_mesh->uv_sets.data[set_ix];
+							ufbxt_assert_same_attrib((const ufbx_vertex_attrib*)&set->vertex_uv, (const ufbx_vertex_attrib*)&thread_set->vertex_uv);
+							ufbxt_assert_same_attrib((const ufbx_vertex_attrib*)&set->vertex_tangent, (const ufbx_vertex_attrib*)&thread_set->vertex_tangent);
+						}
+
+						ufbx_free_mesh(thread_mesh);
+						ufbx_free_mesh(sub_mesh);
+					}
+				}
+			}
+
+			ufbx_free_scene(scene);
+		}
+	}
+#endif
+}
+#endif
+
+UFBXT_TEST(generate_indices_threaded)
+#if UFBXT_IMPL
+{
+	size_t num_indices = 200000;
+	ufbx_vec3 *positions[2];
+	uint16_t *ids[2];
+	uint32_t *indices[2];
+	for (size_t k = 0; k < 2; k++) {
+		positions[k] = (ufbx_vec3*)calloc(num_indices, sizeof(ufbx_vec3));
+		ids[k] = (uint16_t*)calloc(num_indices, sizeof(uint16_t));
+		indices[k] = (uint32_t*)calloc(num_indices, sizeof(uint32_t));
+		ufbxt_assert(positions[k] && ids[k] && indices[k]);
+	}
+
+	for (size_t i = 0; i < num_indices; i++) {
+		uint32_t v = (uint32_t)(i * 7919u) % 5003u;
+		positions[0][i].x = (ufbx_real)(v % 17);
+		positions[0][i].y = (ufbx_real)(v % 13);
+		positions[0][i].z = (ufbx_real)(v / 289);
+		ids[0][i] = (uint16_t)(i % 7);
+	}
+	memcpy(positions[1], positions[0], num_indices * sizeof(ufbx_vec3));
+	memcpy(ids[1], ids[0], num_indices * sizeof(uint16_t));
+
+	size_t num_vertices[2];
+	for (size_t k = 0; k < 2; k++) {
+		ufbx_vertex_stream streams[2] = {
+			{ positions[k], num_indices, sizeof(ufbx_vec3) },
+			{ ids[k], num_indices, sizeof(uint16_t) },
+		};
+
+		ufbx_error error;
+		if (k == 0) {
+			num_vertices[k] = ufbx_generate_indices(streams, 2, indices[k], num_indices, NULL, &error);
+		} else {
+			ufbx_generate_indices_opts opts = { 0 };
+#if defined(UFBXT_THREADS)
+			ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+#endif
+			num_vertices[k] = ufbx_generate_indices_threaded(streams, 2, indices[k], num_indices, &opts, &error);
+		}
+		if (error.type != UFBX_ERROR_NONE) ufbxt_log_error(&error);
+		ufbxt_assert(error.type == UFBX_ERROR_NONE);
+	}
+
+	ufbxt_assert(num_vertices[0] == num_vertices[1]);
+	ufbxt_assert(num_vertices[0] > 0 && num_vertices[0] < num_indices);
+	ufbxt_assert(!memcmp(indices[0], indices[1], num_indices * sizeof(uint32_t)));
+	ufbxt_assert(!memcmp(positions[0], positions[1], num_vertices[0] * sizeof(ufbx_vec3)));
+	ufbxt_assert(!memcmp(ids[0], ids[1], num_vertices[0] * sizeof(uint16_t)));
+
+	for (size_t k = 0; k < 2; k++) {
+		free(positions[k]);
+		free(ids[k]);
+		free(indices[k]);
+	}
+}
+#endif
@@ -370,3 +370,190 @@ UFBXT_FILE_TEST(maya_ngon_l)
 	}
 }
 #endif
+
+#if UFBXT_IMPL
+typedef struct {
+	float position[3];
+	int16_t normal[4];
+	uint16_t uv[2];
+	uint8_t bones[4];
+	uint8_t weights[4];
+} ufbxt_packed_vertex;
+
+static ufbx_real ufbxt_f16_to_real(uint16_t h)
+{
+	int exponent = (h >> 10) & 0x1f;
+	ufbx_real mantissa = (ufbx_real)(h & 0x3ff);
+	ufbx_real value = exponent == 0 ? ldexp(mantissa, -24) : ldexp(mantissa + 1024.0f, exponent - 25);
+	return (h & 0x8000) ? -value : value;
+}
+
+static bool ufbxt_f16_is_nearest(uint16_t h, ufbx_real v)
+{
+	// Only check finite non-zero values with finite neighbors
+	uint16_t mag = h & 0x7fff;
+	if (mag == 0 || mag >= 0x7bff) return true;
+	ufbx_real d = fabs(v - ufbxt_f16_to_real(h));
+	return d <= fabs(v - ufbxt_f16_to_real((uint16_t)(h - 1))) && d <= fabs(v - ufbxt_f16_to_real((uint16_t)(h + 1)));
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(build_vertex_buffer, maya_dq_weights)
+#if UFBXT_IMPL
+{
+	ufbx_vertex_element elements[] = {
+		{ UFBX_VERTEX_ATTRIBUTE_POSITION, UFBX_VERTEX_FORMAT_F32, 0, 0, offsetof(ufbxt_packed_vertex, position) },
+		{ UFBX_VERTEX_ATTRIBUTE_NORMAL, UFBX_VERTEX_FORMAT_SNORM16, 0, 0, offsetof(ufbxt_packed_vertex, normal) },
+		{ UFBX_VERTEX_ATTRIBUTE_UV, UFBX_VERTEX_FORMAT_F16, 0, 0, offsetof(ufbxt_packed_vertex, uv) },
+		{ UFBX_VERTEX_ATTRIBUTE_SKIN_INDICES, UFBX_VERTEX_FORMAT_U8, 0, 0, offsetof(ufbxt_packed_vertex, bones) },
+		{ UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS, UFBX_VERTEX_FORMAT_UNORM8, 0, 0, offsetof(ufbxt_packed_vertex, weights) },
+	};
+	ufbx_vertex_layout layout = { elements, ufbxt_arraycount(elements), sizeof(ufbxt_packed_vertex) };
+
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		size_t max_indices = mesh->num_triangles * 3;
+
+		ufbx_vertex_buffer dst = { 0 };
+		dst.vertices = calloc(max_indices, sizeof(ufbxt_packed_vertex));
+		dst.vertex_capacity = max_indices;
+		dst.indices = (uint32_t*)calloc(max_indices, sizeof(uint32_t));
+		dst.index_capacity = max_indices;
+		ufbxt_assert(dst.vertices && dst.indices);
+
+		ufbx_error error;
+		bool ok = ufbx_build_vertex_buffer(mesh, NULL, &layout, &dst, NULL, &error);
+		if (!ok) ufbxt_log_error(&error);
+		ufbxt_assert(ok);
+		ufbxt_assert(dst.num_indices == max_indices);
+		ufbxt_assert(dst.num_vertices > 0 && dst.num_vertices < dst.num_indices);
+
+		const ufbxt_packed_vertex *vertices = (const ufbxt_packed_vertex*)dst.vertices;
+
+		// Vertices should be unique
+		for (size_t i = 0; i < dst.num_vertices; i++) {
+			for (size_t j = 0; j < i; j++) {
+				ufbxt_assert(memcmp(&vertices[i], &vertices[j], sizeof(ufbxt_packed_vertex)) != 0);
+			}
+		}
+
+		uint32_t tri_indices[64];
+		size_t dst_ix = 0;
+		ufbx_skin_deformer *skin = mesh->skin_deformers.count > 0 ? mesh->skin_deformers.data[0] : NULL;
+		for (size_t face_ix = 0; face_ix < mesh->num_faces; face_ix++) {
+			uint32_t num_tris = ufbx_triangulate_face(tri_indices, ufbxt_arraycount(tri_indices), mesh, mesh->faces.data[face_ix]);
+			for (size_t i = 0; i < num_tris * 3; i++) {
+				uint32_t ix = tri_indices[i];
+				ufbxt_assert(dst.indices[dst_ix] < dst.num_vertices);
+				const ufbxt_packed_vertex *v = &vertices[dst.indices[dst_ix++]];
+
+				ufbx_vec3 pos = ufbx_get_vertex_vec3(&mesh->vertex_position, ix);
+				ufbxt_assert(v->position[0] == (float)pos.x && v->position[1] == (float)pos.y && v->position[2] == (float)pos.z);
+
+				ufbx_vec3 normal = ufbx_get_vertex_vec3(&mesh->vertex_normal, ix);
+				ufbxt_assert_close_real(err, (ufbx_real)v->normal[0] / 32767.0f, normal.x);
+				ufbxt_assert_close_real(err, (ufbx_real)v->normal[1] / 32767.0f, normal.y);
+				ufbxt_assert_close_real(err, (ufbx_real)v->normal[2] / 32767.0f, normal.z);
+				ufbxt_assert(v->normal[3] == 0);
+
+				if (mesh->vertex_uv.exists) {
+					ufbx_vec2 uv = ufbx_get_vertex_vec2(&mesh->vertex_uv, ix);
+					ufbxt_assert(fabs(ufbxt_f16_to_real(v->uv[0]) - uv.x) <= 0.001f);
+					ufbxt_assert(fabs(ufbxt_f16_to_real(v->uv[1]) - uv.y) <= 0.001f);
+					ufbxt_assert(ufbxt_f16_is_nearest(v->uv[0], uv.x));
+					ufbxt_assert(ufbxt_f16_is_nearest(v->uv[1], uv.y));
+				}
+
+				if (skin) {
+					ufbx_skin_vertex skin_vertex = skin->vertices.data[mesh->vertex_indices.data[ix]];
+					ufbxt_assert(skin_vertex.num_weights > 0);
+					ufbx_skin_weight weight = skin->weights.data[skin_vertex.weight_begin];
+					ufbxt_assert(v->bones[0] == weight.cluster_index);
+					uint32_t weight_sum = 0;
+					for (size_t k = 0; k < 4; k++) weight_sum += v->weights[k];
+					ufbxt_assert(weight_sum >= 253 && weight_sum <= 257);
+				}
+			}
+		}
+		ufbxt_assert(dst_ix == dst.num_indices);
+
+		// Too small buffers should fail
+		dst.vertex_capacity = dst.num_vertices - 1;
+		ufbxt_assert(!ufbx_build_vertex_buffer(mesh, NULL, &layout, &dst, NULL, &error));
+		ufbxt_assert(error.type != UFBX_ERROR_NONE);
+
+		free(dst.vertices);
+		free(dst.indices);
+	}
+}
+#endif
+
+#if UFBXT_IMPL
+static void ufbxt_check_triangulate_mesh(ufbx_scene *scene)
+{
+	for (size_t mesh_ix = 0; mesh_ix < scene->meshes.count; mesh_ix++) {
+		ufbx_mesh *mesh = scene->meshes.data[mesh_ix];
+		size_t num_indices = mesh->num_triangles * 3;
+
+		uint32_t *ref_indices = (uint32_t*)calloc(num_indices + 1, sizeof(uint32_t));
+		uint32_t *indices = (uint32_t*)calloc(num_indices + 1, sizeof(uint32_t));
+		ufbxt_assert(ref_indices && indices);
+
+		size_t ref_tris = 0;
+		for (size_t fi = 0; fi < mesh->num_faces; fi++) {
+			ufbx_face face = mesh->faces.data[fi];
+			ref_tris += ufbx_triangulate_face(ref_indices + ref_tris * 3, num_indices - ref_tris * 3, mesh, face);
+		}
+		ufbxt_assert(ref_tris == mesh->num_triangles);
+
+		for (int threaded = 0; threaded <= 1; threaded++) {
+			ufbx_triangulate_opts opts = { 0 };
+#if defined(UFBXT_THREADS)
+			if (threaded) {
+				ufbx_os_init_ufbx_thread_pool(&opts.thread_opts.pool, g_thread_pool);
+			}
+#endif
+
+			ufbx_error error;
+			memset(indices, 0, (num_indices + 1) * sizeof(uint32_t));
+			size_t num_tris = ufbx_triangulate_mesh(mesh, indices, num_indices, &opts, &error);
+			if (error.type != UFBX_ERROR_NONE) ufbxt_log_error(&error);
+			ufbxt_assert(error.type == UFBX_ERROR_NONE);
+			ufbxt_assert(num_tris == mesh->num_triangles);
+			ufbxt_assert(!memcmp(indices, ref_indices, num_indices * sizeof(uint32_t)));
+			ufbxt_assert(indices[num_indices] == 0);
+
+			// Too small buffers should fail
+			if (num_indices > 0) {
+				num_tris = ufbx_triangulate_mesh(mesh, indices, num_indices - 1, &opts, &error);
+				ufbxt_assert(num_tris == 0);
+				ufbxt_assert(error.type != UFBX_ERROR_NONE);
+			}
+		}
+
+		free(ref_indices);
+		free(indices);
+	}
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(triangulate_mesh_ngon, maya_ngon_maze)
+#if UFBXT_IMPL
+{
+	ufbxt_check_triangulate_mesh(scene);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(triangulate_mesh_quads, maya_subsurf_cube)
+#if UFBXT_IMPL
+{
+	ufbxt_check_triangulate_mesh(scene);
+}
+#endif
+
+UFBXT_FILE_TEST_ALT(triangulate_mesh_triangles, maya_triangulate_triangulated)
+#if UFBXT_IMPL
+{
+	ufbxt_check_triangulate_mesh(scene);
+}
+#endif
@@ -16,11 +16,15 @@
 //   UFBX_USE_UNALIGNED_LOADS  Forcibly use unaligned loads on unknown platforms
 //   UFBX_USE_SSE              Explicitly enable SSE2 support (for x86)
 //   UFBX_HAS_FTELLO           Allow ufbx to use `ftello()` to measure file size
+//   UFBX_NO_MMAP              Do not use `mmap()` for `ufbx_load_opts.use_memory_map`
 //   UFBX_WASM_32BIT           Optimize WASM for 32-bit architectures
 //   UFBX_TRACE                Log calls of `ufbxi_check()` for tracing execution
 //   UFBX_LITTLE_ENDIAN=0/1    Explicitly define little/big endian architecture
 //   UFBX_PATH_SEPARATOR=''    Specify default platform path separator
 //   UFBX_NO_SSE               Do not try to include SSE
+//   UFBX_NO_AVX2              Do not use AVX2 even if the compiler targets it
+//   UFBX_USE_NEON             Explicitly enable NEON support (double precision kernels need AArch64)
+//   UFBX_NO_NEON              Do not try to include NEON
 
 // Dependencies:
 //   UFBX_NO_MALLOC              Disable default malloc/realloc/free
@@ -59,7 +63,23 @@
 #define UFBXI_FACE_GROUP_HASH_BITS 8
 #define UFBXI_MIN_THREADED_DEFLATE_BYTES 256
 #define UFBXI_MIN_THREADED_ASCII_VALUES 64
+#define UFBXI_ASCII_SECTION_SIZE 0x10000
+#define UFBXI_MIN_THREADED_ASCII_LEX_BYTES 0x400000
+#define UFBXI_ASCII_ARRAY_TASK_SIZE 0x20000
+#define UFBXI_OBJ_CHUNK_SIZE 0x10000
+#define UFBXI_INDEX_CHUNK_SIZE 0x4000
+#define UFBXI_INDEX_PARTITION_BITS 8
+#define UFBXI_MIN_THREADED_MESH_INDICES 0x8000
+#define UFBXI_MESH_INDEX_CHUNK_SIZE 0x4000
+#define UFBXI_MIN_THREADED_MODIFY_GEOMETRY_VALUES 0x8000
+#define UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE 0x4000
+#define UFBXI_MIN_THREADED_SUBDIVIDE_INDICES 0x4000
+#define UFBXI_SUBDIVIDE_TASK_MIN_ITEMS 0x1000
+#define UFBXI_TRIANGULATE_CHUNK_SIZE 0x4000
+#define UFBXI_MAX_SKINNING_SCRATCH 64
+#define UFBXI_EVALUATE_PROPS_CHUNK_SIZE 256
 #define UFBXI_GEOMETRY_CACHE_BUFFER_SIZE 512
+#define UFBXI_GEOMETRY_CACHE_RETAIN_CHUNK_SIZE 0x10000
 
 #ifndef UFBXI_MAX_NURBS_ORDER
 #define UFBXI_MAX_NURBS_ORDER 128
@@ -101,6 +121,9 @@
 	#if !defined(UFBX_NO_FORMAT_OBJ)
 		#define UFBXI_FEATURE_FORMAT_OBJ 1
 	#endif
+	#if !defined(UFBX_NO_LOAD_STATS)
+		#define UFBXI_FEATURE_LOAD_STATS 1
+	#endif
 #endif
 
 #if defined(UFBX_DEV)
@@ -136,6 +159,9 @@
 #if !defined(UFBXI_FEATURE_FORMAT_OBJ) && defined(UFBX_ENABLE_FORMAT_OBJ)
 	#define UFBXI_FEATURE_FORMAT_OBJ 1
 #endif
+#if !defined(UFBXI_FEATURE_LOAD_STATS) && defined(UFBX_ENABLE_LOAD_STATS)
+	#define UFBXI_FEATURE_LOAD_STATS 1
+#endif
 #if !defined(UFBXI_FEATURE_ERROR_STACK) && defined(UFBX_ENABLE_ERROR_STACK)
 	#define UFBXI_FEATURE_ERROR_STACK 1
 #endif
@@ -167,6 +193,9 @@
 #if !defined(UFBXI_FEATURE_FORMAT_OBJ)
 	#define UFBXI_FEATURE_FORMAT_OBJ 0
 #endif
+#if !defined(UFBXI_FEATURE_LOAD_STATS)
+	#define UFBXI_FEATURE_LOAD_STATS 0
+#endif
 #if !defined(UFBXI_FEATURE_ERROR_STACK)
 	#define UFBXI_FEATURE_ERROR_STACK 0
 #endif
@@ -185,7 +214,7 @@
 	#define UFBXI_FEATURE_KD 0
 #endif
 
-#if !UFBXI_FEATURE_SUBDIVISION || !UFBXI_FEATURE_TESSELLATION || !UFBXI_FEATURE_GEOMETRY_CACHE || !UFBXI_FEATURE_SCENE_EVALUATION || !UFBXI_FEATURE_SKINNING_EVALUATION || !UFBXI_FEATURE_ANIMATION_BAKING || !UFBXI_FEATURE_TRIANGULATION || !UFBXI_FEATURE_INDEX_GENERATION || !UFBXI_FEATURE_XML || !UFBXI_FEATURE_KD || !UFBXI_FEATURE_FORMAT_OBJ
+#if !UFBXI_FEATURE_SUBDIVISION || !UFBXI_FEATURE_TESSELLATION || !UFBXI_FEATURE_GEOMETRY_CACHE || !UFBXI_FEATURE_SCENE_EVALUATION || !UFBXI_FEATURE_SKINNING_EVALUATION || !UFBXI_FEATURE_ANIMATION_BAKING || !UFBXI_FEATURE_TRIANGULATION || !UFBXI_FEATURE_INDEX_GENERATION || !UFBXI_FEATURE_XML || !UFBXI_FEATURE_KD || !UFBXI_FEATURE_FORMAT_OBJ || !UFBXI_FEATURE_LOAD_STATS
 	#define UFBXI_PARTIAL_FEATURES 1
 #endif
 
@@ -614,6 +643,17 @@ extern "C" {
 	#endif
 #endif
 
+#if !defined(UFBX_STANDARD_C) && !defined(UFBX_NO_MMAP) && !defined(UFBX_NO_STDIO) && !defined(UFBX_EXTERNAL_STDIO) && !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+	#define UFBXI_HAS_MMAP 1
+	#include <sys/types.h>
+	#include <sys/stat.h>
+	#include <sys/mman.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#else
+	#define UFBXI_HAS_MMAP 0
+#endif
+
 #if !defined(UFBX_STANDARD_C) && ((defined(_MSC_VER) && defined(_M_X64) && !defined(_M_ARM64EC)) || ((defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)))
 	#define UFBXI_ARCH_X64 1
 #else
@@ -628,6 +668,34 @@ extern "C" {
 	#define UFBXI_HAS_SSE 0
 #endif
 
+// AVX2 is only used if the compiler targets it, there is no runtime dispatch.
+#if UFBXI_HAS_SSE && defined(__AVX2__) && !defined(UFBX_NO_AVX2)
+	#define UFBXI_HAS_AVX2 1
+	#include <immintrin.h>
+#else
+	#define UFBXI_HAS_AVX2 0
+#endif
+
+#if !defined(UFBX_STANDARD_C) && ((defined(_MSC_VER) && defined(_M_ARM64)) || ((defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)))
+	#define UFBXI_ARCH_ARM64 1
+#else
+	#define UFBXI_ARCH_ARM64 0
+#endif
+
+#if defined(UFBX_USE_NEON) || (!defined(UFBX_STANDARD_C) && !defined(UFBX_NO_NEON) && UFBXI_ARCH_ARM64)
+	#define UFBXI_HAS_NEON 1
+	#include <arm_neon.h>
+#else
+	#define UFBXI_HAS_NEON 0
+#endif
+
+// 32-bit ARM NEON has no double precision vectors, only use them on AArch64.
+#if UFBXI_HAS_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+	#define UFBXI_HAS_NEON_F64 1
+#else
+	#define UFBXI_HAS_NEON_F64 0
+#endif
+
 // -- Atomic counter
 
 #define UFBXI_THREAD_SAFE 1
@@ -895,6 +963,280 @@ ufbx_static_assert(source_header_version, UFBX_SOURCE_VERSION/1000u == UFBX_HEAD
 #endif
 
 
+// -- Conversion kernels
+
+// Bulk byte swapping and float conversion used by binary arrays and geometry caches.
+// `src` does not need to be aligned and may be equal to `dst`.
+
+static ufbxi_noinline void ufbxi_bswap_32(void *dst, const void *src, size_t count)
+{
+	char *d = (char*)dst;
+	const char *s = (const char*)src;
+	size_t i = 0;
+
+#if UFBXI_HAS_AVX2
+	const __m256i shuffle = _mm256_setr_epi8(
+		3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+		3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	for (; count - i >= 8; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(s + i * 4));
+		_mm256_storeu_si256((__m256i*)(d + i * 4), _mm256_shuffle_epi8(v, shuffle));
+	}
+#endif
+#if UFBXI_HAS_SSE
+	for (; count - i >= 4; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(s + i * 4));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		_mm_storeu_si128((__m128i*)(d + i * 4), v);
+	}
+#elif UFBXI_HAS_NEON
+	for (; count - i >= 4; i += 4) {
+		vst1q_u8((uint8_t*)(d + i * 4), vrev32q_u8(vld1q_u8((const uint8_t*)(s + i * 4))));
+	}
+#endif
+
+	ufbxi_nounroll for (; i < count; i++) {
+		uint32_t v;
+		memcpy(&v, s + i * 4, 4);
+		v = (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) | (v << 24);
+		memcpy(d + i * 4, &v, 4);
+	}
+}
+
+static ufbxi_noinline void ufbxi_bswap_64(void *dst, const void *src, size_t count)
+{
+	char *d = (char*)dst;
+	const char *s = (const char*)src;
+	size_t i = 0;
+
+#if UFBXI_HAS_AVX2
+	const __m256i shuffle = _mm256_setr_epi8(
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+	for (; count - i >= 4; i += 4) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(s + i * 8));
+		_mm256_storeu_si256((__m256i*)(d + i * 8), _mm256_shuffle_epi8(v, shuffle));
+	}
+#endif
+#if UFBXI_HAS_SSE
+	for (; count - i >= 2; i += 2) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(s + i * 8));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_si128((__m128i*)(d + i * 8), v);
+	}
+#elif UFBXI_HAS_NEON
+	for (; count - i >= 2; i += 2) {
+		vst1q_u8((uint8_t*)(d + i * 8), vrev64q_u8(vld1q_u8((const uint8_t*)(s + i * 8))));
+	}
+#endif
+
+	ufbxi_nounroll for (; i < count; i++) {
+		uint32_t lo, hi;
+		memcpy(&lo, s + i * 8, 4);
+		memcpy(&hi, s + i * 8 + 4, 4);
+		lo = (lo >> 24) | ((lo >> 8) & 0xff00u) | ((lo << 8) & 0xff0000u) | (lo << 24);
+		hi = (hi >> 24) | ((hi >> 8) & 0xff00u) | ((hi << 8) & 0xff0000u) | (hi << 24);
+		memcpy(d + i * 8, &hi, 4);
+		memcpy(d + i * 8 + 4, &lo, 4);
+	}
+}
+
+static ufbxi_noinline void ufbxi_convert_f32_to_f64(double *dst, const void *src, size_t count)
+{
+	const char *s = (const char*)src;
+	size_t i = 0;
+
+#if UFBXI_HAS_AVX2
+	for (; count - i >= 8; i += 8) {
+		_mm256_storeu_pd(dst + i + 0, _mm256_cvtps_pd(_mm_loadu_ps((const float*)(s + i * 4))));
+		_mm256_storeu_pd(dst + i + 4, _mm256_cvtps_pd(_mm_loadu_ps((const float*)(s + i * 4 + 16))));
+	}
+#endif
+#if UFBXI_HAS_SSE
+	for (; count - i >= 4; i += 4) {
+		__m128 v = _mm_loadu_ps((const float*)(s + i * 4));
+		_mm_storeu_pd(dst + i + 0, _mm_cvtps_pd(v));
+		_mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+	}
+#elif UFBXI_HAS_NEON_F64
+	for (; count - i >= 4; i += 4) {
+		float32x4_t v = vld1q_f32((const float*)(s + i * 4));
+		vst1q_f64(dst + i + 0, vcvt_f64_f32(vget_low_f32(v)));
+		vst1q_f64(dst + i + 2, vcvt_high_f64_f32(v));
+	}
+#endif
+
+	ufbxi_nounroll for (; i < count; i++) {
+		float v;
+		memcpy(&v, s + i * 4, 4);
+		dst[i] = (double)v;
+	}
+}
+
+static ufbxi_noinline void ufbxi_convert_f64_to_f32(float *dst, const void *src, size_t count)
+{
+	const char *s = (const char*)src;
+	size_t i = 0;
+
+#if UFBXI_HAS_AVX2
+	for (; count - i >= 8; i += 8) {
+		__m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd((const double*)(s + i * 8)));
+		__m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd((const double*)(s + i * 8 + 32)));
+		_mm256_storeu_ps(dst + i, _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+	}
+#endif
+#if UFBXI_HAS_SSE
+	for (; count - i >= 4; i += 4) {
+		__m128 lo = _mm_cvtpd_ps(_mm_loadu_pd((const double*)(s + i * 8)));
+		__m128 hi = _mm_cvtpd_ps(_mm_loadu_pd((const double*)(s + i * 8 + 16)));
+		_mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+	}
+#elif UFBXI_HAS_NEON_F64
+	for (; count - i >= 4; i += 4) {
+		float32x2_t lo = vcvt_f32_f64(vld1q_f64((const double*)(s + i * 8)));
+		float32x2_t hi = vcvt_f32_f64(vld1q_f64((const double*)(s + i * 8 + 16)));
+		vst1q_f32(dst + i, vcombine_f32(lo, hi));
+	}
+#endif
+
+	ufbxi_nounroll for (; i < count; i++) {
+		double v;
+		memcpy(&v, s + i * 8, 8);
+		dst[i] = (float)v;
+	}
+}
+
+// Convert floats/doubles to `ufbx_real`, returns `src` itself if the types match.
+static ufbxi_noinline const ufbx_real *ufbxi_convert_f32_to_real(ufbx_real *dst, const float *src, size_t count)
+{
+	if (sizeof(ufbx_real) == sizeof(float)) {
+		return (const ufbx_real*)(const void*)src;
+	} else if (sizeof(ufbx_real) == sizeof(double)) {
+		ufbxi_convert_f32_to_f64((double*)(void*)dst, src, count);
+	} else {
+		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
+			dst[i] = (ufbx_real)src[i];
+		}
+	}
+	return dst;
+}
+
+static ufbxi_noinline const ufbx_real *ufbxi_convert_f64_to_real(ufbx_real *dst, const double *src, size_t count)
+{
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		return (const ufbx_real*)(const void*)src;
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		ufbxi_convert_f64_to_f32((float*)(void*)dst, src, count);
+	} else {
+		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
+			dst[i] = (ufbx_real)src[i];
+		}
+	}
+	return dst;
+}
+
+// `dst[i] = src[i] * scale[(phase + i) % 3] * weight`, added to `dst[i]` if `additive`.
+// NOTE: Rounds exactly like the scalar expression, the vector paths repeat `scale` in a 12 or 24 element pattern.
+static ufbxi_noinline void ufbxi_scale_weight_vec3_real(ufbx_real *dst, const ufbx_real *src, size_t count, const ufbx_real *scale, size_t phase, ufbx_real weight, bool additive)
+{
+	ufbx_real pattern[24];
+	for (size_t i = 0; i < 24; i++) {
+		pattern[i] = scale[(phase + i) % 3];
+	}
+
+	size_t i = 0;
+#if UFBXI_HAS_AVX2
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		const double *s = (const double*)(const void*)src, *p = (const double*)(const void*)pattern;
+		double *d = (double*)(void*)dst;
+		const __m256d w = _mm256_set1_pd((double)weight);
+		for (; count - i >= 12; i += 12) {
+			for (size_t j = 0; j < 12; j += 4) {
+				__m256d v = _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(s + i + j), _mm256_loadu_pd(p + j)), w);
+				if (additive) v = _mm256_add_pd(_mm256_loadu_pd(d + i + j), v);
+				_mm256_storeu_pd(d + i + j, v);
+			}
+		}
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const float *s = (const float*)(const void*)src, *p = (const float*)(const void*)pattern;
+		float *d = (float*)(void*)dst;
+		const __m256 w = _mm256_set1_ps((float)weight);
+		for (; count - i >= 24; i += 24) {
+			for (size_t j = 0; j < 24; j += 8) {
+				__m256 v = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(s + i + j), _mm256_loadu_ps(p + j)), w);
+				if (additive) v = _mm256_add_ps(_mm256_loadu_ps(d + i + j), v);
+				_mm256_storeu_ps(d + i + j, v);
+			}
+		}
+	}
+#endif
+#if UFBXI_HAS_SSE
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		const double *s = (const double*)(const void*)src, *p = (const double*)(const void*)pattern;
+		double *d = (double*)(void*)dst;
+		const __m128d w = _mm_set1_pd((double)weight);
+		for (; count - i >= 12; i += 12) {
+			for (size_t j = 0; j < 12; j += 2) {
+				__m128d v = _mm_mul_pd(_mm_mul_pd(_mm_loadu_pd(s + i + j), _mm_loadu_pd(p + j)), w);
+				if (additive) v = _mm_add_pd(_mm_loadu_pd(d + i + j), v);
+				_mm_storeu_pd(d + i + j, v);
+			}
+		}
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const float *s = (const float*)(const void*)src, *p = (const float*)(const void*)pattern;
+		float *d = (float*)(void*)dst;
+		const __m128 w = _mm_set1_ps((float)weight);
+		for (; count - i >= 12; i += 12) {
+			for (size_t j = 0; j < 12; j += 4) {
+				__m128 v = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(s + i + j), _mm_loadu_ps(p + j)), w);
+				if (additive) v = _mm_add_ps(_mm_loadu_ps(d + i + j), v);
+				_mm_storeu_ps(d + i + j, v);
+			}
+		}
+	}
+#elif UFBXI_HAS_NEON
+	if (sizeof(ufbx_real) == sizeof(double)) {
+#if UFBXI_HAS_NEON_F64
+		const double *s = (const double*)(const void*)src, *p = (const double*)(const void*)pattern;
+		double *d = (double*)(void*)dst;
+		const float64x2_t w = vdupq_n_f64((double)weight);
+		for (; count - i >= 12; i += 12) {
+			for (size_t j = 0; j < 12; j += 2) {
+				float64x2_t v = vmulq_f64(vmulq_f64(vld1q_f64(s + i + j), vld1q_f64(p + j)), w);
+				if (additive) v = vaddq_f64(vld1q_f64(d + i + j), v);
+				vst1q_f64(d + i + j, v);
+			}
+		}
+#endif
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const float *s = (const float*)(const void*)src, *p = (const float*)(const void*)pattern;
+		float *d = (float*)(void*)dst;
+		const float32x4_t w = vdupq_n_f32((float)weight);
+		for (; count - i >= 12; i += 12) {
+			for (size_t j = 0; j < 12; j += 4) {
+				float32x4_t v = vmulq_f32(vmulq_f32(vld1q_f32(s + i + j), vld1q_f32(p + j)), w);
+				if (additive) v = vaddq_f32(vld1q_f32(d + i + j), v);
+				vst1q_f32(d + i + j, v);
+			}
+		}
+	}
+#endif
+
+	if (additive) {
+		ufbxi_nounroll for (; i < count; i++) {
+			dst[i] += src[i] * pattern[i % 12] * weight;
+		}
+	} else {
+		ufbxi_nounroll for (; i < count; i++) {
+			dst[i] = src[i] * pattern[i % 12] * weight;
+		}
+	}
+}
+
 // -- Large fast integer
 
 #if !defined(UFBX_STANDARD_C) && (defined(__wasm__) || defined(__EMSCRIPTEN__)) && !defined(UFBX_WASM_32BIT)
@@ -966,6 +1308,26 @@ ufbx_static_assert(source_header_version, UFBX_SOURCE_VERSION/1000u == UFBX_HEAD
 	}
 #endif
 
+// Count trailing zeros, `v` must be non-zero.
+#if !defined(UFBX_STANDARD_C) && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	ufbxi_extern_c unsigned char _BitScanForward(unsigned long * _Index, unsigned long _Mask);
+	static ufbxi_forceinline ufbxi_unused uint32_t ufbxi_ctz32(uint32_t v) {
+		unsigned long index;
+		_BitScanForward(&index, (unsigned long)v);
+		return (uint32_t)index;
+	}
+#elif !defined(UFBX_STANDARD_C) && (defined(__GNUC__) || defined(__clang__))
+	#define ufbxi_ctz32(v) ((uint32_t)__builtin_ctz((unsigned)(v)))
+#else
+	// DeBrujin table lookup
+	static const uint8_t ufbxi_ctz32_table[] = {
+		0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9,
+	};
+	static ufbxi_forceinline ufbxi_unused uint32_t ufbxi_ctz32(uint32_t v) {
+		return ufbxi_ctz32_table[((v & (0u - v)) * 0x077cb531u) >> 27];
+	}
+#endif
+
 // -- Bit conversion
 
 #if defined(__cplusplus)
@@ -1017,6 +1379,51 @@ ufbx_static_assert(source_header_version, UFBX_SOURCE_VERSION/1000u == UFBX_HEAD
 
 	#undef UFBXI_MIN_THREADED_ASCII_VALUES
 	#define UFBXI_MIN_THREADED_ASCII_VALUES 2
+
+	#undef UFBXI_ASCII_SECTION_SIZE
+	#define UFBXI_ASCII_SECTION_SIZE 64
+
+	#undef UFBXI_MIN_THREADED_ASCII_LEX_BYTES
+	#define UFBXI_MIN_THREADED_ASCII_LEX_BYTES 2
+
+	#undef UFBXI_ASCII_ARRAY_TASK_SIZE
+	#define UFBXI_ASCII_ARRAY_TASK_SIZE 16
+
+	#undef UFBXI_OBJ_CHUNK_SIZE
+	#define UFBXI_OBJ_CHUNK_SIZE 64
+
+	#undef UFBXI_INDEX_CHUNK_SIZE
+	#define UFBXI_INDEX_CHUNK_SIZE 16
+
+	#undef UFBXI_INDEX_PARTITION_BITS
+	#define UFBXI_INDEX_PARTITION_BITS 2
+
+	#undef UFBXI_MIN_THREADED_MESH_INDICES
+	#define UFBXI_MIN_THREADED_MESH_INDICES 2
+
+	#undef UFBXI_MESH_INDEX_CHUNK_SIZE
+	#define UFBXI_MESH_INDEX_CHUNK_SIZE 16
+
+	#undef UFBXI_MIN_THREADED_MODIFY_GEOMETRY_VALUES
+	#define UFBXI_MIN_THREADED_MODIFY_GEOMETRY_VALUES 2
+
+	#undef UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE
+	#define UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE 16
+
+	#undef UFBXI_MIN_THREADED_SUBDIVIDE_INDICES
+	#define UFBXI_MIN_THREADED_SUBDIVIDE_INDICES 2
+
+	#undef UFBXI_SUBDIVIDE_TASK_MIN_ITEMS
+	#define UFBXI_SUBDIVIDE_TASK_MIN_ITEMS 4
+
+	#undef UFBXI_TRIANGULATE_CHUNK_SIZE
+	#define UFBXI_TRIANGULATE_CHUNK_SIZE 4
+
+	#undef UFBXI_MAX_SKINNING_SCRATCH
+	#define UFBXI_MAX_SKINNING_SCRATCH 2
+
+	#undef UFBXI_EVALUATE_PROPS_CHUNK_SIZE
+	#define UFBXI_EVALUATE_PROPS_CHUNK_SIZE 4
 #endif
 
 #if defined(UFBX_REGRESSION)
@@ -1804,6 +2211,130 @@ static ufbxi_noinline uint32_t ufbxi_parse_double_init_flags(void)
 	return 0;
 }
 
+// Simple number parsing for the common case of short decimal numbers, used for bulk parsing.
+// Decimal digits are classified 16 bytes at a time and converted 8 digits at a time.
+
+// Number of readable bytes `ufbxi_parse_double_simple()` requires from the start of the number.
+#define UFBXI_PARSE_DOUBLE_SIMPLE_LENGTH 33
+
+// Bit `i` is set if `p[i]` is not a decimal digit, for `0 <= i < 8`.
+static ufbxi_forceinline uint32_t ufbxi_nondigit_mask8(uint64_t v)
+{
+	// Digits map to 0-9 in each byte, anything else has either the high bit set or is at least 10.
+	uint64_t x = v ^ UINT64_C(0x3030303030303030);
+	uint64_t high = (((x & UINT64_C(0x7f7f7f7f7f7f7f7f)) + UINT64_C(0x7676767676767676)) | x) & UINT64_C(0x8080808080808080);
+	return (uint32_t)(((high >> 7u) * UINT64_C(0x0102040810204080)) >> 56u);
+}
+
+// Bit `i` is set if `p[i]` is not a decimal digit, for `0 <= i < 16`.
+static ufbxi_forceinline uint32_t ufbxi_nondigit_mask16(const char *p)
+{
+#if UFBXI_HAS_SSE
+	__m128i c = _mm_loadu_si128((const __m128i*)p);
+	__m128i below = _mm_cmplt_epi8(c, _mm_set1_epi8('0'));
+	__m128i above = _mm_cmpgt_epi8(c, _mm_set1_epi8('9'));
+	return (uint32_t)_mm_movemask_epi8(_mm_or_si128(below, above));
+#else
+	return ufbxi_nondigit_mask8(ufbxi_read_u64(p)) | ufbxi_nondigit_mask8(ufbxi_read_u64(p + 8)) << 8u;
+#endif
+}
+
+// Convert the first `count` (1-8) ASCII digits of `v` to an integer.
+static ufbxi_forceinline uint64_t ufbxi_parse_digits8(uint64_t v, uint32_t count)
+{
+	v = (v & UINT64_C(0x0f0f0f0f0f0f0f0f)) << (64u - count * 8u);
+	v = (v * 10u + (v >> 8u)) & UINT64_C(0x00ff00ff00ff00ff);
+	v = (v * 100u + (v >> 16u)) & UINT64_C(0x0000ffff0000ffff);
+	v = (v * 10000u + (v >> 32u)) & UINT64_C(0xffffffff);
+	return v;
+}
+
+// Read 8 characters starting from digit `index` of a number with a decimal point after `num_int` digits.
+static ufbxi_forceinline uint64_t ufbxi_read_digits8(const char *p, uint32_t index, uint32_t num_int)
+{
+	uint64_t before = ufbxi_read_u64(p + index);
+	uint64_t after = ufbxi_read_u64(p + index + 1);
+	uint32_t num_before = num_int > index ? num_int - index : 0;
+	uint64_t mask = num_before >= 8 ? UINT64_MAX : (UINT64_C(1) << (num_before * 8u)) - 1;
+	return (before & mask) | (after & ~mask);
+}
+
+// Parse a number at `p` that has at least `UFBXI_PARSE_DOUBLE_SIMPLE_LENGTH` readable bytes.
+// Returns the end of the number, or `NULL` if it needs `ufbxi_parse_double()`.
+// The result matches `ufbxi_parse_double()` with `UFBXI_PARSE_DOUBLE_ALLOW_FAST_PATH`.
+static ufbxi_forceinline const char *ufbxi_parse_double_simple(double *p_value, const char *p)
+{
+	char sign = *p;
+	bool negative = sign == '-';
+	p += (negative || sign == '+') ? 1 : 0;
+
+	uint32_t mask = ufbxi_nondigit_mask16(p) | ufbxi_nondigit_mask16(p + 16) << 16u;
+	uint32_t num_int = ufbxi_ctz32(mask | 0x80000000u);
+	if (num_int > 17) return NULL;
+
+	uint32_t num_frac = 0;
+	const char *end = p + num_int;
+	if (*end == '.') {
+		num_frac = ufbxi_ctz32((mask >> (num_int + 1)) | 0x80000000u);
+		end += 1 + num_frac;
+	}
+
+	// `ufbxi_parse_double()` switches to big integers at 18 digits
+	uint32_t num_digits = num_int + num_frac;
+	if (num_digits == 0 || num_digits > 17) return NULL;
+
+	uint64_t digits = ufbxi_parse_digits8(ufbxi_read_digits8(p, 0, num_int), ufbxi_min32(num_digits, 8));
+	if (num_digits > 8) {
+		uint32_t num_low = ufbxi_min32(num_digits - 8, 8);
+		digits = digits * (ufbxi_pow5_tab[num_low] << num_low) + ufbxi_parse_digits8(ufbxi_read_digits8(p, 8, num_int), num_low);
+		if (num_digits > 16) {
+			digits = digits * 10u + (uint64_t)(p[num_int > 16 ? 16 : 17] - '0');
+		}
+	}
+
+	int32_t dec_exponent = -(int32_t)num_frac;
+	if (*end == 'e' || *end == 'E') {
+		end++;
+		bool exp_negative = false;
+		if (*end == '+' || *end == '-') {
+			exp_negative = *end++ == '-';
+		}
+		int32_t exp = 0;
+		for (uint32_t i = 0; *end >= '0' && *end <= '9'; i++) {
+			if (i == 4) return NULL;
+			exp = exp * 10 + (*end++ - '0');
+		}
+		dec_exponent += exp_negative ? -exp : exp;
+	}
+
+	char c = *end;
+	if (c == '#' || c == 'i' || c == 'I' || c == 'n' || c == 'N') return NULL;
+	if (dec_exponent < -22 || dec_exponent > 22 || (digits >> 53) != 0) return NULL;
+
+	double value;
+	if (dec_exponent < 0) {
+		value = (double)digits / ufbxi_pow10_tab_f64[-dec_exponent];
+	} else {
+		value = (double)digits * ufbxi_pow10_tab_f64[dec_exponent];
+	}
+	*p_value = negative ? -value : value;
+	return end;
+}
+
+// `ufbxi_parse_double()` using `ufbxi_parse_double_simple()` if possible.
+static ufbxi_forceinline double ufbxi_parse_double_fast(const char *str, size_t max_length, char **p_end, uint32_t flags)
+{
+	if ((flags & UFBXI_PARSE_DOUBLE_ALLOW_FAST_PATH) != 0 && max_length >= UFBXI_PARSE_DOUBLE_SIMPLE_LENGTH) {
+		double value; // ufbxi_uninit
+		const char *end = ufbxi_parse_double_simple(&value, str);
+		if (end) {
+			*p_end = (char*)end;
+			return value;
+		}
+	}
+	return ufbxi_parse_double(str, max_length, p_end, flags);
+}
+
 static ufbxi_forceinline int64_t ufbxi_parse_int64(const char *str, char **end)
 {
 	uint64_t abs_val = 0;
@@ -3635,6 +4166,9 @@ static ufbxi_forceinline size_t ufbxi_size_align_mask(size_t size)
 typedef struct {
 	ufbx_error *error;
 	size_t current_size;
+#if UFBXI_FEATURE_LOAD_STATS
+	size_t peak_size;
+#endif
 	size_t max_size;
 	size_t num_allocs;
 	size_t max_allocs;
@@ -3691,6 +4225,9 @@ static ufbxi_noinline void *ufbxi_alloc_size(ufbxi_allocator *ator, size_t size,
 	ufbx_assert(ufbxi_is_aligned_mask(ptr, ufbxi_size_align_mask(total)));
 
 	ator->current_size += total;
+#if UFBXI_FEATURE_LOAD_STATS
+	if (ator->current_size > ator->peak_size) ator->peak_size = ator->current_size;
+#endif
 
 	return ptr;
 }
@@ -3735,6 +4272,9 @@ static ufbxi_noinline void *ufbxi_realloc_size(ufbxi_allocator *ator, size_t siz
 
 	ator->current_size += total;
 	ator->current_size -= old_total;
+#if UFBXI_FEATURE_LOAD_STATS
+	if (ator->current_size > ator->peak_size) ator->peak_size = ator->current_size;
+#endif
 
 	return ptr;
 }
@@ -3811,6 +4351,10 @@ static ufbxi_noinline void ufbxi_free_ator(ufbxi_allocator *ator)
 #define UFBXI_CACHE_IMP_MAGIC 0x48434355
 #define UFBXI_ANIM_IMP_MAGIC 0x494e4155
 #define UFBXI_BAKED_ANIM_IMP_MAGIC 0x4b414255
+#define UFBXI_ANIM_CURSOR_IMP_MAGIC 0x52434155
+#define UFBXI_COMPILED_ANIM_IMP_MAGIC 0x4e414355
+#define UFBXI_CACHE_PLAYER_IMP_MAGIC 0x59504355
+#define UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC 0x54535355
 #define UFBXI_REFCOUNT_IMP_MAGIC 0x46455255
 #define UFBXI_BUF_CHUNK_IMP_MAGIC 0x46554255
 
@@ -4907,6 +5451,10 @@ typedef struct {
 	size_t temp_cap; // < Capacity of the temporary buffer
 	ufbx_unicode_error_handling error_handling;
 	ufbxi_warnings *warnings;
+#if UFBXI_FEATURE_LOAD_STATS
+	size_t num_lookups; // < Number of strings interned
+	size_t num_hits; // < Number of strings found already in the pool
+#endif
 } ufbxi_string_pool;
 
 typedef struct {
@@ -5190,8 +5738,14 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_push_sanitized_string(ufbxi_stri
 
 	ufbx_string ref = { total_data, total_length };
 
+#if UFBXI_FEATURE_LOAD_STATS
+	pool->num_lookups++;
+#endif
 	ufbx_string *entry = ufbxi_map_find(&pool->map, ufbx_string, hash, &ref);
 	if (entry) {
+#if UFBXI_FEATURE_LOAD_STATS
+		pool->num_hits++;
+#endif
 		sanitized->raw_data = entry->data;
 	} else {
 		entry = ufbxi_map_insert(&pool->map, ufbx_string, hash, &ref);
@@ -5235,8 +5789,16 @@ ufbxi_nodiscard static ufbxi_noinline const char *ufbxi_push_string_imp(ufbxi_st
 
 	ufbx_string ref = { str, length };
 
+#if UFBXI_FEATURE_LOAD_STATS
+	pool->num_lookups++;
+#endif
 	ufbx_string *entry = ufbxi_map_find(&pool->map, ufbx_string, hash, &ref);
-	if (entry) return entry->data;
+	if (entry) {
+#if UFBXI_FEATURE_LOAD_STATS
+		pool->num_hits++;
+#endif
+		return entry->data;
+	}
 	entry = ufbxi_map_insert(&pool->map, ufbx_string, hash, &ref);
 	ufbxi_check_return_err(pool->error, entry, NULL);
 	entry->length = length;
@@ -5992,6 +6554,9 @@ struct ufbxi_task {
 typedef struct {
 	ufbxi_task task;
 	ufbxi_task_fn *fn;
+#if UFBXI_FEATURE_LOAD_STATS
+	double time;
+#endif
 } ufbxi_task_imp;
 
 typedef struct {
@@ -6018,16 +6583,31 @@ struct ufbxi_thread_pool {
 
 	uint32_t num_tasks;
 	ufbxi_task_imp *tasks;
+
+#if UFBXI_FEATURE_LOAD_STATS
+	// Optional clock for measuring task execution and wait times
+	ufbx_clock_cb clock;
+	double task_time;
+	double wait_time;
+#endif
 };
 
 static void ufbxi_thread_pool_execute(ufbxi_thread_pool *pool, uint32_t index)
 {
 	ufbxi_task_imp *imp = &pool->tasks[index % pool->num_tasks];
+#if UFBXI_FEATURE_LOAD_STATS
+	double start_time = pool->clock.fn ? pool->clock.fn(pool->clock.user) : 0.0;
+#endif
 	if (imp->fn(&imp->task)) {
 		imp->task.error = NULL;
 	} else if (!imp->task.error) {
 		imp->task.error = "";
 	}
+#if UFBXI_FEATURE_LOAD_STATS
+	if (pool->clock.fn) {
+		imp->time = pool->clock.fn(pool->clock.user) - start_time;
+	}
+#endif
 }
 
 ufbxi_noinline static void ufbxi_thread_pool_update_finished(ufbxi_thread_pool *pool, uint32_t max_index)
@@ -6038,6 +6618,11 @@ ufbxi_noinline static void ufbxi_thread_pool_update_finished(ufbxi_thread_pool *
 			pool->failed = true;
 			pool->error_desc = task->task.error;
 		}
+#if UFBXI_FEATURE_LOAD_STATS
+		if (pool->clock.fn) {
+			pool->task_time += task->time;
+		}
+#endif
 		pool->wait_index += 1;
 	}
 }
@@ -6047,8 +6632,16 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_thread_pool_wait_imp(ufbxi_threa
 	uint32_t max_index = pool->groups[group].max_index;
 
 	if (pool->groups[group].wait_index < max_index) {
+#if UFBXI_FEATURE_LOAD_STATS
+		double start_time = pool->clock.fn ? pool->clock.fn(pool->clock.user) : 0.0;
+#endif
 		pool->opts.pool.wait_fn(pool->opts.pool.user, (ufbx_thread_pool_context)pool, group, max_index);
 		pool->groups[group].wait_index = max_index;
+#if UFBXI_FEATURE_LOAD_STATS
+		if (pool->clock.fn) {
+			pool->wait_time += pool->clock.fn(pool->clock.user) - start_time;
+		}
+#endif
 	}
 	ufbxi_thread_pool_update_finished(pool, max_index);
 
@@ -6172,6 +6765,43 @@ static void ufbxi_thread_pool_run_task(ufbxi_thread_pool *pool, ufbxi_task *task
 	pool->start_index = index + 1;
 }
 
+// Run `fn` as a task if possible, waiting for previous tasks if the pool is full.
+// Falls back to executing `fn` immediately if threading is disabled.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_thread_pool_dispatch(ufbxi_thread_pool *pool, ufbx_error *error, ufbxi_task_fn *fn, void *data)
+{
+	ufbxi_task *task = ufbxi_thread_pool_create_task(pool, fn);
+	if (!task && pool->enabled) {
+		ufbxi_thread_pool_flush_group(pool);
+		ufbxi_check_err(error, ufbxi_thread_pool_wait_all(pool));
+		task = ufbxi_thread_pool_create_task(pool, fn);
+	}
+
+	if (task) {
+		task->data = data;
+		ufbxi_thread_pool_run_task(pool, task);
+	} else {
+		ufbxi_task local_task = { data, NULL };
+		if (!fn(&local_task)) {
+			if (local_task.error && local_task.error[0]) {
+				error->description.data = local_task.error;
+				error->description.length = strlen(local_task.error);
+			}
+			ufbxi_fail_err(error, "Task failed");
+		}
+	}
+
+	return 1;
+}
+
+// Wait for all tasks started with `ufbxi_thread_pool_dispatch()`.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_thread_pool_dispatch_wait(ufbxi_thread_pool *pool, ufbx_error *error)
+{
+	if (!pool->enabled) return 1;
+	ufbxi_thread_pool_flush_group(pool);
+	ufbxi_check_err(error, ufbxi_thread_pool_wait_all(pool));
+	return 1;
+}
+
 // -- Type definitions
 
 typedef struct ufbxi_node ufbxi_node;
@@ -6231,12 +6861,28 @@ static ufbxi_noinline void ufbxi_retain_ref(ufbxi_refcount *refcount);
 
 #define ufbxi_get_imp(type, ptr) ((type*)((char*)ptr - sizeof(ufbxi_refcount)))
 
+typedef struct ufbxi_eval_state ufbxi_eval_state;
+
+// Memory mapped file retained by a scene or geometry cache, see `ufbxi_map_file()`.
+typedef struct ufbxi_file_map ufbxi_file_map;
+struct ufbxi_file_map {
+	void *data;
+	size_t size;
+	ufbxi_file_map *next;
+};
+
 typedef struct {
 	ufbxi_refcount refcount;
 	ufbx_scene scene;
 	uint32_t magic;
 
 	ufbxi_buf string_buf;
+
+	// Incremental evaluation state for scenes from `ufbx_evaluate_scene()`.
+	ufbxi_eval_state *eval_state;
+
+	// Geometry cache files mapped with `ufbx_load_opts.retain_geometry_cache_data`.
+	ufbxi_file_map *file_maps;
 } ufbxi_scene_imp;
 
 ufbx_static_assert(scene_imp_offset, offsetof(ufbxi_scene_imp, scene) == sizeof(ufbxi_refcount));
@@ -6271,6 +6917,78 @@ typedef struct {
 	} value;
 } ufbxi_ascii_token;
 
+// Part of an in-memory file parsed ahead of the main thread in a thread pool task.
+// Tasks can't allocate memory or report errors: They write records to a fixed size
+// buffer allocated by the main thread and stop at the first input they can't handle
+// or that doesn't fit. The main thread parses anything after `parsed_end` normally.
+typedef struct {
+	const char *begin;
+	const char *end;
+	const char *parsed_end;
+	uint32_t double_parse_flags;
+
+	// Records written by the task, each aligned to 8 bytes
+	char *records;
+	size_t records_size;
+	size_t records_cap;
+} ufbxi_parse_task;
+
+// Reserve a record of at least `min_size` bytes, returns `NULL` if it doesn't fit.
+// The record is added by `ufbxi_parse_task_commit()`, `*p_space` is set to the maximum size.
+static ufbxi_forceinline char *ufbxi_parse_task_reserve(ufbxi_parse_task *pt, size_t min_size, size_t *p_space)
+{
+	size_t offset = ufbxi_align_to_mask(pt->records_size, 7);
+	if (offset > pt->records_cap || pt->records_cap - offset < min_size) return NULL;
+	*p_space = pt->records_cap - offset;
+	return pt->records + offset;
+}
+
+static ufbxi_forceinline void ufbxi_parse_task_commit(ufbxi_parse_task *pt, const char *record, size_t size)
+{
+	pt->records_size = ufbxi_to_size(record - pt->records) + size;
+}
+
+static ufbxi_forceinline char *ufbxi_parse_task_push(ufbxi_parse_task *pt, size_t size)
+{
+	size_t space; // ufbxi_uninit
+	char *record = ufbxi_parse_task_reserve(pt, size, &space);
+	if (record) ufbxi_parse_task_commit(pt, record, size);
+	return record;
+}
+
+// Token lexed ahead of time in a thread, positions are relative to the beginning
+// of the containing section, see `ufbxi_ascii_find_pretoken()`.
+// String, name and bare word tokens are followed by `value.str_len` bytes of string data.
+typedef struct {
+	uint32_t begin; // < Position before any whitespace leading the token
+	uint32_t end;   // < Position the lexer continues from after the token
+
+	union {
+		double f64;
+		int64_t i64;
+		uint32_t str_len;
+	} value;
+
+	char type;
+	bool negative;
+} ufbxi_ascii_pretoken;
+
+// Range of top-level `Objects` children split into sections that are lexed in parallel,
+// the records of each section are `ufbxi_ascii_pretoken`.
+typedef struct {
+	ufbxi_buf buf;
+	const char *begin;
+	const char *end;
+	ufbxi_parse_task *sections;
+	size_t num_sections;
+
+	// Thread pool index after the tasks, `ready` is set after they have been waited for.
+	uint32_t task_end;
+	bool ready;
+} ufbxi_ascii_window;
+
+#define UFBXI_ASCII_WINDOW_COUNT (UFBX_THREAD_GROUP_COUNT + 1)
+
 typedef struct {
 	size_t max_token_length;
 
@@ -6288,6 +7006,20 @@ typedef struct {
 
 	ufbxi_ascii_token prev_token;
 	ufbxi_ascii_token token;
+
+	// Windows of pre-lexed tokens in source order starting from `first_window`.
+	ufbxi_ascii_window windows[UFBXI_ASCII_WINDOW_COUNT];
+	size_t first_window;
+	size_t num_windows;
+	size_t window_size;
+
+	// Position to split the next window from, NULL if there is nothing left.
+	const char *scan_pos;
+
+	// Current position in `windows[]`, only advances forward.
+	size_t cursor_window;
+	size_t cursor_section;
+	size_t cursor_offset;
 } ufbxi_ascii;
 
 typedef struct {
@@ -6398,6 +7130,27 @@ typedef struct {
 	size_t num_left;
 } ufbxi_obj_fast_indices;
 
+// Records of lines pre-parsed in thread pool tasks, each record is aligned to 8 bytes
+// and followed by its data, see `ufbxi_obj_parse_chunk()`.
+typedef enum {
+	UFBXI_OBJ_RECORD_VERTICES, // < `count` vertices of `attrib`, followed by the values
+	UFBXI_OBJ_RECORD_FACE,     // < Face with `count` indices, followed by `3*count` raw indices
+	UFBXI_OBJ_RECORD_LINE,     // < Line to be parsed by the main thread, followed by a `ufbx_string`
+} ufbxi_obj_record_type;
+
+typedef struct {
+	uint16_t type;
+	uint16_t attrib;
+	uint32_t count;
+} ufbxi_obj_record;
+
+// Range of the file split into chunks that are parsed in parallel.
+typedef struct {
+	ufbxi_buf buf;
+	ufbxi_parse_task *chunks;
+	size_t num_chunks;
+} ufbxi_obj_window;
+
 // Temporary pointer to a `ufbx_anim_stack` by name used to patch start/stop
 // time from "Takes" if necessary.
 typedef struct {
@@ -6469,6 +7222,12 @@ typedef struct {
 	bool group_dirty;
 	bool face_group_dirty;
 
+	// Threaded parsing, windows are dispatched one per thread pool group.
+	ufbxi_obj_window windows[UFBX_THREAD_GROUP_COUNT];
+	const char *scan_pos;
+	const char *scan_end;
+	size_t window_size;
+
 } ufbxi_obj_context;
 
 typedef struct {
@@ -6642,11 +7401,31 @@ typedef struct {
 	const char *load_filename;
 	size_t load_filename_len;
 
+	// Read-only mapping of the main file, see `ufbx_load_opts.use_memory_map`.
+	void *mmap_data;
+	size_t mmap_size;
+
+	// Geometry cache files mapped while loading, retained by the scene.
+	ufbxi_file_map *file_maps;
+
+	// User memory passed to `ufbx_load_memory()`, arrays may point into it
+	// directly if `no_copy_arrays` is set, see `ufbx_load_opts.no_copy_arrays`.
+	const char *source_data;
+	size_t source_size;
+	bool no_copy_arrays;
+
 	bool parse_threaded;
 	ufbxi_thread_pool thread_pool;
 
 	uint8_t *base64_table;
 
+#if UFBXI_FEATURE_LOAD_STATS
+	ufbx_clock_cb stats_clock;
+	ufbx_load_phase stats_phase;
+	double stats_start_time;
+	double stats_phase_start_time;
+#endif
+
 } ufbxi_context;
 
 static ufbxi_noinline int ufbxi_fail_imp(ufbxi_context *uc, const char *cond, const char *func, uint32_t line)
@@ -6673,6 +7452,73 @@ static ufbxi_noinline int ufbxi_fail_imp(ufbxi_context *uc, const char *cond, co
 #define ufbxi_warnf(type, ...) ufbxi_warnf_imp(&uc->warnings, type, ~0u, __VA_ARGS__)
 #define ufbxi_warnf_tag(type, element_id, ...) ufbxi_warnf_imp(&uc->warnings, type, (element_id), __VA_ARGS__)
 
+// -- Load statistics
+
+// Counters are accumulated directly to `uc->scene.metadata.load_stats` and
+// cleared in `ufbxi_stats_finish()` if they were not requested. Timing is only
+// measured if the user supplied a clock via `ufbx_load_opts.stats_clock_cb`.
+
+#if UFBXI_FEATURE_LOAD_STATS
+
+static ufbxi_noinline void ufbxi_stats_begin(ufbxi_context *uc)
+{
+	if (!uc->opts.collect_stats || !uc->opts.stats_clock_cb.fn) return;
+	uc->stats_clock = uc->opts.stats_clock_cb;
+	uc->stats_start_time = uc->stats_clock.fn(uc->stats_clock.user);
+	uc->stats_phase_start_time = uc->stats_start_time;
+	uc->stats_phase = UFBX_LOAD_PHASE_OPEN;
+}
+
+static ufbxi_noinline void ufbxi_stats_phase_imp(ufbxi_context *uc, ufbx_load_phase phase)
+{
+	if (!uc->stats_clock.fn) return;
+	double time = uc->stats_clock.fn(uc->stats_clock.user);
+	uc->scene.metadata.load_stats.phase_time[uc->stats_phase] += time - uc->stats_phase_start_time;
+	uc->stats_phase_start_time = time;
+	uc->stats_phase = phase;
+}
+
+static ufbxi_noinline void ufbxi_stats_finish(ufbxi_context *uc)
+{
+	ufbx_load_stats *stats = &uc->scene.metadata.load_stats;
+	if (!uc->opts.collect_stats) {
+		memset(stats, 0, sizeof(ufbx_load_stats));
+		return;
+	}
+
+	stats->enabled = true;
+	stats->num_tasks = uc->thread_pool.start_index;
+	stats->temp_memory_peak = uc->ator_tmp.peak_size;
+	stats->result_memory_peak = uc->ator_result.peak_size;
+	stats->num_string_lookups = uc->string_pool.num_lookups;
+	stats->num_string_hits = uc->string_pool.num_hits;
+
+	if (uc->stats_clock.fn) {
+		ufbxi_stats_phase_imp(uc, uc->stats_phase);
+		stats->total_time = uc->stats_phase_start_time - uc->stats_start_time;
+		stats->task_time = uc->thread_pool.task_time;
+		stats->task_wait_time = uc->thread_pool.wait_time;
+
+		// Estimate the serial time as the time spent on the loading thread
+		// outside of waiting for tasks plus the time spent in tasks.
+		if (stats->total_time > 0.0) {
+			double serial_time = stats->total_time - stats->task_wait_time + stats->task_time;
+			stats->parallel_speedup = serial_time / stats->total_time;
+		} else {
+			stats->parallel_speedup = 1.0;
+		}
+	}
+}
+
+	#define ufbxi_stats_phase(uc, phase) ufbxi_stats_phase_imp((uc), (phase))
+	#define ufbxi_stats_add(uc, field, value) ((uc)->scene.metadata.load_stats.field += (value))
+#else
+	static void ufbxi_stats_begin(ufbxi_context *uc) { (void)uc; }
+	static void ufbxi_stats_finish(ufbxi_context *uc) { (void)uc; }
+	#define ufbxi_stats_phase(uc, phase) (void)0
+	#define ufbxi_stats_add(uc, field, value) (void)0
+#endif
+
 // -- Progress
 
 static ufbxi_forceinline uint64_t ufbxi_get_read_offset(ufbxi_context *uc)
@@ -6952,6 +7798,40 @@ static ufbxi_noinline void ufbxi_init_ator(ufbx_error *error, ufbxi_allocator *a
 	ator->name = name;
 }
 
+// Initialize an allocator for one of `num_tasks` thread pool tasks allocating from the same
+// allocator as `parent`. The remaining limits of `parent` are split evenly between the tasks
+// so that their combined usage stays within them. `parent` retains ownership of the user
+// allocator, so freeing the task allocator does not call `free_allocator_fn()`.
+static ufbxi_noinline void ufbxi_init_task_ator(ufbx_error *error, ufbxi_allocator *ator, const ufbxi_allocator *parent, size_t num_tasks, const char *name)
+{
+	ufbx_assert(num_tasks > 0);
+	memset(ator, 0, sizeof(ufbxi_allocator));
+	ator->ator = parent->ator;
+	ator->ator.allocator.free_allocator_fn = NULL;
+	ator->error = error;
+	ator->max_size = parent->max_size;
+	if (ator->max_size != SIZE_MAX) {
+		ator->max_size = (parent->max_size - ufbxi_min_sz(parent->current_size, parent->max_size)) / num_tasks;
+	}
+	ator->max_allocs = parent->max_allocs;
+	if (ator->max_allocs != SIZE_MAX) {
+		ator->max_allocs = (parent->max_allocs - ufbxi_min_sz(parent->num_allocs, parent->max_allocs)) / num_tasks;
+	}
+	ator->huge_size = parent->huge_size;
+	ator->chunk_max = parent->chunk_max;
+	ator->name = name;
+}
+
+// Free an allocator created by `ufbxi_init_task_ator()` after its task has finished,
+// counting its allocations towards the `allocation_limit` of `parent`.
+static ufbxi_noinline void ufbxi_free_task_ator(ufbxi_allocator *parent, ufbxi_allocator *ator)
+{
+	ufbx_assert(ator->ator.allocator.free_allocator_fn == NULL);
+	parent->num_allocs += ator->num_allocs;
+	ator->num_allocs = 0;
+	ufbxi_free_ator(ator);
+}
+
 typedef struct {
 	ufbx_error error;
 
@@ -7187,6 +8067,119 @@ static ufbxi_noinline bool ufbxi_stdio_open(ufbxi_file_context *fc, ufbx_stream
 
 #endif
 
+// -- Memory mapped IO
+
+#if UFBXI_HAS_MMAP
+
+// Map a whole file for reading, leaves `map->data` as `NULL` if the file cannot be mapped.
+// Only fails on allocation failure, the caller should fall back to reading the file.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_map_file(ufbxi_allocator *ator, ufbxi_file_map *map, const char *path, size_t path_len, bool null_terminated)
+{
+	map->data = NULL;
+	map->size = 0;
+
+	char copy_buf[256], *copy = NULL; // ufbxi_uninit
+	if (null_terminated) {
+		copy = (char*)path;
+	} else {
+		if (path_len < ufbxi_arraycount(copy_buf) - 1) {
+			copy = copy_buf;
+		} else {
+			copy = ufbxi_alloc(ator, char, path_len + 1);
+			if (!copy) return 0;
+		}
+		memcpy(copy, path, path_len);
+		copy[path_len] = '\0';
+	}
+
+	int flags = O_RDONLY;
+	#if defined(O_CLOEXEC)
+		flags |= O_CLOEXEC;
+	#endif
+	int fd = open(copy, flags);
+	if (!null_terminated && copy != copy_buf) {
+		ufbxi_free(ator, char, copy, path_len + 1);
+	}
+	if (fd < 0) return 1;
+
+	// Only map non-empty regular files, `mmap()` fails for zero size and
+	// special files may not report a meaningful size.
+	void *data = MAP_FAILED;
+	size_t size = 0;
+	struct stat st; // ufbxi_uninit
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && (uint64_t)st.st_size <= (uint64_t)(SIZE_MAX / 2)) {
+		size = (size_t)st.st_size;
+		data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	close(fd);
+	if (data == MAP_FAILED) return 1;
+
+	map->data = data;
+	map->size = size;
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_unmap_files(ufbxi_file_map *map)
+{
+	for (; map; map = map->next) {
+		if (map->data) {
+			munmap(map->data, map->size);
+			map->data = NULL;
+			map->size = 0;
+		}
+	}
+}
+
+#else
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_map_file(ufbxi_allocator *ator, ufbxi_file_map *map, const char *path, size_t path_len, bool null_terminated)
+{
+	(void)ator;
+	(void)path;
+	(void)path_len;
+	(void)null_terminated;
+	map->data = NULL;
+	map->size = 0;
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_unmap_files(ufbxi_file_map *map)
+{
+	(void)map;
+}
+
+#endif
+
+// Try to map the main file for reading, on success the file contents are used
+// as if they were passed to `ufbx_load_memory()`. Any failure in opening or
+// mapping the file is silent as the caller falls back to stdio, which reports
+// the actual error if the file is unreadable.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_mmap_open(ufbxi_context *uc, const char *path, size_t path_len, bool null_terminated)
+{
+	ufbxi_file_map map; // ufbxi_uninit
+	ufbxi_check(ufbxi_map_file(&uc->ator_tmp, &map, path, path_len, null_terminated));
+	if (!map.data) return 1;
+
+	uc->mmap_data = map.data;
+	uc->mmap_size = map.size;
+	uc->data_begin = uc->data = (const char*)map.data;
+	uc->data_size = map.size;
+	uc->progress_bytes_total = map.size;
+	ufbxi_stats_add(uc, memory_mapped_bytes, map.size);
+
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_mmap_close(ufbxi_context *uc)
+{
+	if (uc->mmap_data) {
+		ufbxi_file_map map = { uc->mmap_data, uc->mmap_size, NULL };
+		ufbxi_unmap_files(&map);
+		uc->mmap_data = NULL;
+		uc->mmap_size = 0;
+	}
+}
+
 // -- Memory IO
 
 typedef struct {
@@ -7972,6 +8965,7 @@ typedef enum {
 	UFBXI_ARRAY_FLAG_TMP_BUF      = 0x2, // < Allocate the array from the long-term temporary buffer
 	UFBXI_ARRAY_FLAG_PAD_BEGIN    = 0x4, // < Pad the begin of the array with 4 zero elements to guard from invalid -1 index accesses
 	UFBXI_ARRAY_FLAG_ACCURATE_F32 = 0x8, // < Must be parsed as bit-accurate 32-bit floats
+	UFBXI_ARRAY_FLAG_NO_COPY      = 0x10, // < May reference the source memory directly, see `ufbx_load_opts.no_copy_arrays`
 } ufbxi_array_flags;
 
 typedef struct {
@@ -8123,7 +9117,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_Indexes) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		} else if (name == ufbxi_Points) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'r';
@@ -8249,7 +9243,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_NormalsIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		} else if (name == ufbxi_NormalsW) {
 			info->type = uc->retain_vertex_w ? 'r' : '-';
@@ -8265,7 +9259,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_BinormalsIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		} else if (name == ufbxi_BinormalsW) {
 			info->type = uc->retain_vertex_w ? 'r' : '-';
@@ -8281,7 +9275,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_TangentsIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		} else if (name == ufbxi_TangentsW) {
 			info->type = uc->retain_vertex_w ? 'r' : '-';
@@ -8297,7 +9291,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_UVIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		}
 		break;
@@ -8309,7 +9303,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_ColorIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		}
 		break;
@@ -8321,7 +9315,7 @@ static bool ufbxi_is_array_node(ufbxi_context *uc, ufbxi_parse_state parent, con
 			return true;
 		} else if (name == ufbxi_VertexCreaseIndex) {
 			info->type = uc->opts.ignore_geometry ? '-' : 'i';
-			info->flags = UFBXI_ARRAY_FLAG_RESULT;
+			info->flags = UFBXI_ARRAY_FLAG_RESULT | UFBXI_ARRAY_FLAG_NO_COPY;
 			return true;
 		}
 		break;
@@ -8625,17 +9619,10 @@ ufbxi_nodiscard static ufbxi_noinline char *ufbxi_swap_endian(ufbxi_context *uc,
 		}
 		break;
 	case 4:
-		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
-			d[0] = s[3]; d[1] = s[2]; d[2] = s[1]; d[3] = s[0];
-			d += 4; s += 4;
-		}
+		ufbxi_bswap_32(d, s, count);
 		break;
 	case 8:
-		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
-			d[0] = s[7]; d[1] = s[6]; d[2] = s[5]; d[3] = s[4];
-			d[4] = s[3]; d[5] = s[2]; d[6] = s[1]; d[7] = s[0];
-			d += 8; s += 8;
-		}
+		ufbxi_bswap_64(d, s, count);
 		break;
 	default:
 		ufbxi_unreachable("Bad endian swap size");
@@ -8675,9 +9662,11 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_binary_convert_array(ufbxi_conte
 	// Convert commented out lines under some `#if UFBX_NON_IEE754` define or something.
 	if (src_type == dst_type) {
 		ufbx_assert(maybe_uc && maybe_uc->file_big_endian != maybe_uc->local_big_endian);
-		src = ufbxi_swap_endian_array(maybe_uc, src, size, src_type);
-		ufbxi_check_err(&maybe_uc->error, src);
-		memcpy(dst, src, size * ufbxi_array_type_size(dst_type));
+		switch (src_type) {
+		case 'i': case 'f': ufbxi_bswap_32(dst, src, size); break;
+		case 'l': case 'd': ufbxi_bswap_64(dst, src, size); break;
+		default: memcpy(dst, src, size * ufbxi_array_type_size(dst_type)); break;
+		}
 		return 1;
 	}
 
@@ -8740,7 +9729,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_binary_convert_array(ufbxi_conte
 		case 'i': ufbxi_convert_loop_slow(float, (float), 4, ufbxi_read_i32(val)); break;
 		case 'l': ufbxi_convert_loop_slow(float, (float), 8, ufbxi_read_i64(val)); break;
 		// case 'f': ufbxi_convert_loop_slow(float, (float), 4, ufbxi_read_f32(val)); break;
-		case 'd': ufbxi_convert_loop_fast(float, (float), 8, ufbxi_read_f64(val)); break;
+		case 'd': ufbxi_convert_f64_to_f32((float*)dst, src, size); break;
 		default: if (maybe_uc) ufbxi_fail_err(&maybe_uc->error, "Bad array source type"); return 0;
 		}
 		break;
@@ -8750,7 +9739,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_binary_convert_array(ufbxi_conte
 		case 'c': ufbxi_convert_loop_slow(double, (double), 1, *val); break;
 		case 'i': ufbxi_convert_loop_slow(double, (double), 4, ufbxi_read_i32(val)); break;
 		case 'l': ufbxi_convert_loop_slow(double, (double), 8, ufbxi_read_i64(val)); break;
-		case 'f': ufbxi_convert_loop_fast(double, (double), 4, ufbxi_read_f32(val)); break;
+		case 'f': ufbxi_convert_f32_to_f64((double*)dst, src, size); break;
 		// case 'd': ufbxi_convert_loop_slow(double, (double), 8, ufbxi_read_f64(val)); break;
 		default: if (maybe_uc) ufbxi_fail_err(&maybe_uc->error, "Bad array source type"); return 0;
 		}
@@ -9082,9 +10071,24 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_binary_parse_node(ufbxi_context
 			size_t src_elem_size = ufbxi_array_type_size(src_type);
 			size_t decoded_data_size = src_elem_size * size;
 
+			// Uncompressed arrays already in the right format can be referenced directly
+			// from the user memory if they are suitably aligned.
+			bool no_copy = false;
+			if (uc->no_copy_arrays && (arr_info.flags & UFBXI_ARRAY_FLAG_NO_COPY) != 0 && encoding == 0 && src_type == dst_type && !uc->file_big_endian && !uc->local_big_endian) {
+				no_copy = encoded_size == decoded_data_size && uc->yield_size + uc->data_size >= encoded_size
+					&& ((uintptr_t)uc->data & (src_elem_size - 1)) == 0;
+			}
+
 			// Allocate `size` elements for the array.
-			char *arr_data = (char*)ufbxi_push_array_data(uc, &arr_info, size, tmp_buf);
-			ufbxi_check(arr_data);
+			char *arr_data = NULL;
+			if (no_copy) {
+				arr_data = (char*)uc->data;
+				ufbxi_stats_add(uc, num_no_copy_arrays, 1);
+				ufbxi_stats_add(uc, no_copy_array_bytes, encoded_size);
+			} else {
+				arr_data = (char*)ufbxi_push_array_data(uc, &arr_info, size, tmp_buf);
+				ufbxi_check(arr_data);
+			}
 
 			uint64_t arr_begin = ufbxi_get_read_offset(uc);
 			ufbxi_check(UINT64_MAX - encoded_size > arr_begin);
@@ -9093,10 +10097,17 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_binary_parse_node(ufbxi_context
 				uc->progress_bytes_total = arr_end;
 			}
 
+			if (encoding == 1) {
+				ufbxi_stats_add(uc, num_deflate_arrays, 1);
+				ufbxi_stats_add(uc, deflate_bytes_in, encoded_size);
+				ufbxi_stats_add(uc, deflate_bytes_out, decoded_data_size);
+			}
+
 			// Threading
 			if (uc->parse_threaded && encoding == 1 && encoded_size >= UFBXI_MIN_THREADED_DEFLATE_BYTES && !uc->file_big_endian && !uc->local_big_endian) {
 				ufbxi_task *task = ufbxi_thread_pool_create_task(&uc->thread_pool, &ufbxi_deflate_task_fn);
 				if (task) {
+					ufbxi_stats_add(uc, num_deflate_tasks, 1);
 					ufbxi_deflate_task *t = ufbxi_push_zero(tmp_buf, ufbxi_deflate_task, 1);
 					ufbxi_check(t);
 
@@ -9151,8 +10162,9 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_binary_parse_node(ufbxi_context
 
 				// If the array is contained in the current read buffer and we need to convert
 				// the data anyway we can use the read buffer as the decoded array source, otherwise
-				// do a plain byte copy to the array/conversion buffer.
-				if (uc->yield_size + uc->data_size >= encoded_size && decoded_data != arr_data) {
+				// do a plain byte copy to the array/conversion buffer. Arrays referencing the
+				// source memory already point to `uc->data` and only need to be consumed.
+				if (uc->yield_size + uc->data_size >= encoded_size && (decoded_data != arr_data || no_copy)) {
 					// Yield right after this if we crossed the yield threshold
 					if (encoded_size > uc->yield_size) {
 						uc->data_size += uc->yield_size;
@@ -9218,7 +10230,9 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_binary_parse_node(ufbxi_context
 					ufbxi_check(ufbxi_resume_progress(uc));
 				}
 
+				ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_INFLATE);
 				ptrdiff_t res = ufbx_inflate(decoded_data, decoded_data_size, &input, uc->inflate_retain);
+				ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_PARSE);
 				ufbxi_check_msg(res != -28, "Cancelled");
 				ufbxi_check_msg(res == (ptrdiff_t)decoded_data_size, "Bad DEFLATE data");
 
@@ -9549,6 +10563,65 @@ static ufbxi_forceinline bool ufbxi_is_space(char c)
 	return v < 32 && ((ufbxi_space_mask >> v) & 0x1) != 0;
 }
 
+// Parse a list of numbers from `[src, end)` to either `dst_f64` or `dst_f32`, results are
+// identical to calling `ufbxi_parse_double()` for each number. Whitespace around values is
+// ignored. If `separator` is non-zero, a value is only accepted if it is followed by it,
+// otherwise values must be followed by whitespace or `end`. Returns the position after the
+// last accepted value (and separator) and the number of values in `*p_num`, or `NULL` if
+// there are more than `max_values` values.
+static ufbxi_noinline const char *ufbxi_parse_double_list(double *dst_f64, float *dst_f32, size_t max_values, size_t *p_num, const char *src, const char *end, char separator, uint32_t flags)
+{
+	// Numbers close to `end` are parsed from a zero-padded copy so that
+	// `ufbxi_parse_double_simple()` can always read past them.
+	char tail[UFBXI_PARSE_DOUBLE_SIMPLE_LENGTH * 2 + 16]; // ufbxi_uninit
+	bool in_tail = false;
+
+	// Progress is tracked as an offset from `begin` as `src` may point to `tail`.
+	const char *begin = src, *base = src;
+	size_t base_offset = 0, accepted = 0;
+
+	size_t num = 0;
+	for (;;) {
+		if (!in_tail && (flags & UFBXI_PARSE_DOUBLE_ALLOW_FAST_PATH) != 0 && ufbxi_to_size(end - src) < UFBXI_PARSE_DOUBLE_SIMPLE_LENGTH) {
+			size_t left = ufbxi_to_size(end - src);
+			memcpy(tail, src, left);
+			memset(tail + left, 0, sizeof(tail) - left);
+			in_tail = true;
+			base_offset = ufbxi_to_size(src - begin);
+			base = src = tail;
+			end = tail + left;
+		}
+
+		while (src != end && ufbxi_is_space(*src)) src++;
+		if (src == end) break;
+
+		char *num_end; // ufbxi_uninit
+		double value = ufbxi_parse_double_fast(src, ufbxi_to_size(end - src), &num_end, flags);
+
+		const char *next = num_end;
+		while (next != end && ufbxi_is_space(*next)) next++;
+		if (separator) {
+			if (next == end || *next != separator) break;
+			next++;
+		} else if (next == num_end && next != end) {
+			break;
+		}
+
+		if (num >= max_values) return NULL;
+		if (dst_f64) {
+			dst_f64[num] = value;
+		} else {
+			dst_f32[num] = (float)value;
+		}
+		num++;
+		src = next;
+		accepted = base_offset + ufbxi_to_size(src - base);
+	}
+
+	*p_num = num;
+	return begin + accepted;
+}
+
 static ufbxi_noinline char ufbxi_ascii_skip_whitespace(ufbxi_context *uc)
 {
 	ufbxi_ascii *ua = &uc->ascii;
@@ -9636,6 +10709,93 @@ ufbxi_nodiscard static ufbxi_forceinline int ufbxi_ascii_push_token_string(ufbxi
 	return 1;
 }
 
+static ufbxi_forceinline bool ufbxi_ascii_pretoken_has_string(char type)
+{
+	return type == UFBXI_ASCII_STRING || type == UFBXI_ASCII_NAME || type == UFBXI_ASCII_BARE_WORD;
+}
+
+static ufbxi_forceinline size_t ufbxi_ascii_pretoken_size(const ufbxi_ascii_pretoken *token)
+{
+	size_t str_len = ufbxi_ascii_pretoken_has_string(token->type) ? token->value.str_len : 0;
+	return sizeof(ufbxi_ascii_pretoken) + str_len;
+}
+
+// Find a token lexed ahead of time that begins at the current position.
+// Tokens are only used on an exact position match, so any source position the
+// lexer may have skipped to via the raw fast paths is handled transparently.
+static ufbxi_noinline const ufbxi_ascii_pretoken *ufbxi_ascii_find_pretoken(ufbxi_ascii *ua, const ufbxi_parse_task **p_section)
+{
+	const char *src = ua->src;
+	for (;;) {
+		const ufbxi_ascii_window *window = &ua->windows[ua->cursor_window];
+		if (!window->ready) return NULL;
+
+		if (ua->cursor_section < window->num_sections) {
+			const ufbxi_parse_task *section = &window->sections[ua->cursor_section];
+			if (src < section->begin) return NULL;
+
+			while (ua->cursor_offset < section->records_size) {
+				const ufbxi_ascii_pretoken *token = (const ufbxi_ascii_pretoken*)(section->records + ua->cursor_offset);
+				const char *begin = section->begin + token->begin;
+				if (begin == src) {
+					*p_section = section;
+					return token;
+				} else if (begin > src) {
+					return NULL;
+				}
+				ua->cursor_offset = ufbxi_align_to_mask(ua->cursor_offset + ufbxi_ascii_pretoken_size(token), 7);
+			}
+
+			// The section may have been only partially lexed
+			if (src < section->end) return NULL;
+			ua->cursor_section++;
+			ua->cursor_offset = 0;
+		} else {
+			// NOTE: Compare the current offset as the next one wraps to zero if all the windows are in use
+			size_t window_offset = (ua->cursor_window + UFBXI_ASCII_WINDOW_COUNT - ua->first_window) % UFBXI_ASCII_WINDOW_COUNT;
+			if (window_offset + 1 >= ua->num_windows) return NULL;
+			ua->cursor_window = (ua->cursor_window + 1) % UFBXI_ASCII_WINDOW_COUNT;
+			ua->cursor_section = 0;
+			ua->cursor_offset = 0;
+		}
+	}
+}
+
+static ufbxi_forceinline bool ufbxi_ascii_has_pretoken(ufbxi_ascii *ua)
+{
+	const ufbxi_parse_task *section = NULL;
+	return ua->num_windows > 0 && ufbxi_ascii_find_pretoken(ua, &section) != NULL;
+}
+
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_use_pretoken(ufbxi_context *uc, ufbxi_ascii_token *token, const ufbxi_ascii_pretoken *pre, const ufbxi_parse_task *section)
+{
+	ufbxi_ascii *ua = &uc->ascii;
+
+	token->type = pre->type;
+	token->negative = pre->negative;
+	token->str_len = 0;
+	if (pre->type == UFBXI_ASCII_INT) {
+		token->value.i64 = pre->value.i64;
+	} else if (pre->type == UFBXI_ASCII_FLOAT) {
+		token->value.f64 = pre->value.f64;
+	} else if (ufbxi_ascii_pretoken_has_string(pre->type)) {
+		ufbxi_check(ufbxi_ascii_push_token_string(uc, token, (const char*)(pre + 1), pre->value.str_len));
+		if (pre->type == UFBXI_ASCII_NAME) {
+			token->value.name_len = token->str_len;
+		}
+	}
+
+	ua->src = section->begin + pre->end;
+	ua->cursor_offset = ufbxi_align_to_mask(ufbxi_to_size((const char*)pre - section->records) + ufbxi_ascii_pretoken_size(pre), 7);
+
+	// Report progress as if we would have advanced normally
+	if (ua->src >= ua->src_yield) {
+		ufbxi_check(ufbxi_ascii_yield(uc) != '\0');
+	}
+
+	return 1;
+}
+
 ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_skip_until(ufbxi_context *uc, char dst)
 {
 	ufbxi_ascii *ua = &uc->ascii;
@@ -9747,6 +10907,17 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_next_token(ufbxi_context *
 	ua->token.str_data = swap_data;
 	ua->token.str_cap = swap_cap;
 
+	// Use a token lexed ahead of time if available, floats lexed without
+	// context need to be re-parsed if the destination is 32-bit.
+	if (ua->num_windows > 0) {
+		const ufbxi_parse_task *section = NULL;
+		const ufbxi_ascii_pretoken *pre = ufbxi_ascii_find_pretoken(ua, &section);
+		if (pre && !(pre->type == UFBXI_ASCII_FLOAT && ua->parse_as_f32)) {
+			ufbxi_check(ufbxi_ascii_use_pretoken(uc, token, pre, section));
+			return 1;
+		}
+	}
+
 	char c = ufbxi_ascii_skip_whitespace(uc);
 	token->str_len = 0;
 
@@ -9911,6 +11082,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_ascii_read_int_array(ufbxi_conte
 {
 	ufbxi_ascii *ua = &uc->ascii;
 	if (ua->parse_as_f32) return 1;
+	if (ufbxi_ascii_has_pretoken(ua)) return 1;
 	size_t initial_items = uc->tmp_stack.num_items;
 
 	int64_t val;
@@ -9978,32 +11150,12 @@ ufbxi_noinline static const char *ufbxi_ascii_array_task_parse_floats(ufbxi_asci
 	float *dst_float = t->arr_type == 'f' ? (float*)t->arr_data + offset : NULL;
 	double *dst_double = t->arr_type == 'd' ? (double*)t->arr_data + offset : NULL;
 	ufbx_assert(dst_float || dst_double);
-	const char *src_begin = src;
 
-	while (src != src_end) {
-		while (ufbxi_is_space(*src)) src++;
+	size_t num_values = 0;
+	const char *src_begin = ufbxi_parse_double_list(dst_double, dst_float, t->arr_size - offset, &num_values, src, src_end, ',', parse_flags);
+	if (!src_begin) return NULL;
 
-		// Try to parse the next value, we don't commit this until we find a comma after it above.
-		char *num_end = NULL;
-		double val = ufbxi_parse_double(src, ufbxi_to_size(src_end - src), &num_end, parse_flags);
-		if (!num_end) return src_begin;
-		src = num_end;
-
-		while (ufbxi_is_space(*src)) src++;
-		if (*src != ',') break;
-		src++;
-		src_begin = src;
-
-		if (offset >= t->arr_size) return NULL;
-		if (dst_double) {
-			*dst_double++ = val;
-		} else {
-			*dst_float++ = (float)val;
-		}
-		offset++;
-	}
-
-	t->offset = offset;
+	t->offset = offset + num_values;
 	return src_begin;
 }
 
@@ -10157,10 +11309,105 @@ ufbxi_noinline static bool ufbxi_ascii_array_task_fn(ufbxi_task *task)
 	return true;
 }
 
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_run_array_range(ufbxi_context *uc, ufbxi_buf *tmp_buf, const ufbxi_ascii_array_task *array,
+	size_t first_span, size_t last_span, const char *begin, const char *end, size_t offset, size_t count)
+{
+	size_t num_spans = last_span - first_span + 1;
+	ufbxi_ascii_span *spans = ufbxi_push_copy(tmp_buf, ufbxi_ascii_span, num_spans, array->spans + first_span);
+	ufbxi_check(spans);
+
+	// Trim the spans to `[begin, end)`, `end == NULL` means the end of the last span.
+	spans[0].length -= ufbxi_to_size(begin - spans[0].source);
+	spans[0].source = begin;
+	if (end) {
+		spans[num_spans - 1].length = ufbxi_to_size(end - spans[num_spans - 1].source);
+	}
+
+	ufbxi_ascii_array_task t = *array;
+	t.arr_data = (char*)array->arr_data + offset * ufbxi_array_type_size(array->arr_type);
+	t.arr_size = count;
+	t.spans = spans;
+	t.num_spans = num_spans;
+	t.offset = 0;
+
+	ufbxi_task *task = ufbxi_thread_pool_create_task(&uc->thread_pool, &ufbxi_ascii_array_task_fn);
+	if (task) {
+		ufbxi_stats_add(uc, num_ascii_array_tasks, 1);
+		task->data = ufbxi_push_copy(tmp_buf, ufbxi_ascii_array_task, 1, &t);
+		ufbxi_check(task->data);
+		ufbxi_thread_pool_run_task(&uc->thread_pool, task);
+	} else {
+		ufbxi_check_msg(ufbxi_ascii_array_task_imp(&t), "Threaded ASCII parse error");
+	}
+
+	return 1;
+}
+
+// Parse a deferred array in tasks. Large arrays are split after commas into ranges of
+// roughly `UFBXI_ASCII_ARRAY_TASK_SIZE` bytes, counting the values in each range to find
+// where the next one starts in the output. Every range must parse exactly the counted
+// values, so a miscount results in an error instead of misplaced data.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_run_array_tasks(ufbxi_context *uc, ufbxi_buf *tmp_buf, const ufbxi_ascii_array_task *array)
+{
+	ufbx_assert(array->num_spans > 0);
+
+	size_t total_length = 0;
+	ufbxi_for(const ufbxi_ascii_span, span, array->spans, array->num_spans) {
+		total_length += span->length;
+	}
+
+	size_t range_span = 0, range_values = 0, range_length = 0, offset = 0;
+	const char *range_begin = array->spans[0].source;
+	bool has_value = false;
+
+	// Counting is not worth it if we would not split, also stop at the first
+	// comment or string as those could contain commas that are not separators.
+	bool splittable = total_length >= UFBXI_ASCII_ARRAY_TASK_SIZE * 2;
+	for (size_t span_ix = 0; splittable && span_ix < array->num_spans; span_ix++) {
+		const char *src = span_ix == range_span ? range_begin : array->spans[span_ix].source;
+		const char *end = array->spans[span_ix].source + array->spans[span_ix].length;
+
+		while (src != end) {
+			char c = *src++;
+			range_length++;
+			if (c == ',') {
+				if (has_value) range_values++;
+				has_value = false;
+
+				if (range_length >= UFBXI_ASCII_ARRAY_TASK_SIZE && offset + range_values < array->arr_size) {
+					ufbxi_check(ufbxi_ascii_run_array_range(uc, tmp_buf, array, range_span, span_ix, range_begin, src, offset, range_values));
+					offset += range_values;
+					range_values = 0;
+					range_length = 0;
+					range_span = span_ix;
+					range_begin = src;
+				}
+			} else if (c == ';' || c == '"') {
+				splittable = false;
+				break;
+			} else if (!ufbxi_is_space(c)) {
+				has_value = true;
+			}
+		}
+
+		// Move to the next span if the last range ended exactly at the end of this one
+		if (range_span == span_ix && range_begin == end && span_ix + 1 < array->num_spans) {
+			range_span = span_ix + 1;
+			range_begin = array->spans[span_ix + 1].source;
+		}
+	}
+
+	// The rest of the values go to the final range, it always contains the closing '}'
+	ufbxi_check(ufbxi_ascii_run_array_range(uc, tmp_buf, array, range_span, array->num_spans - 1, range_begin, NULL, offset, array->arr_size - offset));
+
+	return 1;
+}
+
 ufbxi_nodiscard static ufbxi_noinline int ufbxi_ascii_read_float_array(ufbxi_context *uc, char type, size_t *p_num_read)
 {
 	ufbxi_ascii *ua = &uc->ascii;
 	if (ua->parse_as_f32) return 1;
+	if (ufbxi_ascii_has_pretoken(ua)) return 1;
 
 	double val;
 	if (ua->token.type == UFBXI_ASCII_FLOAT) {
@@ -10203,7 +11450,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_ascii_read_float_array(ufbxi_con
 		// Try to parse the next value, we don't commit this until we find a comma after it above.
 		char *num_end = NULL;
 		size_t left = ufbxi_to_size(end - src_scan);
-		val = ufbxi_parse_double(src_scan, left, &num_end, parse_flags);
+		val = ufbxi_parse_double_fast(src_scan, left, &num_end, parse_flags);
 		if (!num_end || num_end == src_scan || num_end >= end) {
 			break;
 		}
@@ -10649,15 +11896,7 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_parse_node(ufbxi_context *
 				t.spans = spans;
 				t.offset = 0;
 
-				// TODO: Split these further
-				ufbxi_task *task = ufbxi_thread_pool_create_task(&uc->thread_pool, &ufbxi_ascii_array_task_fn);
-				if (task) {
-					task->data = ufbxi_push_copy(tmp_buf, ufbxi_ascii_array_task, 1, &t);
-					ufbxi_check(task->data);
-					ufbxi_thread_pool_run_task(&uc->thread_pool, task);
-				} else {
-					ufbxi_check_msg(ufbxi_ascii_array_task_imp(&t), "Threaded ASCII parse error");
-				}
+				ufbxi_check(ufbxi_ascii_run_array_tasks(uc, tmp_buf, &t));
 			}
 		}
 	} else {
@@ -10693,6 +11932,440 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_parse_node(ufbxi_context *
 	return 1;
 }
 
+// -- Threaded ASCII lexing
+
+// The children of the ASCII `Objects` node are split at top-level node boundaries
+// into windows of sections that are lexed in thread pool tasks. The parser picks up
+// the pre-lexed tokens in `ufbxi_ascii_next_token()` when it reaches their position.
+
+// Lexer state for `ufbxi_ascii_lex_section()`. This matches `ufbxi_ascii_next_token()`
+// for data that is fully in memory, but instead of refilling, growing buffers or
+// reporting errors it stops and leaves the rest of the section to the main lexer.
+typedef struct {
+	const char *src;
+	const char *src_end;
+
+	// Set when trying to read past `src_end`, the token may depend on the following data.
+	bool at_end;
+
+	char *str_data;
+	size_t str_len;
+	size_t str_cap;
+} ufbxi_ascii_lexer;
+
+static ufbxi_forceinline char ufbxi_ascii_lexer_peek(ufbxi_ascii_lexer *lx)
+{
+	if (lx->src == lx->src_end) {
+		lx->at_end = true;
+		return '\0';
+	}
+	return *lx->src;
+}
+
+static ufbxi_forceinline char ufbxi_ascii_lexer_next(ufbxi_ascii_lexer *lx)
+{
+	if (lx->src != lx->src_end) lx->src++;
+	return ufbxi_ascii_lexer_peek(lx);
+}
+
+static ufbxi_forceinline bool ufbxi_ascii_lexer_push(ufbxi_ascii_lexer *lx, char c)
+{
+	if (lx->str_len == lx->str_cap) return false;
+	lx->str_data[lx->str_len++] = c;
+	return true;
+}
+
+static ufbxi_noinline char ufbxi_ascii_lexer_skip_whitespace(ufbxi_ascii_lexer *lx)
+{
+	char c = ufbxi_ascii_lexer_peek(lx);
+	for (;;) {
+		while (ufbxi_is_space(c)) {
+			c = ufbxi_ascii_lexer_next(lx);
+		}
+
+		// Line comment, the magic version comment is always handled by the main lexer
+		if (c == ';') {
+			c = ufbxi_ascii_lexer_next(lx);
+			while (c != '\n' && c != '\0') {
+				c = ufbxi_ascii_lexer_next(lx);
+			}
+			c = ufbxi_ascii_lexer_next(lx);
+		} else {
+			break;
+		}
+	}
+	return c;
+}
+
+// Lex the next token to `token`, string data is written to `lx->str_data`.
+// Returns `false` if the token should be left to the main lexer.
+static ufbxi_noinline bool ufbxi_ascii_lexer_next_token(ufbxi_ascii_lexer *lx, ufbxi_ascii_pretoken *token, uint32_t parse_flags)
+{
+	char c = ufbxi_ascii_lexer_skip_whitespace(lx);
+	lx->str_len = 0;
+	token->negative = false;
+
+	if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_') {
+		token->type = UFBXI_ASCII_BARE_WORD;
+		while ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')
+			|| (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '(' || c == ')') {
+			if (!ufbxi_ascii_lexer_push(lx, c)) return false;
+			c = ufbxi_ascii_lexer_next(lx);
+		}
+
+		// Skip whitespace to find if there's a following ':'
+		c = ufbxi_ascii_lexer_skip_whitespace(lx);
+		if (c == ':') {
+			token->type = UFBXI_ASCII_NAME;
+			ufbxi_ascii_lexer_next(lx);
+		}
+	} else if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.') {
+		token->type = UFBXI_ASCII_INT;
+
+		token->negative = c == '-';
+		while ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+			if (c == '.' || c == 'e' || c == 'E') {
+				token->type = UFBXI_ASCII_FLOAT;
+			}
+			if (!ufbxi_ascii_lexer_push(lx, c)) return false;
+			c = ufbxi_ascii_lexer_next(lx);
+		}
+
+		bool nan_like = false;
+		while ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '#' || c == '(' || c == ')') {
+			nan_like = true;
+			if (!ufbxi_ascii_lexer_push(lx, c)) return false;
+			c = ufbxi_ascii_lexer_next(lx);
+		}
+		if (!ufbxi_ascii_lexer_push(lx, '\0')) return false;
+		if (nan_like) {
+			token->type = UFBXI_ASCII_FLOAT;
+		}
+
+		char *end;
+		if (token->type == UFBXI_ASCII_INT) {
+			token->value.i64 = ufbxi_parse_int64(lx->str_data, &end);
+		} else {
+			token->value.f64 = ufbxi_parse_double(lx->str_data, lx->str_len, &end, parse_flags);
+		}
+		if (end != lx->str_data + lx->str_len - 1) return false;
+	} else if (c == '"') {
+		token->type = UFBXI_ASCII_STRING;
+		c = ufbxi_ascii_lexer_next(lx);
+		while (c != '"') {
+
+			// Optimized string parsing for non-special characters
+			if (lx->src + 1 < lx->src_end) {
+				const char *begin = lx->src;
+				const char *end = lx->src_end;
+				const char *quot = (const char*)memchr(begin, '"', ufbxi_to_size(end - begin));
+				if (quot) end = quot;
+				const char *esc = (const char*)memchr(begin, '&', ufbxi_to_size(end - begin));
+				if (esc) end = esc;
+
+				size_t length = ufbxi_to_size(end - begin);
+				if (length > 0) {
+					if (length > lx->str_cap - lx->str_len) return false;
+					memcpy(lx->str_data + lx->str_len, begin, length);
+					lx->str_len += length;
+					lx->src = end;
+					c = ufbxi_ascii_lexer_peek(lx);
+					continue;
+				}
+			}
+
+			// XML-like entities, see `ufbxi_ascii_next_token()`
+			if (c == '&') {
+				const char *entity = NULL;
+				char replacement = '\0';
+
+				c = ufbxi_ascii_lexer_next(lx);
+				switch (c) {
+				case 'q':
+					entity = "&quot;";
+					replacement = '"';
+					break;
+				case 'c':
+					entity = "&cr;";
+					replacement = '\r';
+					break;
+				case 'l':
+					entity = "&lf;";
+					replacement = '\n';
+					break;
+				default:
+					entity = "&";
+					replacement = '&';
+					break;
+				}
+
+				size_t step = 1;
+				// cppcheck-suppress arrayIndexOutOfBounds
+				for (; entity[step]; step++) {
+					if (c != entity[step]) break;
+					c = ufbxi_ascii_lexer_next(lx);
+				}
+
+				if (entity[step] == '\0') {
+					if (!ufbxi_ascii_lexer_push(lx, replacement)) return false;
+				} else {
+					for (size_t i = 0; i < step; i++) {
+						if (!ufbxi_ascii_lexer_push(lx, entity[i])) return false;
+					}
+				}
+				continue;
+			}
+
+			if (c == '\0') return false;
+			if (!ufbxi_ascii_lexer_push(lx, c)) return false;
+			c = ufbxi_ascii_lexer_next(lx);
+		}
+
+		// Skip closing quote, legacy names may be quoted, see `ufbxi_ascii_next_token()`
+		if (ufbxi_ascii_lexer_next(lx) == ':') {
+			token->type = UFBXI_ASCII_NAME;
+			ufbxi_ascii_lexer_next(lx);
+		}
+	} else {
+		// Single character token
+		if (c == '\0') return false;
+		token->type = c;
+		ufbxi_ascii_lexer_next(lx);
+	}
+
+	if (ufbxi_ascii_pretoken_has_string(token->type)) {
+		token->value.str_len = (uint32_t)lx->str_len;
+	}
+	return true;
+}
+
+// Lex `section` into `ufbxi_ascii_pretoken` records until running out of space.
+ufbxi_noinline static void ufbxi_ascii_lex_section(ufbxi_parse_task *section)
+{
+	ufbxi_ascii_lexer lx; // ufbxi_uninit
+	lx.src = section->begin;
+	lx.src_end = section->end;
+	lx.at_end = false;
+
+	// Types of the three previous tokens
+	char prev_type[3] = { 0 };
+
+	while (lx.src != section->end) {
+		const char *begin = lx.src;
+
+		size_t space; // ufbxi_uninit
+		char *record = ufbxi_parse_task_reserve(section, sizeof(ufbxi_ascii_pretoken), &space);
+		if (!record) break;
+
+		ufbxi_ascii_pretoken *token = (ufbxi_ascii_pretoken*)record;
+		lx.str_data = (char*)(token + 1);
+		lx.str_cap = space - sizeof(ufbxi_ascii_pretoken);
+		if (!ufbxi_ascii_lexer_next_token(&lx, token, section->double_parse_flags)) break;
+
+		// Tokens that reached the end of the section may depend on the data past it,
+		// except for the closing '}' that sections are split after.
+		if (lx.at_end && token->type != '}') break;
+
+		token->begin = (uint32_t)(begin - section->begin);
+		token->end = (uint32_t)((lx.at_end ? section->end : lx.src) - section->begin);
+		ufbxi_parse_task_commit(section, record, ufbxi_ascii_pretoken_size(token));
+		if (lx.at_end) break;
+
+		// Skip the contents of `*N { a: ... }` arrays as they are parsed either
+		// in separate tasks or using the raw fast paths.
+		if (token->type == UFBXI_ASCII_NAME && prev_type[0] == '{' && prev_type[1] == UFBXI_ASCII_INT && prev_type[2] == '*') {
+			const char *close = (const char*)memchr(lx.src, '}', ufbxi_to_size(section->end - lx.src));
+			if (!close) break;
+			lx.src = close;
+		}
+
+		prev_type[2] = prev_type[1];
+		prev_type[1] = prev_type[0];
+		prev_type[0] = token->type;
+	}
+
+	section->parsed_end = lx.src;
+}
+
+ufbxi_noinline static bool ufbxi_ascii_section_task_fn(ufbxi_task *task)
+{
+	ufbxi_ascii_lex_section((ufbxi_parse_task*)task->data);
+	return true;
+}
+
+// Each byte of source can expand to a few bytes of tokens, anything that doesn't fit
+// in the section buffer is left to the main lexer.
+#define UFBXI_ASCII_PRETOKEN_BYTES_PER_BYTE 12
+
+// Split the next top-level children of `Objects` into a window and start lexing its
+// sections. Splitting only needs to track brace depth and skip strings and comments.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_dispatch_window(ufbxi_context *uc)
+{
+	ufbxi_ascii *ua = &uc->ascii;
+	ufbx_assert(ua->scan_pos && ua->num_windows < UFBXI_ASCII_WINDOW_COUNT);
+
+	size_t section_size = UFBXI_ASCII_SECTION_SIZE;
+	size_t max_sections = ua->window_size / section_size + 2;
+
+	ufbxi_ascii_window *window = &ua->windows[(ua->first_window + ua->num_windows) % UFBXI_ASCII_WINDOW_COUNT];
+	ufbxi_buf_clear(&window->buf);
+	window->sections = ufbxi_push_zero(&window->buf, ufbxi_parse_task, max_sections);
+	ufbxi_check(window->sections);
+	window->num_sections = 0;
+	window->ready = false;
+
+	const char *begin = ua->scan_pos, *pos = begin, *end = ua->src_end;
+	const char *section_begin = begin;
+	size_t depth = 0;
+	bool done = false;
+	while (pos != end) {
+		char c = *pos++;
+		if (c == '"' || c == ';') {
+			const char *match = (const char*)memchr(pos, c == ';' ? '\n' : '"', ufbxi_to_size(end - pos));
+			pos = match ? match + 1 : end;
+		} else if (c == '{') {
+			depth++;
+		} else if (c == '}') {
+			if (depth == 0) {
+				// Closing brace of `Objects`
+				pos--;
+				done = true;
+				break;
+			}
+			depth--;
+			if (depth == 0 && ufbxi_to_size(pos - section_begin) >= section_size) {
+				ufbxi_parse_task *section = &window->sections[window->num_sections++];
+				section->begin = section_begin;
+				section->end = pos;
+				section_begin = pos;
+				if (ufbxi_to_size(pos - begin) >= ua->window_size) break;
+			}
+		}
+	}
+
+	if (pos == end) done = true;
+	if (done && pos != section_begin) {
+		ufbxi_parse_task *section = &window->sections[window->num_sections++];
+		section->begin = section_begin;
+		section->end = pos;
+	}
+	ufbx_assert(window->num_sections <= max_sections);
+
+	ua->scan_pos = done ? NULL : pos;
+	if (window->num_sections == 0) return 1;
+
+	window->begin = begin;
+	window->end = pos;
+	ua->num_windows++;
+
+	ufbxi_for(ufbxi_parse_task, section, window->sections, window->num_sections) {
+		size_t length = ufbxi_to_size(section->end - section->begin);
+		size_t capacity = ufbxi_min_sz(length, section_size * 2);
+
+		// Running out of space just leaves the rest of the section to the main lexer
+		section->parsed_end = section->begin;
+		section->double_parse_flags = uc->double_parse_flags;
+		size_t num_words = length <= UINT32_MAX ? (capacity * UFBXI_ASCII_PRETOKEN_BYTES_PER_BYTE + 64) / 8 : 0;
+		uint64_t *records = ufbxi_push(&window->buf, uint64_t, num_words);
+		ufbxi_check(records);
+		section->records = (char*)records;
+		section->records_cap = num_words * 8;
+
+		ufbxi_task *task = ufbxi_thread_pool_create_task(&uc->thread_pool, &ufbxi_ascii_section_task_fn);
+		if (task) {
+			ufbxi_stats_add(uc, num_ascii_section_tasks, 1);
+			task->data = section;
+			ufbxi_thread_pool_run_task(&uc->thread_pool, task);
+		} else {
+			ufbxi_ascii_lex_section(section);
+		}
+	}
+	window->task_end = uc->thread_pool.start_index;
+
+	return 1;
+}
+
+// Start lexing the children of `Objects` ahead of time if the whole file is in memory.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_begin_windows(ufbxi_context *uc)
+{
+	ufbxi_ascii *ua = &uc->ascii;
+	if (!uc->from_ascii || uc->read_fn || uc->opts.force_single_thread_ascii_parsing) return 1;
+	if (!uc->top_node || uc->top_child_index != SIZE_MAX || !uc->has_next_child) return 1;
+
+	// The main lexer may still need to parse the version from the first comment
+	if (!ua->read_first_comment || ua->token.type != UFBXI_ASCII_NAME) return 1;
+
+	// Lexing ahead doesn't pay off for small files
+	if (ufbxi_to_size(ua->src_end - ua->src) < UFBXI_MIN_THREADED_ASCII_LEX_BYTES) return 1;
+
+	ufbxi_nounroll for (size_t i = 0; i < UFBXI_ASCII_WINDOW_COUNT; i++) {
+		ufbxi_buf *buf = &ua->windows[i].buf;
+		buf->ator = &uc->ator_tmp;
+		buf->unordered = true;
+		buf->clearable = true;
+	}
+
+	// Keep the lexed tokens of all the windows within the thread memory limit,
+	// each byte of source needs up to ~13 bytes of tokens and string data.
+	size_t window_size = uc->opts.thread_opts.memory_limit / (UFBXI_ASCII_WINDOW_COUNT * 16);
+	window_size = ufbxi_max_sz(window_size, UFBXI_ASCII_SECTION_SIZE);
+	window_size = ufbxi_min_sz(window_size, UFBXI_ASCII_SECTION_SIZE * 16);
+
+	ua->window_size = window_size;
+	ua->scan_pos = ua->src;
+
+	// Dispatch a window for each group so they are ready in turn
+	ufbxi_nounroll for (size_t i = 0; i < UFBX_THREAD_GROUP_COUNT; i++) {
+		if (ua->scan_pos) {
+			ufbxi_check(ufbxi_ascii_dispatch_window(uc));
+		}
+		ufbxi_thread_pool_flush_group(&uc->thread_pool);
+	}
+
+	return 1;
+}
+
+// Called after waiting for the current thread pool group: Marks the windows whose tasks
+// have been waited for as ready, releases windows the parser has moved past and starts a new one.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_ascii_update_windows(ufbxi_context *uc)
+{
+	ufbxi_ascii *ua = &uc->ascii;
+	if (ua->num_windows == 0 && !ua->scan_pos) return 1;
+
+	uint32_t wait_index = uc->thread_pool.wait_index;
+	for (size_t i = 0; i < ua->num_windows; i++) {
+		ufbxi_ascii_window *window = &ua->windows[(ua->first_window + i) % UFBXI_ASCII_WINDOW_COUNT];
+		if (window->task_end <= wait_index) window->ready = true;
+	}
+
+	while (ua->num_windows > 0 && ua->first_window != ua->cursor_window) {
+		ua->first_window = (ua->first_window + 1) % UFBXI_ASCII_WINDOW_COUNT;
+		ua->num_windows--;
+	}
+
+	if (ua->scan_pos && ua->num_windows < UFBXI_ASCII_WINDOW_COUNT) {
+		ufbxi_check(ufbxi_ascii_dispatch_window(uc));
+	}
+
+	return 1;
+}
+
+// Returns `true` if the parser has reached a window that is still being lexed.
+static ufbxi_noinline bool ufbxi_ascii_windows_stalled(ufbxi_ascii *ua)
+{
+	for (size_t i = 0; i < ua->num_windows; i++) {
+		ufbxi_ascii_window *window = &ua->windows[(ua->first_window + i) % UFBXI_ASCII_WINDOW_COUNT];
+		if (!window->ready) return ua->src >= window->begin;
+	}
+	return false;
+}
+
+static ufbxi_noinline void ufbxi_ascii_end_windows(ufbxi_ascii *ua)
+{
+	ua->num_windows = 0;
+	ua->scan_pos = NULL;
+}
+
 // -- DOM retention
 
 typedef struct {
@@ -12689,6 +14362,15 @@ ufbxi_noinline static int ufbxi_fix_index(ufbxi_context *uc, uint32_t *p_dst, ui
 	return 1;
 }
 
+// Returns `true` if `data` points to the memory passed to `ufbx_load_memory()`,
+// such arrays must be copied before modifying them.
+static ufbxi_forceinline bool ufbxi_is_source_memory(const ufbxi_context *uc, const void *data)
+{
+	if (!uc->no_copy_arrays) return false;
+	uintptr_t begin = (uintptr_t)uc->source_data, ptr = (uintptr_t)data;
+	return ptr >= begin && ptr - begin < uc->source_size;
+}
+
 ufbxi_nodiscard ufbxi_noinline static int ufbxi_check_indices(ufbxi_context *uc, uint32_t **p_dst, uint32_t *indices, bool owns_indices, size_t num_indices, size_t num_indexers, size_t num_elems)
 {
 	// If the indices are truncated extend them with `UFBX_NO_INDEX`, the following normalization pass
@@ -12796,7 +14478,8 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_vertex_element(ufbxi_contex
 		if (mapping == ufbxi_ByPolygonVertex) {
 
 			// Indexed by polygon vertex: We can use the provided indices directly.
-			ufbxi_check(ufbxi_check_indices(uc, &attrib->indices.data, index_data, true, num_indices, mesh->num_indices, num_elems));
+			bool owns_indices = !ufbxi_is_source_memory(uc, index_data);
+			ufbxi_check(ufbxi_check_indices(uc, &attrib->indices.data, index_data, owns_indices, num_indices, mesh->num_indices, num_elems));
 
 		} else if (mapping == ufbxi_ByVertex || mapping == ufbxi_ByVertice) {
 
@@ -13055,6 +14738,12 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_shape(ufbxi_context *uc, uf
 		ufbxi_blend_offset *offsets = ufbxi_push(&uc->tmp_stack, ufbxi_blend_offset, num_offsets);
 		ufbxi_check(offsets);
 
+		// Indices referencing the user memory must be copied before sorting in place
+		if (ufbxi_is_source_memory(uc, shape->offset_vertices.data)) {
+			shape->offset_vertices.data = ufbxi_push_copy(&uc->result, uint32_t, num_offsets, shape->offset_vertices.data);
+			ufbxi_check(shape->offset_vertices.data);
+		}
+
 		for (size_t i = 0; i < num_offsets; i++) {
 			offsets[i].vertex = shape->offset_vertices.data[i];
 			offsets[i].position_offset = shape->position_offsets.data[i];
@@ -13136,7 +14825,7 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_synthetic_blend_shapes(ufbx
 	return 1;
 }
 
-ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_indices(ufbxi_context *uc, ufbx_mesh *mesh, uint32_t *index_data)
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_faces(ufbxi_context *uc, ufbx_mesh *mesh, uint32_t *index_data)
 {
 	// Count the number of faces and allocate the index list
 	// Indices less than zero (~actual_index) ends a polygon
@@ -13174,7 +14863,6 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_indices(ufbxi_context *u
 		ufbxi_check((size_t)ix < mesh->num_vertices);
 	}
 
-	mesh->vertex_position.indices.data = index_data;
 	mesh->num_faces = ufbxi_to_size(dst_face - mesh->faces.data);
 	mesh->faces.count = mesh->num_faces;
 	mesh->num_triangles = num_triangles;
@@ -13183,6 +14871,177 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_indices(ufbxi_context *u
 	mesh->num_point_faces = num_bad_faces[1];
 	mesh->num_line_faces = num_bad_faces[2];
 
+	return 1;
+}
+
+// Threaded face building for large meshes: Polygon ends are counted per chunk
+// and converted to face offsets in order, after which each chunk writes its
+// faces and un-negates its indices independently. Faces may span chunks, so
+// each chunk also receives the first index of its first face. The result is
+// identical to `ufbxi_process_faces()`.
+
+typedef struct ufbxi_face_task ufbxi_face_task;
+
+typedef struct {
+	uint32_t *index_data;
+	size_t num_indices;
+	size_t num_vertices;
+	ufbx_face *faces;
+} ufbxi_face_context;
+
+struct ufbxi_face_task {
+	ufbxi_face_context *fc;
+	size_t index;
+
+	size_t num_faces;
+	size_t face_offset;
+	size_t face_begin;
+	size_t last_end;
+	bool out_of_bounds;
+
+	size_t num_triangles;
+	size_t max_face_triangles;
+	size_t num_bad_faces[3];
+};
+
+static bool ufbxi_face_count_task_fn(ufbxi_task *task)
+{
+	ufbxi_face_task *t = (ufbxi_face_task*)task->data;
+	ufbxi_face_context *fc = t->fc;
+	size_t begin = t->index * UFBXI_MESH_INDEX_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_MESH_INDEX_CHUNK_SIZE, fc->num_indices);
+	const uint32_t *index_data = fc->index_data;
+
+	size_t num_faces = 0, last_end = 0;
+	bool out_of_bounds = false;
+	for (size_t i = begin; i < end; i++) {
+		uint32_t ix = index_data[i];
+		if ((int32_t)ix < 0) {
+			ix = ~ix;
+			num_faces++;
+			last_end = i + 1;
+		}
+		if ((size_t)ix >= fc->num_vertices) out_of_bounds = true;
+	}
+
+	t->num_faces = num_faces;
+	t->last_end = last_end;
+	t->out_of_bounds = out_of_bounds;
+	return true;
+}
+
+static bool ufbxi_face_build_task_fn(ufbxi_task *task)
+{
+	ufbxi_face_task *t = (ufbxi_face_task*)task->data;
+	ufbxi_face_context *fc = t->fc;
+	size_t begin = t->index * UFBXI_MESH_INDEX_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_MESH_INDEX_CHUNK_SIZE, fc->num_indices);
+	uint32_t *index_data = fc->index_data;
+
+	size_t num_triangles = 0;
+	size_t max_face_triangles = 0;
+	size_t num_bad_faces[3] = { 0 };
+
+	ufbx_face *dst_face = fc->faces + t->face_offset;
+	size_t face_begin = t->face_begin;
+	for (size_t i = begin; i < end; i++) {
+		uint32_t ix = index_data[i];
+		if ((int32_t)ix < 0) {
+			index_data[i] = ~ix;
+			uint32_t num_indices = (uint32_t)(i + 1 - face_begin);
+			dst_face->index_begin = (uint32_t)face_begin;
+			dst_face->num_indices = num_indices;
+			if (num_indices >= 3) {
+				num_triangles += num_indices - 2;
+				max_face_triangles = ufbxi_max_sz(max_face_triangles, num_indices - 2);
+			} else {
+				num_bad_faces[num_indices]++;
+			}
+			dst_face++;
+			face_begin = i + 1;
+		}
+	}
+
+	t->num_triangles = num_triangles;
+	t->max_face_triangles = max_face_triangles;
+	memcpy(t->num_bad_faces, num_bad_faces, sizeof(num_bad_faces));
+	return true;
+}
+
+// The face tasks are run as a normal dispatch batch, so waiting for them also waits for
+// the pending tasks of the other groups of `ufbxi_read_objects_threaded()`.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_faces_threaded(ufbxi_context *uc, ufbx_mesh *mesh, uint32_t *index_data)
+{
+	ufbxi_face_context fc; // ufbxi_uninit
+	fc.index_data = index_data;
+	fc.num_indices = mesh->num_indices;
+	fc.num_vertices = mesh->num_vertices;
+	fc.faces = NULL;
+
+	size_t num_chunks = (mesh->num_indices + UFBXI_MESH_INDEX_CHUNK_SIZE - 1) / UFBXI_MESH_INDEX_CHUNK_SIZE;
+	ufbxi_face_task *tasks = ufbxi_push_zero(&uc->tmp_stack, ufbxi_face_task, num_chunks);
+	ufbxi_check(tasks);
+
+	for (size_t i = 0; i < num_chunks; i++) {
+		tasks[i].fc = &fc;
+		tasks[i].index = i;
+		ufbxi_check(ufbxi_thread_pool_dispatch(&uc->thread_pool, &uc->error, &ufbxi_face_count_task_fn, &tasks[i]));
+	}
+	ufbxi_check(ufbxi_thread_pool_dispatch_wait(&uc->thread_pool, &uc->error));
+
+	// Assign face offsets in order, the first face of a chunk starts
+	// after the last polygon end of any preceding chunk.
+	size_t num_total_faces = 0, face_begin = 0;
+	ufbxi_for(ufbxi_face_task, t, tasks, num_chunks) {
+		ufbxi_check(!t->out_of_bounds);
+		t->face_offset = num_total_faces;
+		t->face_begin = face_begin;
+		num_total_faces += t->num_faces;
+		if (t->num_faces > 0) face_begin = t->last_end;
+	}
+
+	fc.faces = ufbxi_push(&uc->result, ufbx_face, num_total_faces);
+	ufbxi_check(fc.faces);
+
+	for (size_t i = 0; i < num_chunks; i++) {
+		ufbxi_check(ufbxi_thread_pool_dispatch(&uc->thread_pool, &uc->error, &ufbxi_face_build_task_fn, &tasks[i]));
+	}
+	ufbxi_check(ufbxi_thread_pool_dispatch_wait(&uc->thread_pool, &uc->error));
+
+	size_t num_triangles = 0;
+	size_t max_face_triangles = 0;
+	size_t num_bad_faces[3] = { 0 };
+	ufbxi_for(ufbxi_face_task, t, tasks, num_chunks) {
+		num_triangles += t->num_triangles;
+		max_face_triangles = ufbxi_max_sz(max_face_triangles, t->max_face_triangles);
+		num_bad_faces[0] += t->num_bad_faces[0];
+		num_bad_faces[1] += t->num_bad_faces[1];
+		num_bad_faces[2] += t->num_bad_faces[2];
+	}
+
+	ufbxi_pop(&uc->tmp_stack, ufbxi_face_task, num_chunks, NULL);
+
+	mesh->faces.data = fc.faces;
+	mesh->faces.count = num_total_faces;
+	mesh->num_faces = num_total_faces;
+	mesh->num_triangles = num_triangles;
+	mesh->max_face_triangles = max_face_triangles;
+	mesh->num_empty_faces = num_bad_faces[0];
+	mesh->num_point_faces = num_bad_faces[1];
+	mesh->num_line_faces = num_bad_faces[2];
+
+	return 1;
+}
+
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_process_indices(ufbxi_context *uc, ufbx_mesh *mesh, uint32_t *index_data)
+{
+	if (uc->parse_threaded && mesh->num_indices >= UFBXI_MIN_THREADED_MESH_INDICES) {
+		ufbxi_check(ufbxi_process_faces_threaded(uc, mesh, index_data));
+	} else {
+		ufbxi_check(ufbxi_process_faces(uc, mesh, index_data));
+	}
+	mesh->vertex_position.indices.data = index_data;
+
 	mesh->vertex_first_index.count = mesh->num_vertices;
 	mesh->vertex_first_index.data = ufbxi_push(&uc->result, uint32_t, mesh->num_vertices);
 	ufbxi_check(mesh->vertex_first_index.data);
@@ -15111,7 +16970,9 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects(ufbxi_context *uc)
 		ufbxi_check(ufbxi_parse_toplevel_child(uc, &node, NULL));
 		if (!node) break;
 
+		ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_READ_ELEMENTS);
 		ufbxi_check(ufbxi_read_object(uc, node));
+		ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_PARSE);
 
 		uc->warnings.deferred_element_id_plus_one = 0;
 		uc->p_element_id = NULL;
@@ -15129,6 +16990,7 @@ typedef struct {
 ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects_threaded(ufbxi_context *uc)
 {
 	uc->parse_threaded = true;
+	ufbxi_check(ufbxi_ascii_begin_windows(uc));
 
 	bool parsed_to_end = false;
 	ufbxi_object_batch batches[UFBX_THREAD_GROUP_COUNT]; // ufbxi_uninit
@@ -15141,7 +17003,10 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects_threaded(ufbxi_cont
 
 		ufbxi_check(ufbxi_thread_pool_wait_group(&uc->thread_pool));
 
+		// Read the objects before starting any new tasks in this group, so that the tasks
+		// dispatched by large meshes form their own batch, see `ufbxi_process_faces_threaded()`.
 		if (batch->num_nodes > 0) {
+			ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_READ_ELEMENTS);
 			ufbxi_for_ptr(ufbxi_node, p_node, batch->nodes, batch->num_nodes) {
 				ufbxi_buf_clear(&uc->tmp_parse);
 
@@ -15157,8 +17022,11 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects_threaded(ufbxi_cont
 				uc->p_element_id = NULL;
 			}
 			batch->num_nodes = 0;
+			ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_PARSE);
 		}
 
+		ufbxi_check(ufbxi_ascii_update_windows(uc));
+
 		ufbxi_buf *tmp_buf = &uc->tmp_thread_parse[batch_index];
 
 		// ASCII data may be in `tmp_buf`, so copy it to safety in case
@@ -15205,6 +17073,9 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects_threaded(ufbxi_cont
 
 				size_t memory_used = tmp_buf->pushed_size + tmp_buf->pos;
 				if (memory_used >= max_memory) break;
+
+				// Wait for the next window of ASCII tokens to be lexed
+				if (ufbxi_ascii_windows_stalled(&uc->ascii)) break;
 			}
 
 			batch->num_nodes = num_nodes;
@@ -15227,6 +17098,7 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_read_objects_threaded(ufbxi_cont
 	}
 
 	ufbxi_check(ufbxi_thread_pool_wait_all(&uc->thread_pool));
+	ufbxi_ascii_end_windows(&uc->ascii);
 
 	uc->parse_threaded = false;
 
@@ -16878,6 +18750,13 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_init(ufbxi_context *uc)
 	uc->obj.tmp_meshes.ator = &uc->ator_tmp;
 	uc->obj.tmp_props.ator = &uc->ator_tmp;
 
+	ufbxi_nounroll for (size_t i = 0; i < UFBX_THREAD_GROUP_COUNT; i++) {
+		ufbxi_buf *buf = &uc->obj.windows[i].buf;
+		buf->ator = &uc->ator_tmp;
+		buf->unordered = true;
+		buf->clearable = true;
+	}
+
 	// .obj parsing does its own yield logic
 	uc->data_size += uc->yield_size;
 
@@ -16916,6 +18795,10 @@ static ufbxi_noinline void ufbxi_obj_free(ufbxi_context *uc)
 	ufbxi_buf_free(&uc->obj.tmp_meshes);
 	ufbxi_buf_free(&uc->obj.tmp_props);
 
+	ufbxi_nounroll for (size_t i = 0; i < UFBX_THREAD_GROUP_COUNT; i++) {
+		ufbxi_buf_free(&uc->obj.windows[i].buf);
+	}
+
 	ufbxi_map_free(&uc->obj.group_map);
 
 	ufbxi_free(&uc->ator_tmp, ufbx_string, uc->obj.tokens, uc->obj.tokens_cap);
@@ -16996,69 +18879,79 @@ static ufbxi_noinline ufbx_string ufbxi_obj_span_token(ufbxi_context *uc, size_t
 	return result;
 }
 
-ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_tokenize(ufbxi_context *uc)
+// Find the next token of a line at `*p_ptr`, returns `false` at the end of the line.
+// `first` should be set for the first token as `#` only starts comments after it.
+static ufbxi_forceinline bool ufbxi_obj_next_token(const char **p_ptr, const char *end, bool first, ufbx_string *tok)
 {
-	const char *ptr = uc->obj.line.data, *end = ptr + uc->obj.line.length;
-	uc->obj.num_tokens = 0;
+	const char *ptr = *p_ptr;
+	char c;
 
+	// Skip whitespace
 	for (;;) {
-		char c;
+		c = *ptr;
+		if (c == ' ' || c == '\t' || c == '\r') {
+			ptr++;
+			continue;
+		}
 
-		// Skip whitespace
-		for (;;) {
-			c = *ptr;
-			if (c == ' ' || c == '\t' || c == '\r') {
-				ptr++;
+		// Treat line continuations as whitespace
+		if (c == '\\') {
+			const char *p = ptr + 1;
+			if (*p == '\r') p++;
+			if (*p == '\n' && p < end - 1) {
+				ptr = p + 1;
 				continue;
 			}
+		}
 
-			// Treat line continuations as whitespace
-			if (c == '\\') {
-				const char *p = ptr + 1;
-				if (*p == '\r') p++;
-				if (*p == '\n' && p < end - 1) {
-					ptr = p + 1;
-					continue;
-				}
-			}
+		break;
+	}
 
-			break;
-		}
+	c = *ptr;
+	*p_ptr = ptr;
+	if (c == '\n') return false;
+	if (c == '#' && !first) return false;
 
-		c = *ptr;
-		if (c == '\n') break;
-		if (c == '#' && uc->obj.num_tokens > 0) break;
+	tok->data = ptr;
 
-		size_t index = uc->obj.num_tokens++;
-		ufbxi_check(ufbxi_grow_array(&uc->ator_tmp, &uc->obj.tokens, &uc->obj.tokens_cap, index + 1));
+	// Treat comment start as a single token
+	if (c == '#') {
+		tok->length = 1;
+		*p_ptr = ptr + 1;
+		return true;
+	}
 
-		ufbx_string *tok = &uc->obj.tokens[index];
-		tok->data = ptr;
+	for (;;) {
+		c = *++ptr;
 
-		// Treat comment start as a single token
-		if (c == '#') {
-			ptr++;
-			tok->length = 1;
-			continue;
+		if (ufbxi_is_space(c)) {
+			break;
 		}
 
-		for (;;) {
-			c = *++ptr;
-
-			if (ufbxi_is_space(c)) {
+		if (c == '\\') {
+			const char *p = ptr + 1;
+			if (*p == '\r') p++;
+			if (*p == '\n' && p < end - 1) {
 				break;
 			}
-
-			if (c == '\\') {
-				const char *p = ptr + 1;
-				if (*p == '\r') p++;
-				if (*p == '\n' && p < end - 1) {
-					break;
-				}
-			}
 		}
+	}
 
-		tok->length = ufbxi_to_size(ptr - tok->data);
+	tok->length = ufbxi_to_size(ptr - tok->data);
+	*p_ptr = ptr;
+	return true;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_tokenize(ufbxi_context *uc)
+{
+	const char *ptr = uc->obj.line.data, *end = ptr + uc->obj.line.length;
+	uc->obj.num_tokens = 0;
+
+	ufbx_string tok; // ufbxi_uninit
+	while (ufbxi_obj_next_token(&ptr, end, uc->obj.num_tokens == 0, &tok)) {
+		size_t index = uc->obj.num_tokens++;
+		ufbxi_check(ufbxi_grow_array(&uc->ator_tmp, &uc->obj.tokens, &uc->obj.tokens_cap, index + 1));
+		uc->obj.tokens[index] = tok;
 	}
 
 	return 1;
@@ -17071,6 +18964,33 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_tokenize_line(ufbxi_context
 	return 1;
 }
 
+// Parse `num_values` tokens as numbers into `dst`.
+static ufbxi_noinline bool ufbxi_obj_parse_reals(ufbx_real *dst, const ufbx_string *tokens, size_t num_values, uint32_t parse_flags)
+{
+	if (num_values == 0) return true;
+
+	// Parse the whole span of tokens at once, this only fails if there is something else than
+	// whitespace between them (eg. line continuations), in which case parse them one by one.
+	const char *span_begin = tokens[0].data;
+	const char *span_end = tokens[num_values - 1].data + tokens[num_values - 1].length;
+	size_t num_parsed = 0;
+	#if defined(UFBX_REAL_IS_FLOAT)
+		const char *list_end = ufbxi_parse_double_list(NULL, dst, num_values, &num_parsed, span_begin, span_end, '\0', parse_flags);
+	#else
+		const char *list_end = ufbxi_parse_double_list(dst, NULL, num_values, &num_parsed, span_begin, span_end, '\0', parse_flags);
+	#endif
+	if (list_end == span_end && num_parsed == num_values) return true;
+
+	for (size_t i = 0; i < num_values; i++) {
+		ufbx_string str = tokens[i];
+		char *end; // ufbxi_uninit
+		double val = ufbxi_parse_double(str.data, str.length, &end, parse_flags);
+		if (end != str.data + str.length) return false;
+		dst[i] = (ufbx_real)val;
+	}
+	return true;
+}
+
 static ufbxi_noinline int ufbxi_obj_parse_vertex(ufbxi_context *uc, ufbxi_obj_attrib attrib, size_t offset)
 {
 	if (uc->opts.ignore_geometry) return 1;
@@ -17087,16 +19007,9 @@ static ufbxi_noinline int ufbxi_obj_parse_vertex(ufbxi_context *uc, ufbxi_obj_at
 	}
 	ufbxi_check(offset + read_values <= uc->obj.num_tokens);
 
-	uint32_t parse_flags = uc->double_parse_flags;
 	ufbx_real *vals = ufbxi_push_fast(dst, ufbx_real, num_values);
 	ufbxi_check(vals);
-	for (size_t i = 0; i < read_values; i++) {
-		ufbx_string str = uc->obj.tokens[offset + i];
-		char *end; // ufbxi_uninit
-		double val = ufbxi_parse_double(str.data, str.length, &end, parse_flags);
-		ufbxi_check(end == str.data + str.length);
-		vals[i] = (ufbx_real)val;
-	}
+	ufbxi_check(ufbxi_obj_parse_reals(vals, uc->obj.tokens + offset, read_values, uc->double_parse_flags));
 
 	if (read_values < num_values) {
 		ufbx_assert(read_values + 1 == num_values);
@@ -17107,7 +19020,14 @@ static ufbxi_noinline int ufbxi_obj_parse_vertex(ufbxi_context *uc, ufbxi_obj_at
 	return 1;
 }
 
-ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_index(ufbxi_context *uc, ufbx_string *s, uint32_t attrib)
+// Negative indices are relative to the vertex count at the point of the face, so they
+// are resolved when pushing the index in `ufbxi_obj_push_index()`.
+#define UFBXI_OBJ_NEGATIVE_INDEX ((uint64_t)1 << 63u)
+
+// Parse the next `/` separated index of `s` as a zero-based index, `UINT64_MAX` if it
+// is missing, or `UFBXI_OBJ_NEGATIVE_INDEX | n` for negative indices `-n`.
+// Returns `false` if the index is too large.
+static ufbxi_forceinline bool ufbxi_obj_scan_index(ufbx_string *s, uint64_t *p_index)
 {
 	const char *ptr = s->data, *end = ptr + s->length;
 
@@ -17123,7 +19043,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_index(ufbxi_context *u
 	for (; ptr != end; ptr++) {
 		char c = *ptr;
 		if (c >= '0' && c <= '9') {
-			ufbxi_check(index < UINT64_MAX / 10 - 10);
+			if (index >= UINT64_MAX / 10 - 10) return false;
 			index = index * 10 + (uint64_t)(c - '0');
 		} else if (c == '/') {
 			ptr++;
@@ -17132,13 +19052,27 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_index(ufbxi_context *u
 	}
 
 	if (negative) {
-		size_t count = uc->obj.vertex_count[attrib];
-		index = index <= count ? count - index : UINT64_MAX;
+		index |= UFBXI_OBJ_NEGATIVE_INDEX;
 	} else {
 		// Corrects to zero based indices and wraps 0 to UINT64_MAX (missing)
 		index -= 1;
 	}
 
+	*p_index = index;
+	s->data = ptr;
+	s->length = ufbxi_to_size(end - ptr);
+
+	return true;
+}
+
+ufbxi_nodiscard static ufbxi_forceinline int ufbxi_obj_push_index(ufbxi_context *uc, uint64_t index, uint32_t attrib)
+{
+	if (index != UINT64_MAX && (index & UFBXI_OBJ_NEGATIVE_INDEX) != 0) {
+		uint64_t offset = index & ~UFBXI_OBJ_NEGATIVE_INDEX;
+		size_t count = uc->obj.vertex_count[attrib];
+		index = offset <= count ? count - offset : UINT64_MAX;
+	}
+
 	ufbxi_obj_fast_indices *fast_indices = &uc->obj.fast_indices[attrib];
 	if (fast_indices->num_left == 0) {
 		size_t num_push = 128;
@@ -17159,14 +19093,23 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_index(ufbxi_context *u
 		range->max_ix = ufbxi_max64(range->max_ix, index);
 	}
 
-	s->data = ptr;
-	s->length = ufbxi_to_size(end - ptr);
+	return 1;
+}
 
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_index(ufbxi_context *uc, ufbx_string *s, uint32_t attrib)
+{
+	uint64_t index = UINT64_MAX;
+	ufbxi_check(ufbxi_obj_scan_index(s, &index));
+	ufbxi_check(ufbxi_obj_push_index(uc, index, attrib));
 	return 1;
 }
 
-ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_indices(ufbxi_context *uc, size_t token_begin, size_t num_tokens)
+// Start a new face with `num_indices` indices, `*p_push_indices` is set if the caller
+// should push the indices of the face using `ufbxi_obj_push_index()`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_push_face(ufbxi_context *uc, size_t num_indices, bool *p_push_indices)
 {
+	*p_push_indices = false;
+
 	bool flush_mesh = false;
 	if (uc->obj.object_dirty) {
 		if (!uc->opts.obj_merge_objects) {
@@ -17214,7 +19157,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_indices(ufbxi_context
 	// EARLY RETURN: Rest of the function should only be related to geometry!
 	if (uc->opts.ignore_geometry) return 1;
 
-	if (num_tokens == 0 && !uc->opts.allow_empty_faces) {
+	if (num_indices == 0 && !uc->opts.allow_empty_faces) {
 		ufbxi_check(ufbxi_warnf(UFBX_WARNING_EMPTY_FACE_REMOVED, "Empty face has been removed"));
 		return 1;
 	}
@@ -17257,7 +19200,6 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_indices(ufbxi_context
 		uc->obj.face_group_dirty = false;
 	}
 
-	size_t num_indices = num_tokens;
 	ufbxi_check(UINT32_MAX - mesh->num_indices >= num_indices);
 
 	ufbx_face *face = ufbxi_push_fast(&uc->obj.tmp_faces, ufbx_face, 1);
@@ -17285,6 +19227,17 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_indices(ufbxi_context
 		*p_face_group = uc->obj.face_group;
 	}
 
+	*p_push_indices = true;
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_indices(ufbxi_context *uc, size_t token_begin, size_t num_tokens)
+{
+	size_t num_indices = num_tokens;
+	bool push_indices; // ufbxi_uninit
+	ufbxi_check(ufbxi_obj_push_face(uc, num_indices, &push_indices));
+	if (!push_indices) return 1;
+
 	for (size_t ix = 0; ix < num_indices; ix++) {
 		ufbx_string tok = uc->obj.tokens[token_begin + ix];
 		for (uint32_t attrib = 0; attrib < UFBXI_OBJ_NUM_ATTRIBS; attrib++) {
@@ -17678,13 +19631,13 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_pop_meshes(ufbxi_context *uc
 	return 1;
 }
 
-ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_file(ufbxi_context *uc)
+// Parse a line that has been tokenized into `uc->obj.tokens`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_line(ufbxi_context *uc)
 {
-	while (!uc->obj.eof) {
-		ufbxi_check(ufbxi_obj_tokenize_line(uc));
-		size_t num_tokens = uc->obj.num_tokens;
-		if (num_tokens == 0) continue;
+	size_t num_tokens = uc->obj.num_tokens;
+	if (num_tokens == 0) return 1;
 
+	{
 		ufbx_string cmd = uc->obj.tokens[0];
 		uint32_t key = ufbxi_get_name_key(cmd.data, cmd.length);
 		if (key == ufbxi_obj_cmd1('v')) {
@@ -17754,6 +19707,357 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_file(ufbxi_context *uc
 		}
 	}
 
+	return 1;
+}
+
+// -- Threaded .obj parsing
+//
+// If the whole file is in memory, complete lines are split into windows of chunks that
+// are parsed in thread pool tasks into records. The main thread then replays the records
+// of each chunk in order: vertices are appended in bulk and faces are pushed with
+// pre-parsed indices. Everything else (and anything the tasks fail to parse) is recorded
+// as a line to be parsed normally, so the result is identical to parsing line by line.
+
+#define UFBXI_OBJ_CHUNK_MAX_TOKENS 64
+
+// Each byte of source can expand to a few bytes of records, lines that don't fit
+// in the chunk buffer are left to the main thread.
+#define UFBXI_OBJ_RECORD_BYTES_PER_BYTE 4
+
+// Find the end of the line containing `pos`, ie. the pointer after the first `\n` that
+// is not a line continuation. Returns `NULL` if the line is not terminated before `end`.
+static ufbxi_noinline const char *ufbxi_obj_find_line_end(const char *begin, const char *pos, const char *end)
+{
+	for (;;) {
+		const char *nl = (const char*)memchr(pos, '\n', ufbxi_to_size(end - pos));
+		if (!nl) return NULL;
+
+		const char *esc = nl;
+		if (esc > begin && esc[-1] == '\r') esc--;
+		if (esc > begin && esc[-1] == '\\') {
+			pos = nl + 1;
+			continue;
+		}
+		return nl + 1;
+	}
+}
+
+static ufbxi_forceinline char *ufbxi_obj_push_record(ufbxi_parse_task *chunk, ufbxi_obj_record_type type, uint32_t attrib, size_t data_size)
+{
+	ufbxi_obj_record *record = (ufbxi_obj_record*)ufbxi_parse_task_push(chunk, sizeof(ufbxi_obj_record) + data_size);
+	if (!record) return NULL;
+
+	record->type = (uint16_t)type;
+	record->attrib = (uint16_t)attrib;
+	record->count = 0;
+	return (char*)(record + 1);
+}
+
+// Parse a single tokenized vertex or face line into `chunk`. Returns `false` if the
+// line needs to be parsed by the main thread.
+static ufbxi_noinline bool ufbxi_obj_parse_chunk_line(ufbxi_parse_task *chunk, const ufbx_string *tokens, size_t num_tokens, ufbxi_obj_record **p_run)
+{
+	uint32_t key = ufbxi_get_name_key(tokens[0].data, tokens[0].length);
+
+	ufbxi_obj_attrib attrib = UFBXI_OBJ_ATTRIB_POSITION;
+	if (key == ufbxi_obj_cmd1('v')) {
+		// Vertex colors need to be synchronized with positions, parse them on the main thread.
+		if (num_tokens >= 7) return false;
+		attrib = UFBXI_OBJ_ATTRIB_POSITION;
+	} else if (key == ufbxi_obj_cmd2('v','t')) {
+		attrib = UFBXI_OBJ_ATTRIB_UV;
+	} else if (key == ufbxi_obj_cmd2('v','n')) {
+		attrib = UFBXI_OBJ_ATTRIB_NORMAL;
+	} else if (key == ufbxi_obj_cmd1('f')) {
+		size_t num_indices = num_tokens - 1;
+		uint64_t *indices = (uint64_t*)ufbxi_obj_push_record(chunk, UFBXI_OBJ_RECORD_FACE, 0, num_indices * UFBXI_OBJ_NUM_ATTRIBS * sizeof(uint64_t));
+		if (!indices) return false;
+		ufbxi_obj_record *record = (ufbxi_obj_record*)indices - 1;
+		record->count = (uint32_t)num_indices;
+
+		for (size_t ix = 0; ix < num_indices; ix++) {
+			ufbx_string tok = tokens[1 + ix];
+			for (uint32_t i = 0; i < UFBXI_OBJ_NUM_ATTRIBS; i++) {
+				if (!ufbxi_obj_scan_index(&tok, indices++)) {
+					chunk->records_size = ufbxi_to_size((char*)record - chunk->records);
+					return false;
+				}
+			}
+		}
+
+		*p_run = NULL;
+		return true;
+	} else {
+		return false;
+	}
+
+	size_t num_values = ufbxi_obj_attrib_stride[attrib];
+	if (num_tokens < 1 + num_values) return false;
+
+	ufbx_real vals[3];
+	if (!ufbxi_obj_parse_reals(vals, tokens + 1, num_values, chunk->double_parse_flags)) return false;
+
+	// Append to the previous run of vertices if possible
+	ufbxi_obj_record *run = *p_run;
+	size_t value_size = num_values * sizeof(ufbx_real);
+	if (run && run->attrib == (uint16_t)attrib && chunk->records_cap - chunk->records_size >= value_size && run->count < UINT32_MAX) {
+		memcpy(chunk->records + chunk->records_size, vals, value_size);
+		chunk->records_size += value_size;
+		run->count++;
+		return true;
+	}
+
+	char *dst = ufbxi_obj_push_record(chunk, UFBXI_OBJ_RECORD_VERTICES, (uint32_t)attrib, value_size);
+	if (!dst) return false;
+	memcpy(dst, vals, value_size);
+	run = (ufbxi_obj_record*)dst - 1;
+	run->count = 1;
+	*p_run = run;
+	return true;
+}
+
+static ufbxi_noinline void ufbxi_obj_parse_chunk(ufbxi_parse_task *chunk)
+{
+	ufbx_string tokens[UFBXI_OBJ_CHUNK_MAX_TOKENS]; // ufbxi_uninit
+	ufbxi_obj_record *run = NULL;
+
+	const char *pos = chunk->begin, *end = chunk->end;
+	while (pos != end) {
+		const char *line_end = ufbxi_obj_find_line_end(pos, pos, end);
+		ufbx_assert(line_end);
+		if (!line_end) line_end = end;
+
+		// Lines with too many tokens are left to the main thread
+		const char *ptr = pos;
+		size_t num_tokens = 0;
+		bool overflow = false;
+		ufbx_string tok; // ufbxi_uninit
+		while (ufbxi_obj_next_token(&ptr, line_end, num_tokens == 0, &tok)) {
+			if (num_tokens == UFBXI_OBJ_CHUNK_MAX_TOKENS) {
+				overflow = true;
+				break;
+			}
+			tokens[num_tokens++] = tok;
+		}
+
+		if (!overflow) {
+			if (num_tokens == 0) {
+				pos = line_end;
+				continue;
+			}
+			if (ufbxi_obj_parse_chunk_line(chunk, tokens, num_tokens, &run)) {
+				pos = line_end;
+				continue;
+			}
+		}
+
+		ufbx_string *line = (ufbx_string*)ufbxi_obj_push_record(chunk, UFBXI_OBJ_RECORD_LINE, 0, sizeof(ufbx_string));
+		if (!line) break;
+		line->data = pos;
+		line->length = ufbxi_to_size(line_end - pos);
+		run = NULL;
+		pos = line_end;
+	}
+
+	chunk->parsed_end = pos;
+}
+
+static bool ufbxi_obj_chunk_task_fn(ufbxi_task *task)
+{
+	ufbxi_obj_parse_chunk((ufbxi_parse_task*)task->data);
+	return true;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_dispatch_window(ufbxi_context *uc, ufbxi_obj_window *window)
+{
+	size_t chunk_size = UFBXI_OBJ_CHUNK_SIZE;
+	size_t max_chunks = uc->obj.window_size / chunk_size + 1;
+
+	ufbxi_buf_clear(&window->buf);
+	window->chunks = ufbxi_push_zero(&window->buf, ufbxi_parse_task, max_chunks);
+	ufbxi_check(window->chunks);
+	window->num_chunks = 0;
+
+	const char *begin = uc->obj.scan_pos, *pos = begin, *end = uc->obj.scan_end;
+	while (pos != end && window->num_chunks < max_chunks) {
+		const char *chunk_end = end;
+		if (ufbxi_to_size(end - pos) > chunk_size) {
+			chunk_end = ufbxi_obj_find_line_end(pos, pos + chunk_size - 1, end);
+			if (!chunk_end) chunk_end = end;
+		}
+
+		ufbxi_parse_task *chunk = &window->chunks[window->num_chunks++];
+		chunk->begin = pos;
+		chunk->end = chunk_end;
+		pos = chunk_end;
+
+		if (ufbxi_to_size(pos - begin) >= uc->obj.window_size) break;
+	}
+	uc->obj.scan_pos = pos;
+
+	ufbxi_for(ufbxi_parse_task, chunk, window->chunks, window->num_chunks) {
+		size_t length = ufbxi_to_size(chunk->end - chunk->begin);
+		size_t num_words = (ufbxi_min_sz(length, chunk_size * 2) * UFBXI_OBJ_RECORD_BYTES_PER_BYTE + 64) / 8;
+		uint64_t *records = ufbxi_push(&window->buf, uint64_t, num_words);
+		ufbxi_check(records);
+		chunk->records = (char*)records;
+		chunk->records_cap = num_words * 8;
+		chunk->parsed_end = chunk->begin;
+		chunk->double_parse_flags = uc->double_parse_flags;
+
+		ufbxi_task *task = ufbxi_thread_pool_create_task(&uc->thread_pool, &ufbxi_obj_chunk_task_fn);
+		if (task) {
+			ufbxi_stats_add(uc, num_obj_chunk_tasks, 1);
+			task->data = chunk;
+			ufbxi_thread_pool_run_task(&uc->thread_pool, task);
+		} else {
+			ufbxi_obj_parse_chunk(chunk);
+		}
+	}
+
+	return 1;
+}
+
+// Apply the records of a parsed chunk and parse the lines the task could not handle.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_merge_chunk(ufbxi_context *uc, const ufbxi_parse_task *chunk)
+{
+	size_t offset = 0;
+	while (offset < chunk->records_size) {
+		offset = ufbxi_align_to_mask(offset, 7);
+		const ufbxi_obj_record *record = (const ufbxi_obj_record*)(chunk->records + offset);
+		const char *data = (const char*)(record + 1);
+		size_t count = record->count;
+
+		switch (record->type) {
+		case UFBXI_OBJ_RECORD_VERTICES: {
+			uint32_t attrib = record->attrib;
+			size_t num_values = count * ufbxi_obj_attrib_stride[attrib];
+			ufbxi_check(ufbxi_push_copy(&uc->obj.tmp_vertices[attrib], ufbx_real, num_values, data));
+			uc->obj.vertex_count[attrib] += count;
+			offset += sizeof(ufbxi_obj_record) + num_values * sizeof(ufbx_real);
+		} break;
+		case UFBXI_OBJ_RECORD_FACE: {
+			const uint64_t *indices = (const uint64_t*)data;
+			bool push_indices; // ufbxi_uninit
+			ufbxi_check(ufbxi_obj_push_face(uc, count, &push_indices));
+			if (push_indices) {
+				for (size_t ix = 0; ix < count; ix++) {
+					for (uint32_t attrib = 0; attrib < UFBXI_OBJ_NUM_ATTRIBS; attrib++) {
+						ufbxi_check(ufbxi_obj_push_index(uc, *indices++, attrib));
+					}
+				}
+			}
+			offset += sizeof(ufbxi_obj_record) + count * UFBXI_OBJ_NUM_ATTRIBS * sizeof(uint64_t);
+		} break;
+		case UFBXI_OBJ_RECORD_LINE: {
+			memcpy(&uc->obj.line, data, sizeof(ufbx_string));
+			ufbxi_check(ufbxi_obj_tokenize(uc));
+			ufbxi_check(ufbxi_obj_parse_line(uc));
+			offset += sizeof(ufbxi_obj_record) + sizeof(ufbx_string);
+		} break;
+		default:
+			ufbxi_unreachable("Bad .obj record type");
+		}
+	}
+
+	const char *pos = chunk->parsed_end, *end = chunk->end;
+	while (pos != end) {
+		const char *line_end = ufbxi_obj_find_line_end(pos, pos, end);
+		ufbxi_check(line_end);
+		uc->obj.line.data = pos;
+		uc->obj.line.length = ufbxi_to_size(line_end - pos);
+		ufbxi_check(ufbxi_obj_tokenize(uc));
+		ufbxi_check(ufbxi_obj_parse_line(uc));
+		pos = line_end;
+	}
+
+	uc->obj.read_progress += ufbxi_to_size(chunk->end - chunk->begin);
+	if (uc->obj.read_progress >= uc->progress_interval) {
+		ufbxi_check(ufbxi_report_progress(uc));
+		uc->obj.read_progress %= uc->progress_interval;
+	}
+
+	return 1;
+}
+
+// Parse all complete lines of an in-memory file using the thread pool,
+// leaving the unterminated last line (if any) to `ufbxi_obj_parse_file()`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_threaded(ufbxi_context *uc)
+{
+	const char *begin = uc->data, *end = uc->data + uc->data_size;
+
+	// Find the end of the last complete line
+	const char *scan_end = end;
+	while (scan_end != begin) {
+		const char *nl = scan_end - 1;
+		while (nl != begin && *nl != '\n') nl--;
+		if (*nl != '\n') {
+			scan_end = begin;
+			break;
+		}
+		if (ufbxi_obj_find_line_end(begin, nl, end) == nl + 1) {
+			scan_end = nl + 1;
+			break;
+		}
+		scan_end = nl;
+	}
+
+	if (ufbxi_to_size(scan_end - begin) < UFBXI_OBJ_CHUNK_SIZE * 2) return 1;
+
+	// Keep the records of all the windows within the thread memory limit
+	size_t window_size = uc->opts.thread_opts.memory_limit / (UFBX_THREAD_GROUP_COUNT * (UFBXI_OBJ_RECORD_BYTES_PER_BYTE + 1));
+	window_size = ufbxi_max_sz(window_size, UFBXI_OBJ_CHUNK_SIZE);
+	window_size = ufbxi_min_sz(window_size, UFBXI_OBJ_CHUNK_SIZE * 64);
+
+	uc->obj.window_size = window_size;
+	uc->obj.scan_pos = begin;
+	uc->obj.scan_end = scan_end;
+
+	// Dispatch a window for each group and merge them in order as the groups finish
+	ufbxi_nounroll for (size_t i = 0; i < UFBX_THREAD_GROUP_COUNT; i++) {
+		ufbxi_obj_window *window = &uc->obj.windows[i];
+		window->num_chunks = 0;
+		if (uc->obj.scan_pos != scan_end) {
+			ufbxi_check(ufbxi_obj_dispatch_window(uc, window));
+		}
+		ufbxi_thread_pool_flush_group(&uc->thread_pool);
+	}
+
+	for (size_t index = 0; ; index = (index + 1) % UFBX_THREAD_GROUP_COUNT) {
+		ufbxi_obj_window *window = &uc->obj.windows[index];
+		if (window->num_chunks == 0) break;
+
+		ufbxi_check(ufbxi_thread_pool_wait_group(&uc->thread_pool));
+		ufbxi_for(ufbxi_parse_task, chunk, window->chunks, window->num_chunks) {
+			ufbxi_check(ufbxi_obj_merge_chunk(uc, chunk));
+		}
+
+		window->num_chunks = 0;
+		if (uc->obj.scan_pos != scan_end) {
+			ufbxi_check(ufbxi_obj_dispatch_window(uc, window));
+		}
+		ufbxi_thread_pool_flush_group(&uc->thread_pool);
+	}
+	ufbxi_check(ufbxi_thread_pool_wait_all(&uc->thread_pool));
+
+	size_t consumed = ufbxi_to_size(scan_end - begin);
+	uc->data += consumed;
+	uc->data_size -= consumed;
+
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_obj_parse_file(ufbxi_context *uc)
+{
+	if (uc->thread_pool.enabled && !uc->read_fn && !uc->opts.ignore_geometry && !uc->opts.force_single_thread_ascii_parsing) {
+		ufbxi_check(ufbxi_obj_parse_threaded(uc));
+	}
+
+	while (!uc->obj.eof) {
+		ufbxi_check(ufbxi_obj_tokenize_line(uc));
+		ufbxi_check(ufbxi_obj_parse_line(uc));
+	}
+
 	ufbxi_check(ufbxi_obj_flush_mesh(uc));
 	ufbxi_check(ufbxi_obj_pop_meshes(uc));
 
@@ -20367,7 +22671,16 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_generate_normals(ufbxi_context *
 
 	mesh->generated_normals = true;
 
-	ufbx_topo_edge *topo = ufbxi_push(&uc->tmp_stack, ufbx_topo_edge, num_indices);
+	// Compute the retained topology here so that `ufbxi_retain_topology()` can skip the mesh
+	ufbx_mesh_topology *topology = NULL;
+	ufbx_topo_edge *topo = NULL;
+	if (uc->opts.retain_topology) {
+		topology = ufbxi_push_zero(&uc->result, ufbx_mesh_topology, 1);
+		ufbxi_check(topology);
+		topo = ufbxi_push(&uc->result, ufbx_topo_edge, num_indices);
+	} else {
+		topo = ufbxi_push(&uc->tmp_stack, ufbx_topo_edge, num_indices);
+	}
 	ufbxi_check(topo);
 
 	uint32_t *normal_indices = ufbxi_push(&uc->result, uint32_t, num_indices);
@@ -20397,7 +22710,67 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_generate_normals(ufbxi_context *
 
 	mesh->skinned_normal = mesh->vertex_normal;
 
-	ufbxi_pop(&uc->tmp_stack, ufbx_topo_edge, num_indices, NULL);
+	if (topology) {
+		topology->edges.data = topo;
+		topology->edges.count = num_indices;
+		topology->normal_indices = mesh->vertex_normal.indices;
+		topology->num_normals = num_normals;
+		mesh->topology = topology;
+	} else {
+		ufbxi_pop(&uc->tmp_stack, ufbx_topo_edge, num_indices, NULL);
+	}
+
+	return 1;
+}
+
+static bool ufbxi_retain_topology_task_fn(ufbxi_task *task)
+{
+	ufbx_mesh *mesh = (ufbx_mesh*)task->data;
+	ufbx_mesh_topology *topology = mesh->topology;
+	size_t num_indices = mesh->num_indices;
+
+	ufbx_compute_topology(mesh, topology->edges.data, num_indices);
+	if (topology->normal_indices.data != mesh->vertex_normal.indices.data) {
+		topology->num_normals = ufbx_generate_normal_mapping(mesh, topology->edges.data, num_indices, topology->normal_indices.data, num_indices, false);
+	}
+
+	return true;
+}
+
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_retain_topology(ufbxi_context *uc)
+{
+	ufbxi_for_ptr_list(ufbx_mesh, p_mesh, uc->scene.meshes) {
+		ufbx_mesh *mesh = *p_mesh;
+		size_t num_indices = mesh->num_indices;
+
+		// Topology computed in `ufbxi_generate_normals()` is valid unless the winding was reversed
+		ufbx_mesh_topology *topology = mesh->topology;
+		if (topology && !mesh->reversed_winding) continue;
+
+		if (!topology) {
+			topology = ufbxi_push_zero(&uc->result, ufbx_mesh_topology, 1);
+			ufbxi_check(topology);
+
+			topology->edges.data = ufbxi_push(&uc->result, ufbx_topo_edge, num_indices);
+			ufbxi_check(topology->edges.data);
+			topology->edges.count = num_indices;
+		}
+
+		// Normals generated in `ufbxi_generate_normals()` already use the same mapping
+		if (mesh->generated_normals && !mesh->reversed_winding) {
+			topology->normal_indices = mesh->vertex_normal.indices;
+			topology->num_normals = mesh->vertex_normal.values.count;
+		} else {
+			topology->normal_indices.data = ufbxi_push(&uc->result, uint32_t, num_indices);
+			ufbxi_check(topology->normal_indices.data);
+			topology->normal_indices.count = num_indices;
+		}
+
+		mesh->topology = topology;
+		ufbxi_check(ufbxi_thread_pool_dispatch(&uc->thread_pool, &uc->error, &ufbxi_retain_topology_task_fn, mesh));
+	}
+
+	ufbxi_check(ufbxi_thread_pool_dispatch_wait(&uc->thread_pool, &uc->error));
 
 	return 1;
 }
@@ -21015,49 +23388,190 @@ ufbxi_nodiscard ufbxi_noinline static ufbx_node *ufbxi_get_geometry_transform_no
 	return NULL;
 }
 
-ufbxi_noinline static void ufbxi_mirror_vec3_list(const void *v_list, ufbx_mirror_axis axis, size_t stride)
+// Vertex arrays are modified in a single pass: Unit scaling and mirroring are
+// folded into a per-axis scale (exact, as negation never rounds), followed by
+// an optional geometry transform and normalization. The arrays are processed
+// in chunks that can be spread over the thread pool.
+typedef struct {
+	ufbx_real *data;
+	size_t count;
+	size_t stride;
+	ufbx_vec3 scale;
+	ufbx_matrix matrix;
+	bool has_matrix;
+	bool normalize;
+	bool threaded;
+} ufbxi_geometry_job;
+
+typedef struct {
+	const ufbxi_geometry_job *job;
+	size_t begin, end;
+} ufbxi_geometry_task;
+
+// `data[i] *= scale` for packed `ufbx_vec3` values in `[begin, end)`.
+// NOTE: Must round exactly like the scalar code.
+static ufbxi_noinline void ufbxi_scale_vec3_range(ufbx_real *data, size_t begin, size_t end, ufbx_vec3 scale)
 {
-	const ufbx_void_list *list = (const ufbx_void_list*)v_list;
-	if (axis == UFBX_MIRROR_AXIS_NONE || !list || list->count == 0) return;
-	if (!stride) stride = sizeof(ufbx_vec3);
+	size_t i = begin;
 
-	void *ptr = (char*)list->data + (size_t)((int)axis - 1) * sizeof(ufbx_real);
-	void *end = (char*)ptr + list->count * stride;
-	while (ptr != end) {
-		ufbx_real *v = (ufbx_real*)ptr;
-		*v = -*v;
-		ptr = (char*)ptr + stride;
+#if UFBXI_HAS_SSE
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		// Two vectors span three registers: (x y) (z x) (y z)
+		for (; i < end && i % 2 != 0; i++) {
+			ufbx_real *v = data + i * 3;
+			v[0] *= scale.x; v[1] *= scale.y; v[2] *= scale.z;
+		}
+		const __m128d s0 = _mm_setr_pd((double)scale.x, (double)scale.y);
+		const __m128d s1 = _mm_setr_pd((double)scale.z, (double)scale.x);
+		const __m128d s2 = _mm_setr_pd((double)scale.y, (double)scale.z);
+		for (; i + 2 <= end; i += 2) {
+			double *d = (double*)data + i * 3;
+			_mm_storeu_pd(d + 0, _mm_mul_pd(_mm_loadu_pd(d + 0), s0));
+			_mm_storeu_pd(d + 2, _mm_mul_pd(_mm_loadu_pd(d + 2), s1));
+			_mm_storeu_pd(d + 4, _mm_mul_pd(_mm_loadu_pd(d + 4), s2));
+		}
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		// Four vectors span three registers: (x y z x) (y z x y) (z x y z)
+		for (; i < end && i % 4 != 0; i++) {
+			ufbx_real *v = data + i * 3;
+			v[0] *= scale.x; v[1] *= scale.y; v[2] *= scale.z;
+		}
+		const __m128 s0 = _mm_setr_ps((float)scale.x, (float)scale.y, (float)scale.z, (float)scale.x);
+		const __m128 s1 = _mm_setr_ps((float)scale.y, (float)scale.z, (float)scale.x, (float)scale.y);
+		const __m128 s2 = _mm_setr_ps((float)scale.z, (float)scale.x, (float)scale.y, (float)scale.z);
+		for (; i + 4 <= end; i += 4) {
+			float *d = (float*)data + i * 3;
+			_mm_storeu_ps(d + 0, _mm_mul_ps(_mm_loadu_ps(d + 0), s0));
+			_mm_storeu_ps(d + 4, _mm_mul_ps(_mm_loadu_ps(d + 4), s1));
+			_mm_storeu_ps(d + 8, _mm_mul_ps(_mm_loadu_ps(d + 8), s2));
+		}
+	}
+#endif
+
+	for (; i < end; i++) {
+		ufbx_real *v = data + i * 3;
+		v[0] *= scale.x; v[1] *= scale.y; v[2] *= scale.z;
 	}
 }
 
-ufbxi_noinline static void ufbxi_scale_vec3_list(const void *v_list, ufbx_real scale, size_t stride)
+static ufbxi_noinline void ufbxi_run_geometry_job(const ufbxi_geometry_job *job, size_t begin, size_t end)
 {
-	const ufbx_void_list *list = (const ufbx_void_list*)v_list;
-	if (!list || list->count == 0) return;
-	if (!stride) stride = sizeof(ufbx_vec3);
+	if (!job->has_matrix && !job->normalize && job->stride == sizeof(ufbx_vec3)) {
+		ufbxi_scale_vec3_range(job->data, begin, end, job->scale);
+		return;
+	}
+
+	ufbx_vec3 scale = job->scale;
+	char *ptr = (char*)job->data + begin * job->stride;
+	char *ptr_end = (char*)job->data + end * job->stride;
+
+#if UFBXI_HAS_SSE
+	// Transform with the matrix columns, summing in the same order as `ufbx_transform_position()`.
+	// NOTE: Must round exactly like the scalar code, normalization is left scalar.
+	if (job->has_matrix) {
+		const ufbx_matrix *m = &job->matrix;
+		if (sizeof(ufbx_real) == sizeof(double)) {
+			const __m128d s_xy = _mm_setr_pd((double)scale.x, (double)scale.y);
+			const __m128d c0_xy = _mm_setr_pd((double)m->m00, (double)m->m10), c0_z = _mm_set_sd((double)m->m20);
+			const __m128d c1_xy = _mm_setr_pd((double)m->m01, (double)m->m11), c1_z = _mm_set_sd((double)m->m21);
+			const __m128d c2_xy = _mm_setr_pd((double)m->m02, (double)m->m12), c2_z = _mm_set_sd((double)m->m22);
+			const __m128d c3_xy = _mm_setr_pd((double)m->m03, (double)m->m13), c3_z = _mm_set_sd((double)m->m23);
+			for (; ptr != ptr_end; ptr += job->stride) {
+				double *v = (double*)ptr;
+				__m128d p_xy = _mm_mul_pd(_mm_loadu_pd(v), s_xy);
+				__m128d x = _mm_unpacklo_pd(p_xy, p_xy);
+				__m128d y = _mm_unpackhi_pd(p_xy, p_xy);
+				__m128d z = _mm_set1_pd(v[2] * (double)scale.z);
+				__m128d r_xy = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0_xy, x), _mm_mul_pd(c1_xy, y)), _mm_mul_pd(c2_xy, z)), c3_xy);
+				__m128d r_z = _mm_add_sd(_mm_add_sd(_mm_add_sd(_mm_mul_sd(c0_z, x), _mm_mul_sd(c1_z, y)), _mm_mul_sd(c2_z, z)), c3_z);
+				if (job->normalize) {
+					ufbx_vec3 res; // ufbxi_uninit
+					res.x = (ufbx_real)_mm_cvtsd_f64(r_xy);
+					res.y = (ufbx_real)_mm_cvtsd_f64(_mm_unpackhi_pd(r_xy, r_xy));
+					res.z = (ufbx_real)_mm_cvtsd_f64(r_z);
+					res = ufbxi_normalize3(res);
+					v[0] = (double)res.x;
+					v[1] = (double)res.y;
+					v[2] = (double)res.z;
+				} else {
+					_mm_storeu_pd(v, r_xy);
+					_mm_store_sd(v + 2, r_z);
+				}
+			}
+			return;
+		} else if (sizeof(ufbx_real) == sizeof(float)) {
+			const __m128 s = _mm_setr_ps((float)scale.x, (float)scale.y, (float)scale.z, 0.0f);
+			const __m128 c0 = _mm_setr_ps((float)m->m00, (float)m->m10, (float)m->m20, 0.0f);
+			const __m128 c1 = _mm_setr_ps((float)m->m01, (float)m->m11, (float)m->m21, 0.0f);
+			const __m128 c2 = _mm_setr_ps((float)m->m02, (float)m->m12, (float)m->m22, 0.0f);
+			const __m128 c3 = _mm_setr_ps((float)m->m03, (float)m->m13, (float)m->m23, 0.0f);
+			for (; ptr != ptr_end; ptr += job->stride) {
+				float *v = (float*)ptr;
+				__m128 p = _mm_mul_ps(_mm_setr_ps(v[0], v[1], v[2], 0.0f), s);
+				__m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(0,0,0,0));
+				__m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(1,1,1,1));
+				__m128 z = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2,2,2,2));
+				__m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)), _mm_mul_ps(c2, z)), c3);
+				ufbx_vec3 res; // ufbxi_uninit
+				res.x = (ufbx_real)_mm_cvtss_f32(r);
+				res.y = (ufbx_real)_mm_cvtss_f32(_mm_shuffle_ps(r, r, _MM_SHUFFLE(1,1,1,1)));
+				res.z = (ufbx_real)_mm_cvtss_f32(_mm_movehl_ps(r, r));
+				if (job->normalize) {
+					res = ufbxi_normalize3(res);
+				}
+				v[0] = (float)res.x;
+				v[1] = (float)res.y;
+				v[2] = (float)res.z;
+			}
+			return;
+		}
+	}
+#endif
 
-	void *ptr = list->data, *end = (char*)ptr + list->count * stride;
-	while (ptr != end) {
-		ufbx_vec3 *v = (ufbx_vec3*)ptr;
-		v->x *= scale;
-		v->y *= scale;
-		v->z *= scale;
-		ptr = (char*)ptr + stride;
+	for (; ptr != ptr_end; ptr += job->stride) {
+		ufbx_real *v = (ufbx_real*)ptr;
+		ufbx_vec3 r; // ufbxi_uninit
+		r.x = v[0] * scale.x;
+		r.y = v[1] * scale.y;
+		r.z = v[2] * scale.z;
+		if (job->has_matrix) {
+			r = ufbx_transform_position(&job->matrix, r);
+		}
+		if (job->normalize) {
+			r = ufbxi_normalize3(r);
+		}
+		v[0] = r.x;
+		v[1] = r.y;
+		v[2] = r.z;
 	}
 }
 
-ufbxi_noinline static void ufbxi_transform_vec3_list(const void *v_list, const ufbx_matrix *matrix, size_t stride)
+static bool ufbxi_geometry_task_fn(ufbxi_task *task)
+{
+	const ufbxi_geometry_task *t = (const ufbxi_geometry_task*)task->data;
+	ufbxi_run_geometry_job(t->job, t->begin, t->end);
+	return true;
+}
+
+// Queue modifying `v_list`, which must be layout compatible with `ufbx_void_list`.
+// `stride` is the size of each element in bytes, zero for `sizeof(ufbx_vec3)`.
+ufbxi_nodiscard ufbxi_noinline static int ufbxi_push_geometry_job(ufbxi_context *uc, const void *v_list, size_t stride,
+	ufbx_vec3 scale, const ufbx_matrix *matrix, bool normalize)
 {
 	const ufbx_void_list *list = (const ufbx_void_list*)v_list;
-	if (!list || list->count == 0) return;
-	if (!stride) stride = sizeof(ufbx_vec3);
+	if (!list || list->count == 0) return 1;
+	if (!matrix && scale.x == 1.0f && scale.y == 1.0f && scale.z == 1.0f) return 1;
 
-	void *ptr = list->data, *end = (char*)ptr + list->count * stride;
-	while (ptr != end) {
-		ufbx_vec3 *v = (ufbx_vec3*)ptr;
-		*v = ufbx_transform_position(matrix, *v);
-		ptr = (char*)ptr + stride;
-	}
+	ufbxi_geometry_job *job = ufbxi_push(&uc->tmp_stack, ufbxi_geometry_job, 1);
+	ufbxi_check(job);
+	job->data = (ufbx_real*)list->data;
+	job->count = list->count;
+	job->stride = stride ? stride : sizeof(ufbx_vec3);
+	job->scale = scale;
+	job->matrix = matrix ? *matrix : ufbx_identity_matrix;
+	job->has_matrix = matrix != NULL;
+	job->normalize = normalize;
+	return 1;
 }
 
 ufbxi_noinline static void ufbxi_normalize_vec3_list(const ufbx_vec3_list *list)
@@ -21087,6 +23601,10 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_flip_attrib_winding(ufbxi_contex
 		indices->data = ufbxi_push_copy(&uc->result, uint32_t, indices->count, indices->data);
 		ufbxi_check(indices->data);
 		uc->tmp_mesh_consecutive_indices = indices->data;
+	} else if (ufbxi_is_source_memory(uc, indices->data)) {
+		// Indices referencing the user memory must be copied before flipping in place.
+		indices->data = ufbxi_push_copy(&uc->result, uint32_t, indices->count, indices->data);
+		ufbxi_check(indices->data);
 	}
 
 	uint32_t *data = indices->data;
@@ -21193,120 +23711,126 @@ ufbxi_nodiscard ufbxi_noinline static int ufbxi_modify_geometry(ufbxi_context *u
 		do_scale = true;
 	}
 
-	ufbx_real geometry_scale = uc->scene.metadata.geometry_scale;
-	ufbx_mirror_axis mirror_axis = uc->mirror_axis;
+	// Positions are scaled and mirrored, directions only mirrored
+	ufbx_vec3 position_scale = { 1.0f, 1.0f, 1.0f };
+	ufbx_vec3 direction_scale = { 1.0f, 1.0f, 1.0f };
+	if (do_scale) {
+		ufbx_real geometry_scale = uc->scene.metadata.geometry_scale;
+		position_scale.x = position_scale.y = position_scale.z = geometry_scale;
+	}
+	if (do_mirror) {
+		int axis = (int)uc->mirror_axis - 1;
+		position_scale.v[axis] = -position_scale.v[axis];
+		direction_scale.v[axis] = -direction_scale.v[axis];
+	}
+
+	size_t stack_items = uc->tmp_stack.num_items;
 
 	ufbxi_for_ptr_list(ufbx_blend_shape, p_shape, uc->scene.blend_shapes) {
 		ufbx_blend_shape *shape = *p_shape;
-
-		if (do_scale) {
-			ufbxi_scale_vec3_list(&shape->position_offsets, geometry_scale, 0);
-		}
-
-		if (do_mirror) {
-			ufbxi_mirror_vec3_list(&shape->position_offsets, mirror_axis, 0);
-			ufbxi_mirror_vec3_list(&shape->normal_offsets, mirror_axis, 0);
-		}
+		ufbxi_check(ufbxi_push_geometry_job(uc, &shape->position_offsets, 0, position_scale, NULL, false));
+		ufbxi_check(ufbxi_push_geometry_job(uc, &shape->normal_offsets, 0, direction_scale, NULL, false));
 	}
 
 	ufbxi_for_ptr_list(ufbx_mesh, p_mesh, uc->scene.meshes) {
 		ufbx_mesh *mesh = *p_mesh;
 
-		if (do_scale) {
-			ufbxi_scale_vec3_list(&mesh->vertex_position.values, geometry_scale, 0);
-		}
-
-		bool do_flip_winding = do_winding;
-		if (do_mirror) {
-			ufbxi_mirror_vec3_list(&mesh->vertex_position.values, mirror_axis, 0);
-			ufbxi_mirror_vec3_list(&mesh->vertex_normal.values, mirror_axis, 0);
-			ufbxi_for_list(ufbx_uv_set, set, mesh->uv_sets) {
-				ufbxi_mirror_vec3_list(&set->vertex_tangent.values, mirror_axis, 0);
-				ufbxi_mirror_vec3_list(&set->vertex_bitangent.values, mirror_axis, 0);
-			}
-			if (!uc->opts.handedness_conversion_retain_winding) {
-				do_flip_winding = !do_flip_winding;
-			}
-		}
-
-		// Flip face winding retaining the first vertex
-		if (do_flip_winding) {
-			mesh->reversed_winding = true;
-			ufbxi_check(ufbxi_flip_winding(uc, mesh));
-		}
-
-		ufbx_node *geo_node = ufbxi_get_geometry_transform_node(&mesh->element);
-		if (do_geometry_transforms && geo_node) {
+		ufbx_node *geo_node = do_geometry_transforms ? ufbxi_get_geometry_transform_node(&mesh->element) : NULL;
+		if (geo_node) {
 			ufbx_matrix tangent_matrix = geo_node->geometry_to_node;
 			tangent_matrix.m03 = 0.0f;
 			tangent_matrix.m13 = 0.0f;
 			tangent_matrix.m23 = 0.0f;
 			ufbx_matrix normal_matrix = ufbx_matrix_for_normals(&geo_node->geometry_to_node);
 
-			ufbxi_transform_vec3_list(&mesh->vertex_position.values, &geo_node->geometry_to_node, 0);
-			ufbxi_transform_vec3_list(&mesh->vertex_normal.values, &normal_matrix, 0);
-			ufbxi_normalize_vec3_list(&mesh->vertex_normal.values);
-
+			ufbxi_check(ufbxi_push_geometry_job(uc, &mesh->vertex_position.values, 0, position_scale, &geo_node->geometry_to_node, false));
+			ufbxi_check(ufbxi_push_geometry_job(uc, &mesh->vertex_normal.values, 0, direction_scale, &normal_matrix, true));
+			ufbxi_for_list(ufbx_uv_set, set, mesh->uv_sets) {
+				ufbxi_check(ufbxi_push_geometry_job(uc, &set->vertex_tangent.values, 0, direction_scale, &tangent_matrix, true));
+				ufbxi_check(ufbxi_push_geometry_job(uc, &set->vertex_bitangent.values, 0, direction_scale, &tangent_matrix, true));
+			}
+		} else {
+			ufbxi_check(ufbxi_push_geometry_job(uc, &mesh->vertex_position.values, 0, position_scale, NULL, false));
+			ufbxi_check(ufbxi_push_geometry_job(uc, &mesh->vertex_normal.values, 0, direction_scale, NULL, false));
 			ufbxi_for_list(ufbx_uv_set, set, mesh->uv_sets) {
-				ufbxi_transform_vec3_list(&set->vertex_tangent.values, &tangent_matrix, 0);
-				ufbxi_transform_vec3_list(&set->vertex_bitangent.values, &tangent_matrix, 0);
-				ufbxi_normalize_vec3_list(&set->vertex_tangent.values);
-				ufbxi_normalize_vec3_list(&set->vertex_bitangent.values);
+				ufbxi_check(ufbxi_push_geometry_job(uc, &set->vertex_tangent.values, 0, direction_scale, NULL, false));
+				ufbxi_check(ufbxi_push_geometry_job(uc, &set->vertex_bitangent.values, 0, direction_scale, NULL, false));
 			}
 		}
 	}
 
 	ufbxi_for_ptr_list(ufbx_line_curve, p_curve, uc->scene.line_curves) {
 		ufbx_line_curve *curve = *p_curve;
-
-		if (do_scale) {
-			ufbxi_scale_vec3_list(&curve->control_points, geometry_scale, 0);
-		}
-
-		if (do_mirror) {
-			ufbxi_mirror_vec3_list(&curve->control_points, mirror_axis, 0);
-		}
-
-		ufbx_node *geo_node = ufbxi_get_geometry_transform_node(&curve->element);
-		if (do_geometry_transforms && geo_node) {
-			ufbxi_transform_vec3_list(&curve->control_points, &geo_node->geometry_to_node, 0);
-		}
+		ufbx_node *geo_node = do_geometry_transforms ? ufbxi_get_geometry_transform_node(&curve->element) : NULL;
+		const ufbx_matrix *matrix = geo_node ? &geo_node->geometry_to_node : NULL;
+		ufbxi_check(ufbxi_push_geometry_job(uc, &curve->control_points, 0, position_scale, matrix, false));
 	}
 
 	ufbxi_for_ptr_list(ufbx_nurbs_curve, p_curve, uc->scene.nurbs_curves) {
 		ufbx_nurbs_curve *curve = *p_curve;
+		ufbx_node *geo_node = do_geometry_transforms ? ufbxi_get_geometry_transform_node(&curve->element) : NULL;
+		const ufbx_matrix *matrix = geo_node ? &geo_node->geometry_to_node : NULL;
+		ufbxi_check(ufbxi_push_geometry_job(uc, &curve->control_points, sizeof(ufbx_vec4), position_scale, matrix, false));
+	}
 
-		if (do_scale) {
-			ufbxi_scale_vec3_list(&curve->control_points, geometry_scale, sizeof(ufbx_vec4));
-		}
+	ufbxi_for_ptr_list(ufbx_nurbs_surface, p_surface, uc->scene.nurbs_surfaces) {
+		ufbx_nurbs_surface *surface = *p_surface;
+		ufbx_node *geo_node = do_geometry_transforms ? ufbxi_get_geometry_transform_node(&surface->element) : NULL;
+		const ufbx_matrix *matrix = geo_node ? &geo_node->geometry_to_node : NULL;
+		ufbxi_check(ufbxi_push_geometry_job(uc, &surface->control_points, sizeof(ufbx_vec4), position_scale, matrix, false));
+	}
 
-		if (do_mirror) {
-			ufbxi_mirror_vec3_list(&curve->control_points, mirror_axis, sizeof(ufbx_vec4));
-		}
+	size_t num_jobs = uc->tmp_stack.num_items - stack_items;
+	ufbxi_geometry_job *jobs = ufbxi_push_pop(&uc->tmp, &uc->tmp_stack, ufbxi_geometry_job, num_jobs);
+	ufbxi_check(jobs);
 
-		ufbx_node *geo_node = ufbxi_get_geometry_transform_node(&curve->element);
-		if (do_geometry_transforms && geo_node) {
-			ufbxi_transform_vec3_list(&curve->control_points, &geo_node->geometry_to_node, sizeof(ufbx_vec4));
+	// Split large jobs into chunks and run them as tasks, the winding below only
+	// touches index data so it can be flipped while the tasks are running.
+	// Small jobs (or all of them without a thread pool) are processed directly.
+	bool threaded = uc->thread_pool.enabled;
+	size_t num_tasks = 0;
+	ufbxi_for(ufbxi_geometry_job, job, jobs, num_jobs) {
+		job->threaded = threaded && job->count >= UFBXI_MIN_THREADED_MODIFY_GEOMETRY_VALUES;
+		if (job->threaded) {
+			num_tasks += (job->count + UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE - 1) / UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE;
 		}
 	}
 
-	ufbxi_for_ptr_list(ufbx_nurbs_surface, p_surface, uc->scene.nurbs_surfaces) {
-		ufbx_nurbs_surface *surface = *p_surface;
+	ufbxi_geometry_task *tasks = ufbxi_push(&uc->tmp, ufbxi_geometry_task, num_tasks);
+	ufbxi_check(tasks);
 
-		if (do_scale) {
-			ufbxi_scale_vec3_list(&surface->control_points, geometry_scale, sizeof(ufbx_vec4));
+	ufbxi_geometry_task *task = tasks;
+	ufbxi_for(ufbxi_geometry_job, job, jobs, num_jobs) {
+		if (!job->threaded) {
+			ufbxi_run_geometry_job(job, 0, job->count);
+			continue;
+		}
+		for (size_t begin = 0; begin < job->count; begin += UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE) {
+			task->job = job;
+			task->begin = begin;
+			task->end = ufbxi_min_sz(begin + UFBXI_MODIFY_GEOMETRY_CHUNK_SIZE, job->count);
+			ufbxi_check(ufbxi_thread_pool_dispatch(&uc->thread_pool, &uc->error, &ufbxi_geometry_task_fn, task));
+			task++;
 		}
+	}
 
-		if (do_mirror) {
-			ufbxi_mirror_vec3_list(&surface->control_points, mirror_axis, sizeof(ufbx_vec4));
+	ufbxi_for_ptr_list(ufbx_mesh, p_mesh, uc->scene.meshes) {
+		ufbx_mesh *mesh = *p_mesh;
+
+		bool do_flip_winding = do_winding;
+		if (do_mirror && !uc->opts.handedness_conversion_retain_winding) {
+			do_flip_winding = !do_flip_winding;
 		}
 
-		ufbx_node *geo_node = ufbxi_get_geometry_transform_node(&surface->element);
-		if (do_geometry_transforms && geo_node) {
-			ufbxi_transform_vec3_list(&surface->control_points, &geo_node->geometry_to_node, sizeof(ufbx_vec4));
+		// Flip face winding retaining the first vertex
+		if (do_flip_winding) {
+			mesh->reversed_winding = true;
+			ufbxi_check(ufbxi_flip_winding(uc, mesh));
 		}
 	}
 
+	ufbxi_check(ufbxi_thread_pool_dispatch_wait(&uc->thread_pool, &uc->error));
+
 	if (uc->opts.geometry_transform_handling != UFBX_GEOMETRY_TRANSFORM_HANDLING_PRESERVE) {
 		// Reset all geometry transforms if we're not preserving them
 		ufbx_props *defaults = NULL;
@@ -22833,19 +25357,48 @@ ufbxi_noinline static ufbx_vec3 ufbxi_get_scale(const ufbx_props *props, const u
 	return t.scale;
 }
 
-ufbxi_noinline static ufbx_transform ufbxi_get_transform(const ufbx_props *props, ufbx_rotation_order order, const ufbx_node *node, const ufbx_vec3 *translation_scale)
+// Transform properties of a node, `translation`, `rotation` and `scaling` must be first
+// as `ufbx_compiled_anim` writes them as a flat array of `ufbx_real`.
+typedef struct {
+	ufbx_vec3 translation;
+	ufbx_vec3 rotation;
+	ufbx_vec3 scaling;
+	ufbx_vec3 scale_pivot;
+	ufbx_vec3 rot_pivot;
+	ufbx_vec3 scale_offset;
+	ufbx_vec3 rot_offset;
+	ufbx_vec3 pre_rotation;
+	ufbx_vec3 post_rotation;
+} ufbxi_transform_values;
+
+ufbxi_noinline static void ufbxi_get_transform_values(ufbxi_transform_values *dst, const ufbx_props *props)
 {
-	ufbx_vec3 scale_pivot = ufbxi_find_vec3(props, ufbxi_ScalingPivot, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 rot_pivot = ufbxi_find_vec3(props, ufbxi_RotationPivot, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 scale_offset = ufbxi_find_vec3(props, ufbxi_ScalingOffset, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 rot_offset = ufbxi_find_vec3(props, ufbxi_RotationOffset, 0.0f, 0.0f, 0.0f);
+	dst->scale_pivot = ufbxi_find_vec3(props, ufbxi_ScalingPivot, 0.0f, 0.0f, 0.0f);
+	dst->rot_pivot = ufbxi_find_vec3(props, ufbxi_RotationPivot, 0.0f, 0.0f, 0.0f);
+	dst->scale_offset = ufbxi_find_vec3(props, ufbxi_ScalingOffset, 0.0f, 0.0f, 0.0f);
+	dst->rot_offset = ufbxi_find_vec3(props, ufbxi_RotationOffset, 0.0f, 0.0f, 0.0f);
 
-	ufbx_vec3 translation = ufbxi_find_vec3(props, ufbxi_Lcl_Translation, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 rotation = ufbxi_find_vec3(props, ufbxi_Lcl_Rotation, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 scaling = ufbxi_find_vec3(props, ufbxi_Lcl_Scaling, 1.0f, 1.0f, 1.0f);
+	dst->translation = ufbxi_find_vec3(props, ufbxi_Lcl_Translation, 0.0f, 0.0f, 0.0f);
+	dst->rotation = ufbxi_find_vec3(props, ufbxi_Lcl_Rotation, 0.0f, 0.0f, 0.0f);
+	dst->scaling = ufbxi_find_vec3(props, ufbxi_Lcl_Scaling, 1.0f, 1.0f, 1.0f);
 
-	ufbx_vec3 pre_rotation = ufbxi_find_vec3(props, ufbxi_PreRotation, 0.0f, 0.0f, 0.0f);
-	ufbx_vec3 post_rotation = ufbxi_find_vec3(props, ufbxi_PostRotation, 0.0f, 0.0f, 0.0f);
+	dst->pre_rotation = ufbxi_find_vec3(props, ufbxi_PreRotation, 0.0f, 0.0f, 0.0f);
+	dst->post_rotation = ufbxi_find_vec3(props, ufbxi_PostRotation, 0.0f, 0.0f, 0.0f);
+}
+
+ufbxi_noinline static ufbx_transform ufbxi_get_transform_from_values(const ufbxi_transform_values *tv, ufbx_rotation_order order, const ufbx_node *node, const ufbx_vec3 *translation_scale)
+{
+	ufbx_vec3 scale_pivot = tv->scale_pivot;
+	ufbx_vec3 rot_pivot = tv->rot_pivot;
+	ufbx_vec3 scale_offset = tv->scale_offset;
+	ufbx_vec3 rot_offset = tv->rot_offset;
+
+	ufbx_vec3 translation = tv->translation;
+	ufbx_vec3 rotation = tv->rotation;
+	ufbx_vec3 scaling = tv->scaling;
+
+	ufbx_vec3 pre_rotation = tv->pre_rotation;
+	ufbx_vec3 post_rotation = tv->post_rotation;
 
 	ufbx_transform t = { { 0,0,0 }, { 0,0,0,1 }, { 1,1,1 }};
 
@@ -22897,6 +25450,15 @@ ufbxi_noinline static ufbx_transform ufbxi_get_transform(const ufbx_props *props
 		ufbxi_mirror_rotation(&t.rotation, node->adjust_mirror_axis);
 	}
 
+	return t;
+}
+
+ufbxi_noinline static ufbx_transform ufbxi_get_transform(const ufbx_props *props, ufbx_rotation_order order, const ufbx_node *node, const ufbx_vec3 *translation_scale)
+{
+	ufbxi_transform_values tv; // ufbxi_uninit
+	ufbxi_get_transform_values(&tv, props);
+	ufbx_transform t = ufbxi_get_transform_from_values(&tv, order, node, translation_scale);
+
 	// Make sure the fast paths are identical to this function.
 	ufbxi_regression_assert(ufbxi_is_quat_equal(t.rotation, ufbxi_get_rotation(props, order, node)));
 	ufbxi_regression_assert(ufbxi_is_vec3_equal(t.scale, ufbxi_get_scale(props, node)));
@@ -23954,6 +26516,9 @@ typedef struct {
 	bool owned_by_scene;
 
 	ufbxi_buf string_buf;
+
+	// Files mapped with `ufbx_geometry_cache_opts.retain_file_data`, `NULL` if `owned_by_scene`.
+	ufbxi_file_map *file_maps;
 } ufbxi_geometry_cache_imp;
 
 ufbx_static_assert(geometry_cache_imp_offset, offsetof(ufbxi_geometry_cache_imp, cache) == sizeof(ufbxi_refcount));
@@ -24030,6 +26595,9 @@ typedef struct {
 	ufbx_geometry_cache cache;
 	ufbxi_geometry_cache_imp *imp;
 
+	// Files mapped for retained frame data, allocated from `result`.
+	ufbxi_file_map *file_maps;
+
 	char buffer[128];
 } ufbxi_cache_context;
 
@@ -24633,6 +27201,163 @@ static ufbxi_noinline int ufbxi_cache_setup_channels(ufbxi_cache_context *cc)
 	return 1;
 }
 
+// Skip `offset` bytes from the beginning of `stream`, returns `false` if the file is too short.
+static ufbxi_noinline bool ufbxi_cache_skip_stream(ufbx_stream *stream, uint64_t offset)
+{
+	if (stream->skip_fn) {
+		while (offset > 0) {
+			size_t to_skip = (size_t)ufbxi_min64(offset, UFBXI_MAX_SKIP_SIZE);
+			if (!stream->skip_fn(stream->user, to_skip)) break;
+			offset -= to_skip;
+		}
+	} else {
+		char buffer[4096]; // ufbxi_uninit
+		while (offset > 0) {
+			size_t to_skip = (size_t)ufbxi_min64(offset, sizeof(buffer));
+			size_t num_read = stream->read_fn(stream->user, buffer, to_skip);
+			if (num_read != to_skip) break;
+			offset -= to_skip;
+		}
+	}
+	return offset == 0;
+}
+
+static ufbxi_noinline bool ufbxi_cmp_cache_frame_file_less(void *user, const void *va, const void *vb)
+{
+	(void)user;
+	const ufbx_cache_frame *a = *(const ufbx_cache_frame *const*)va, *b = *(const ufbx_cache_frame *const*)vb;
+	if (a->filename.data != b->filename.data) {
+		int cmp = ufbxi_str_cmp(a->filename, b->filename);
+		if (cmp != 0) return cmp < 0;
+	}
+	return a->data_offset < b->data_offset;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_read_retained_range(ufbxi_cache_context *cc, ufbx_stream *stream, uint64_t begin, uint64_t end, size_t *p_num_read)
+{
+	*p_num_read = 0;
+	if (!ufbxi_cache_skip_stream(stream, begin)) return 1;
+
+	// Read in chunks so that truncated files only use as much memory as they contain
+	uint64_t size = end - begin;
+	size_t num_read = 0;
+	while (num_read < size) {
+		size_t to_read = (size_t)ufbxi_min64(size - num_read, UFBXI_GEOMETRY_CACHE_RETAIN_CHUNK_SIZE);
+		char *dst = ufbxi_push(&cc->tmp_stack, char, to_read);
+		ufbxi_check_err(&cc->error, dst);
+
+		size_t chunk_read = stream->read_fn(stream->user, dst, to_read);
+		if (chunk_read > to_read) chunk_read = 0;
+		num_read += chunk_read;
+		if (chunk_read < to_read) {
+			ufbxi_pop(&cc->tmp_stack, char, to_read - chunk_read, NULL);
+			break;
+		}
+	}
+
+	*p_num_read = num_read;
+	return 1;
+}
+
+// Read the data of `frames` that all refer to the same file into memory.
+// If the file cannot be opened anymore the frames are left to read it on demand.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_retain_file(ufbxi_cache_context *cc, ufbx_cache_frame **frames, size_t num_frames)
+{
+	uint64_t begin = UINT64_MAX, end = 0;
+	for (size_t i = 0; i < num_frames; i++) {
+		const ufbx_cache_frame *frame = frames[i];
+		if (frame->data_total_bytes == 0 || frame->data_offset > UINT64_MAX - frame->data_total_bytes) continue;
+		begin = ufbxi_min64(begin, frame->data_offset);
+		end = ufbxi_max64(end, frame->data_offset + frame->data_total_bytes);
+	}
+	if (begin >= end || end - begin > SIZE_MAX) return 1;
+
+	ufbx_string filename = frames[0]->filename;
+
+	// Map the file if we can open it ourselves, the frames then refer to the mapping
+	// so only the pages that are actually read are loaded into memory.
+	if (cc->open_file_cb.fn == &ufbx_default_open_file) {
+		ufbxi_file_map map; // ufbxi_uninit
+		ufbxi_check_err(&cc->error, ufbxi_map_file(cc->ator_tmp, &map, filename.data, filename.length, true));
+		if (map.data) {
+			ufbxi_file_map *retained = ufbxi_push(&cc->result, ufbxi_file_map, 1);
+			if (!retained) {
+				ufbxi_unmap_files(&map);
+				ufbxi_fail_err(&cc->error, "Out of memory");
+			}
+			*retained = map;
+			retained->next = cc->file_maps;
+			cc->file_maps = retained;
+
+			for (size_t i = 0; i < num_frames; i++) {
+				ufbx_cache_frame *frame = frames[i];
+				if (frame->data_total_bytes == 0 || frame->data_offset >= map.size) continue;
+				size_t offset = (size_t)frame->data_offset;
+				frame->data.data = (const char*)map.data + offset;
+				frame->data.size = (size_t)ufbxi_min64(frame->data_total_bytes, map.size - offset);
+			}
+			return 1;
+		}
+	}
+
+	// Otherwise read the range covered by the frames into memory
+	ufbx_stream stream = { 0 };
+	if (!ufbxi_open_file(&cc->open_file_cb, &stream, filename.data, filename.length, NULL, cc->ator_tmp, UFBX_OPEN_FILE_GEOMETRY_CACHE)) {
+		return 1;
+	}
+
+	size_t num_read = 0;
+	int ok = ufbxi_cache_read_retained_range(cc, &stream, begin, end, &num_read);
+	if (stream.close_fn) {
+		stream.close_fn(stream.user);
+	}
+	ufbxi_check_err(&cc->error, ok);
+
+	const char *data = ufbxi_push_pop(&cc->result, &cc->tmp_stack, char, num_read);
+	ufbxi_check_err(&cc->error, data);
+
+	for (size_t i = 0; i < num_frames; i++) {
+		ufbx_cache_frame *frame = frames[i];
+		if (frame->data_total_bytes == 0 || frame->data_offset < begin || frame->data_offset - begin > end - begin) continue;
+		size_t offset = (size_t)(frame->data_offset - begin);
+		size_t size = (size_t)ufbxi_min64(frame->data_total_bytes, end - frame->data_offset);
+		if (offset >= num_read) {
+			offset = num_read;
+			size = 0;
+		} else {
+			size = ufbxi_min_sz(size, num_read - offset);
+		}
+		frame->data.data = data + offset;
+		frame->data.size = size;
+	}
+
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_retain_frame_data(ufbxi_cache_context *cc)
+{
+	size_t num_frames = cc->cache.frames.count;
+	if (num_frames == 0) return 1;
+
+	ufbx_cache_frame **frames = ufbxi_push(&cc->tmp, ufbx_cache_frame*, num_frames);
+	ufbxi_check_err(&cc->error, frames);
+	for (size_t i = 0; i < num_frames; i++) {
+		frames[i] = &cc->cache.frames.data[i];
+	}
+	ufbxi_unstable_sort(frames, num_frames, sizeof(ufbx_cache_frame*), &ufbxi_cmp_cache_frame_file_less, NULL);
+
+	size_t begin = 0;
+	while (begin < num_frames) {
+		size_t end = begin + 1;
+		while (end < num_frames && ufbxi_str_equal(frames[end]->filename, frames[begin]->filename)) {
+			end++;
+		}
+		ufbxi_check_err(&cc->error, ufbxi_cache_retain_file(cc, frames + begin, end - begin));
+		begin = end;
+	}
+
+	return 1;
+}
 
 static ufbxi_noinline int ufbxi_cache_load_imp(ufbxi_cache_context *cc, ufbx_string filename)
 {
@@ -24672,6 +27397,10 @@ static ufbxi_noinline int ufbxi_cache_load_imp(ufbxi_cache_context *cc, ufbx_str
 	ufbxi_check_err(&cc->error, ufbxi_cache_sort_frames(cc, cc->cache.frames.data, cc->cache.frames.count));
 	ufbxi_check_err(&cc->error, ufbxi_cache_setup_channels(cc));
 
+	if (cc->opts.retain_file_data) {
+		ufbxi_check_err(&cc->error, ufbxi_cache_retain_frame_data(cc));
+	}
+
 	// Must be last allocation!
 	cc->imp = ufbxi_push(&cc->result, ufbxi_geometry_cache_imp, 1);
 	ufbxi_check_err(&cc->error, cc->imp);
@@ -24681,6 +27410,7 @@ static ufbxi_noinline int ufbxi_cache_load_imp(ufbxi_cache_context *cc, ufbx_str
 	cc->imp->cache = cc->cache;
 	cc->imp->magic = UFBXI_CACHE_IMP_MAGIC;
 	cc->imp->owned_by_scene = cc->owned_by_scene;
+	cc->imp->file_maps = cc->owned_by_scene ? NULL : cc->file_maps;
 	cc->imp->refcount.ator = cc->ator_result;
 	cc->imp->refcount.buf = cc->result;
 	cc->imp->refcount.buf.ator = &cc->imp->refcount.ator;
@@ -24707,6 +27437,8 @@ ufbxi_noinline static ufbx_geometry_cache *ufbxi_cache_load(ufbxi_cache_context
 		return &cc->imp->cache;
 	} else {
 		ufbxi_fix_error_type(&cc->error, "Failed to load geometry cache", NULL);
+		ufbxi_unmap_files(cc->file_maps);
+		cc->file_maps = NULL;
 		if (!cc->owned_by_scene) {
 			ufbxi_buf_free(&cc->string_pool.buf);
 			ufbxi_free_ator(&cc->ator_result);
@@ -24757,9 +27489,343 @@ ufbxi_noinline static ufbx_geometry_cache *ufbxi_load_geometry_cache(ufbx_string
 static ufbxi_noinline void ufbxi_free_geometry_cache_imp(ufbxi_geometry_cache_imp *imp)
 {
 	ufbx_assert(imp->magic == UFBXI_CACHE_IMP_MAGIC);
+	ufbxi_unmap_files(imp->file_maps);
 	ufbxi_buf_free(&imp->string_buf);
 }
 
+// -- Cache player
+
+typedef struct {
+	size_t frame_index; // < `SIZE_MAX` if the slot is empty
+	size_t batch;       // < Batch the read task was started in if `pending`
+	bool pending;
+
+	const ufbx_cache_frame *frame;
+	const ufbx_geometry_cache_data_opts *read_opts;
+	ufbx_real *values;
+	size_t capacity;
+	size_t num_values;
+} ufbxi_cache_player_slot;
+
+typedef struct {
+	ufbx_cache_player player;
+	uint32_t magic;
+
+	ufbx_error error;
+	ufbxi_allocator ator;
+	ufbxi_thread_pool thread_pool;
+	ufbx_geometry_cache_data_opts read_opts;
+
+	ufbxi_cache_player_slot *slots;
+	size_t num_slots;
+	ufbx_real *values;
+
+	// Each batch of reads is flushed as a thread pool group, batches before
+	// `num_finished` have been waited for.
+	size_t num_batches;
+	size_t num_finished;
+} ufbxi_cache_player_imp;
+
+static bool ufbxi_cache_player_read_task(ufbxi_task *task)
+{
+	ufbxi_cache_player_slot *slot = (ufbxi_cache_player_slot*)task->data;
+	slot->num_values = ufbx_read_geometry_cache_real(slot->frame, slot->values, slot->capacity, slot->read_opts);
+	return true;
+}
+
+// Wait for the group we are about to reuse, it was last flushed `UFBX_THREAD_GROUP_COUNT` batches ago.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_begin_batch(ufbxi_cache_player_imp *imp)
+{
+	ufbxi_check_err(&imp->error, ufbxi_thread_pool_wait_group(&imp->thread_pool));
+	if (imp->num_batches >= UFBX_THREAD_GROUP_COUNT) {
+		imp->num_finished = imp->num_batches - UFBX_THREAD_GROUP_COUNT + 1;
+	}
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_cache_player_end_batch(ufbxi_cache_player_imp *imp)
+{
+	ufbxi_thread_pool_flush_group(&imp->thread_pool);
+	imp->num_batches++;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_wait_slot(ufbxi_cache_player_imp *imp, ufbxi_cache_player_slot *slot)
+{
+	// Groups must be waited in order, flush empty batches to advance to the one containing `slot`
+	while (slot->pending && slot->batch >= imp->num_finished) {
+		ufbxi_check_err(&imp->error, ufbxi_cache_player_begin_batch(imp));
+		ufbxi_cache_player_end_batch(imp);
+	}
+	slot->pending = false;
+	return 1;
+}
+
+static ufbxi_noinline ufbxi_cache_player_slot *ufbxi_cache_player_find_slot(ufbxi_cache_player_imp *imp, size_t frame_index)
+{
+	ufbxi_for(ufbxi_cache_player_slot, slot, imp->slots, imp->num_slots) {
+		if (slot->frame_index == frame_index) return slot;
+	}
+	return NULL;
+}
+
+// Find a slot that is not needed for sampling or prefetching from `base_index`, preferring
+// empty slots and frames that playback has already passed.
+static ufbxi_noinline ufbxi_cache_player_slot *ufbxi_cache_player_find_victim(ufbxi_cache_player_imp *imp, size_t base_index, bool allow_pending)
+{
+	ufbxi_cache_player_slot *best = NULL;
+	size_t best_score = 0;
+	size_t window_end = imp->player.window_size + 2;
+	ufbxi_for(ufbxi_cache_player_slot, slot, imp->slots, imp->num_slots) {
+		if (slot->pending && slot->batch >= imp->num_finished && !allow_pending) continue;
+
+		size_t score = SIZE_MAX;
+		if (slot->frame_index != SIZE_MAX) {
+			size_t index = slot->frame_index;
+			bool behind = imp->player.reverse ? index > base_index : index < base_index;
+			size_t ahead = imp->player.reverse ? base_index - index : index - base_index;
+			if (behind) {
+				score = SIZE_MAX - 1;
+			} else if (ahead >= window_end) {
+				score = ahead;
+			} else {
+				continue;
+			}
+		}
+
+		if (score > best_score) {
+			best = slot;
+			best_score = score;
+		}
+	}
+	return best;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_acquire(ufbxi_cache_player_imp *imp, size_t frame_index, size_t base_index, ufbxi_cache_player_slot **p_slot)
+{
+	ufbxi_cache_player_slot *slot = ufbxi_cache_player_find_slot(imp, frame_index);
+	if (!slot) {
+		slot = ufbxi_cache_player_find_victim(imp, base_index, true);
+		ufbx_assert(slot);
+		ufbxi_check_err(&imp->error, slot);
+		ufbxi_check_err(&imp->error, ufbxi_cache_player_wait_slot(imp, slot));
+
+		// Not prefetched, read synchronously
+		slot->frame_index = frame_index;
+		slot->frame = &imp->player.channel->frames.data[frame_index];
+		slot->num_values = ufbx_read_geometry_cache_real(slot->frame, slot->values, slot->capacity, slot->read_opts);
+	}
+
+	ufbxi_check_err(&imp->error, ufbxi_cache_player_wait_slot(imp, slot));
+	*p_slot = slot;
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_prefetch(ufbxi_cache_player_imp *imp, size_t base_index)
+{
+	if (!imp->thread_pool.enabled) return 1;
+
+	size_t num_frames = imp->player.channel->frames.count;
+	bool in_batch = false;
+	for (size_t offset = 2; offset < imp->player.window_size + 2; offset++) {
+		size_t frame_index = SIZE_MAX;
+		if (imp->player.reverse) {
+			if (offset <= base_index) frame_index = base_index - offset;
+		} else {
+			if (offset < num_frames - base_index) frame_index = base_index + offset;
+		}
+		if (frame_index == SIZE_MAX) break;
+		if (ufbxi_cache_player_find_slot(imp, frame_index)) continue;
+
+		if (!in_batch) {
+			ufbxi_check_err(&imp->error, ufbxi_cache_player_begin_batch(imp));
+			in_batch = true;
+		}
+
+		ufbxi_cache_player_slot *slot = ufbxi_cache_player_find_victim(imp, base_index, false);
+		if (!slot) break;
+
+		ufbxi_task *task = ufbxi_thread_pool_create_task(&imp->thread_pool, &ufbxi_cache_player_read_task);
+		if (!task) break;
+
+		slot->frame_index = frame_index;
+		slot->frame = &imp->player.channel->frames.data[frame_index];
+		slot->pending = true;
+		slot->batch = imp->num_batches;
+		task->data = slot;
+		ufbxi_thread_pool_run_task(&imp->thread_pool, task);
+	}
+
+	if (in_batch) {
+		ufbxi_cache_player_end_batch(imp);
+	}
+
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_cache_player_blend(ufbx_real *dst, const ufbx_real *src, size_t count, ufbx_real weight, bool additive)
+{
+	if (additive) {
+		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
+			dst[i] += src[i] * weight;
+		}
+	} else {
+		ufbxi_nounroll for (size_t i = 0; i < count; i++) {
+			dst[i] = src[i] * weight;
+		}
+	}
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_sample_imp(ufbxi_cache_player_imp *imp, double time, ufbx_real *data, size_t count, const ufbx_geometry_cache_data_opts *opts, size_t *p_num_read)
+{
+	const ufbx_cache_channel *channel = imp->player.channel;
+	const ufbx_cache_frame *frames = channel->frames.data;
+	size_t num_frames = channel->frames.count;
+
+	// Find the frames to blend the same way as `ufbx_sample_geometry_cache_real()`
+	size_t begin = 0;
+	size_t end = num_frames;
+	while (end - begin >= 8) {
+		size_t mid = (begin + end) >> 1;
+		if (frames[mid].time < time) {
+			begin = mid + 1;
+		} else {
+			end = mid;
+		}
+	}
+	for (; begin < num_frames; begin++) {
+		if (frames[begin].time >= time) break;
+	}
+
+	const double eps = 0.00000001;
+
+	size_t prev_index = SIZE_MAX, next_index = SIZE_MAX;
+	double t = 0.0;
+	if (begin == num_frames) {
+		next_index = num_frames - 1;
+	} else if (begin == 0 || ufbx_fabs(frames[begin].time - time) < eps) {
+		next_index = begin;
+	} else if (ufbx_fabs(frames[begin - 1].time - time) < eps) {
+		next_index = begin - 1;
+	} else {
+		prev_index = begin - 1;
+		next_index = begin;
+		t = (time - frames[prev_index].time) * (1.0 / (frames[next_index].time - frames[prev_index].time));
+	}
+
+	// Playback position that is kept decoded, prefetching continues from here
+	size_t base_index = prev_index != SIZE_MAX && !imp->player.reverse ? prev_index : next_index;
+
+	ufbxi_cache_player_slot *prev = NULL, *next = NULL;
+	if (prev_index != SIZE_MAX) {
+		ufbxi_check_err(&imp->error, ufbxi_cache_player_acquire(imp, prev_index, base_index, &prev));
+	}
+	ufbxi_check_err(&imp->error, ufbxi_cache_player_acquire(imp, next_index, base_index, &next));
+
+	// Start reading the upcoming frames before blending the current ones
+	ufbxi_check_err(&imp->error, ufbxi_cache_player_prefetch(imp, base_index));
+
+	ufbx_real weight = opts->use_weight ? opts->weight : 1.0f;
+	size_t num_read = ufbxi_min_sz(count, next->num_values);
+	if (prev) {
+		num_read = ufbxi_min_sz(num_read, prev->num_values);
+		ufbxi_cache_player_blend(data, prev->values, num_read, (ufbx_real)(weight * (1.0 - t)), opts->additive);
+		ufbxi_cache_player_blend(data, next->values, num_read, (ufbx_real)(weight * t), true);
+	} else {
+		ufbxi_cache_player_blend(data, next->values, num_read, weight, opts->additive);
+	}
+
+	*p_num_read = num_read;
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_cache_player_init(ufbxi_cache_player_imp *imp, const ufbx_cache_channel *channel, const ufbx_cache_player_opts *opts)
+{
+	imp->player.channel = channel;
+	imp->player.window_size = opts->window_size > 0 ? opts->window_size : 4;
+	imp->player.reverse = opts->reverse;
+
+	size_t max_values = 0;
+	ufbxi_for_list(const ufbx_cache_frame, frame, channel->frames) {
+		size_t num_values = frame->data_count;
+		if (frame->data_format == UFBX_CACHE_DATA_FORMAT_VEC3_FLOAT || frame->data_format == UFBX_CACHE_DATA_FORMAT_VEC3_DOUBLE) {
+			num_values *= 3;
+		}
+		max_values = ufbxi_max_sz(max_values, num_values);
+	}
+	imp->player.max_values = max_values;
+
+	imp->read_opts.open_file_cb = opts->open_file_cb;
+	imp->read_opts.ignore_transform = opts->ignore_transform;
+
+	ufbxi_check_err(&imp->error, imp->player.window_size <= SIZE_MAX / 2);
+	imp->num_slots = imp->player.window_size + 2;
+	imp->slots = ufbxi_alloc(&imp->ator, ufbxi_cache_player_slot, imp->num_slots);
+	ufbxi_check_err(&imp->error, imp->slots);
+	memset(imp->slots, 0, sizeof(ufbxi_cache_player_slot) * imp->num_slots);
+	if (max_values > 0) {
+		ufbxi_check_err(&imp->error, max_values <= SIZE_MAX / imp->num_slots);
+		imp->values = ufbxi_alloc(&imp->ator, ufbx_real, imp->num_slots * max_values);
+		ufbxi_check_err(&imp->error, imp->values);
+	}
+
+	for (size_t i = 0; i < imp->num_slots; i++) {
+		ufbxi_cache_player_slot *slot = &imp->slots[i];
+		slot->frame_index = SIZE_MAX;
+		slot->read_opts = &imp->read_opts;
+		slot->values = imp->values ? imp->values + i * max_values : NULL;
+		slot->capacity = max_values;
+	}
+
+	ufbxi_check_err(&imp->error, ufbxi_thread_pool_init(&imp->thread_pool, &imp->error, &imp->ator, &opts->thread_opts));
+
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_free_cache_player_imp(ufbxi_cache_player_imp *imp)
+{
+	ufbxi_thread_pool_free(&imp->thread_pool);
+
+	ufbxi_allocator ator = imp->ator;
+	if (imp->values) {
+		ufbxi_free(&ator, ufbx_real, imp->values, imp->num_slots * imp->player.max_values);
+	}
+	if (imp->slots) {
+		ufbxi_free(&ator, ufbxi_cache_player_slot, imp->slots, imp->num_slots);
+	}
+	ufbxi_free(&ator, ufbxi_cache_player_imp, imp, 1);
+	ufbxi_free_ator(&ator);
+}
+
+static ufbxi_noinline ufbx_cache_player *ufbxi_create_cache_player(const ufbx_cache_channel *channel, const ufbx_cache_player_opts *opts, ufbx_error *error)
+{
+	ufbx_error local_error = { UFBX_ERROR_NONE };
+	ufbxi_allocator ator = { 0 };
+	ufbxi_init_ator(&local_error, &ator, &opts->result_allocator, "result");
+
+	ufbxi_cache_player_imp *imp = ufbxi_alloc(&ator, ufbxi_cache_player_imp, 1);
+	if (!imp) {
+		ufbxi_fix_error_type(&local_error, "Failed to create cache player", error);
+		ufbxi_free_ator(&ator);
+		return NULL;
+	}
+	memset(imp, 0, sizeof(ufbxi_cache_player_imp));
+
+	imp->magic = UFBXI_CACHE_PLAYER_IMP_MAGIC;
+	imp->ator = ator;
+	imp->ator.error = &imp->error;
+
+	if (!ufbxi_cache_player_init(imp, channel, opts)) {
+		ufbxi_fix_error_type(&imp->error, "Failed to create cache player", error);
+		ufbxi_free_cache_player_imp(imp);
+		return NULL;
+	}
+
+	if (error) {
+		ufbxi_clear_error(error);
+	}
+	return &imp->player;
+}
+
 #else
 
 typedef struct {
@@ -24782,6 +27848,16 @@ static ufbxi_forceinline void ufbxi_free_geometry_cache_imp(ufbxi_geometry_cache
 {
 }
 
+static ufbxi_noinline ufbx_cache_player *ufbxi_create_cache_player(const ufbx_cache_channel *channel, const ufbx_cache_player_opts *opts, ufbx_error *error)
+{
+	if (error) {
+		memset(error, 0, sizeof(ufbx_error));
+		ufbxi_fmt_err_info(error, "UFBX_ENABLE_GEOMETRY_CACHE");
+		ufbxi_report_err_msg(error, "UFBXI_FEATURE_GEOMETRY_CACHE", "Feature disabled");
+	}
+	return NULL;
+}
+
 #endif
 
 // -- External files
@@ -24827,6 +27903,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_external_cache(ufbxi_contex
 	cc.opts.mirror_axis = uc->mirror_axis;
 	cc.opts.use_scale_factor = true;
 	cc.opts.scale_factor = uc->scene.metadata.geometry_scale;
+	cc.opts.retain_file_data = uc->opts.retain_geometry_cache_data;
 
 	ufbx_geometry_cache *cache = ufbxi_cache_load(&cc, file->filename);
 	if (!cache) {
@@ -24840,6 +27917,17 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_external_cache(ufbxi_contex
 	uc->string_pool = cc.string_pool;
 	uc->result = cc.result;
 
+	// The scene owns the mapped files of the cache
+	if (cache) {
+		ufbxi_file_map *map = cc.file_maps;
+		while (map) {
+			ufbxi_file_map *next = map->next;
+			map->next = uc->file_maps;
+			uc->file_maps = map;
+			map = next;
+		}
+	}
+
 	if (!cache) {
 		if (cc.error.type == UFBX_ERROR_FILE_NOT_FOUND) {
 			if (uc->opts.ignore_missing_external_files) {
@@ -25009,6 +28097,295 @@ static ufbxi_noinline int ufbxi_scale_units(ufbxi_context *uc, ufbx_real target_
 	return 1;
 }
 
+// -- Skinning
+
+#if UFBXI_FEATURE_SKINNING_EVALUATION
+
+// Skin cluster transforms packed into contiguous arrays for batched evaluation.
+// `dual_quats[]` contains 12 reals per cluster: real part, dual part, scale and padding.
+typedef struct {
+	ufbx_matrix *matrices;
+	ufbx_real *dual_quats;
+	bool *valid;
+	size_t num_clusters;
+} ufbxi_skin_clusters;
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_alloc_skin_clusters(ufbxi_skin_clusters *sc, ufbx_error *error, ufbxi_buf *buf, size_t max_clusters)
+{
+	sc->matrices = ufbxi_push(buf, ufbx_matrix, max_clusters);
+	sc->dual_quats = ufbxi_push(buf, ufbx_real, max_clusters * 12);
+	sc->valid = ufbxi_push(buf, bool, max_clusters);
+	sc->num_clusters = 0;
+	ufbxi_check_err(error, sc->matrices && sc->dual_quats && sc->valid);
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_pack_skin_clusters(ufbxi_skin_clusters *sc, const ufbx_skin_deformer *skin)
+{
+	size_t num_clusters = skin->clusters.count;
+	for (size_t i = 0; i < num_clusters; i++) {
+		const ufbx_skin_cluster *cluster = skin->clusters.data[i];
+		ufbx_transform t = cluster->geometry_to_world_transform;
+		ufbx_quat vqt = { 0.5f * t.translation.x, 0.5f * t.translation.y, 0.5f * t.translation.z };
+		ufbx_quat vqe = ufbxi_mul_quat(vqt, t.rotation);
+
+		ufbx_real *dq = sc->dual_quats + i * 12;
+		dq[0] = t.rotation.x; dq[1] = t.rotation.y; dq[2] = t.rotation.z; dq[3] = t.rotation.w;
+		dq[4] = vqe.x; dq[5] = vqe.y; dq[6] = vqe.z; dq[7] = vqe.w;
+		dq[8] = t.scale.x; dq[9] = t.scale.y; dq[10] = t.scale.z; dq[11] = 0.0f;
+
+		sc->matrices[i] = cluster->geometry_to_world;
+		sc->valid[i] = cluster->bone_node != NULL;
+	}
+	sc->num_clusters = num_clusters;
+}
+
+// `dst[i] += src[i] * weight` for `count` reals, `count` must be a multiple of four.
+// NOTE: Must round exactly like the scalar code so results match `ufbx_get_skin_vertex_matrix()`.
+static ufbxi_forceinline void ufbxi_skin_add_weighted(ufbx_real *dst, const ufbx_real *src, ufbx_real weight, size_t count)
+{
+	size_t i = 0;
+#if UFBXI_HAS_AVX2
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		const __m256d w = _mm256_set1_pd((double)weight);
+		for (; i < count; i += 4) {
+			__m256d d = _mm256_loadu_pd((const double*)dst + i);
+			__m256d s = _mm256_loadu_pd((const double*)src + i);
+			_mm256_storeu_pd((double*)dst + i, _mm256_add_pd(d, _mm256_mul_pd(s, w)));
+		}
+		return;
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const __m256 w = _mm256_set1_ps((float)weight);
+		for (; i + 8 <= count; i += 8) {
+			__m256 d = _mm256_loadu_ps((const float*)dst + i);
+			__m256 s = _mm256_loadu_ps((const float*)src + i);
+			_mm256_storeu_ps((float*)dst + i, _mm256_add_ps(d, _mm256_mul_ps(s, w)));
+		}
+	}
+#endif
+#if UFBXI_HAS_SSE
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		const __m128d w = _mm_set1_pd((double)weight);
+		for (; i < count; i += 2) {
+			__m128d d = _mm_loadu_pd((const double*)dst + i);
+			__m128d s = _mm_loadu_pd((const double*)src + i);
+			_mm_storeu_pd((double*)dst + i, _mm_add_pd(d, _mm_mul_pd(s, w)));
+		}
+		return;
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const __m128 w = _mm_set1_ps((float)weight);
+		for (; i < count; i += 4) {
+			__m128 d = _mm_loadu_ps((const float*)dst + i);
+			__m128 s = _mm_loadu_ps((const float*)src + i);
+			_mm_storeu_ps((float*)dst + i, _mm_add_ps(d, _mm_mul_ps(s, w)));
+		}
+		return;
+	}
+#elif UFBXI_HAS_NEON
+	// NOTE: Separate multiply and add as fused `vfmaq` would round differently.
+	if (sizeof(ufbx_real) == sizeof(double)) {
+#if UFBXI_HAS_NEON_F64
+		const float64x2_t w = vdupq_n_f64((double)weight);
+		for (; i < count; i += 2) {
+			float64x2_t d = vld1q_f64((const double*)dst + i);
+			float64x2_t s = vld1q_f64((const double*)src + i);
+			vst1q_f64((double*)dst + i, vaddq_f64(d, vmulq_f64(s, w)));
+		}
+		return;
+#endif
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		const float32x4_t w = vdupq_n_f32((float)weight);
+		for (; i < count; i += 4) {
+			float32x4_t d = vld1q_f32((const float*)dst + i);
+			float32x4_t s = vld1q_f32((const float*)src + i);
+			vst1q_f32((float*)dst + i, vaddq_f32(d, vmulq_f32(s, w)));
+		}
+		return;
+	}
+#endif
+
+	for (; i < count; i++) {
+		dst[i] += src[i] * weight;
+	}
+}
+
+// Batched version of `ufbx_get_skin_vertex_matrix()`, see it for the reference implementation.
+static ufbxi_noinline void ufbxi_skin_vertices_imp(const ufbxi_skin_clusters *sc, const ufbx_skin_deformer *skin, size_t vertex_offset,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_matrix *fallback)
+{
+	ufbx_assert(vertex_offset <= skin->vertices.count && count <= skin->vertices.count - vertex_offset);
+
+	for (size_t vertex_ix = 0; vertex_ix < count; vertex_ix++) {
+		ufbx_skin_vertex skin_vertex = skin->vertices.data[vertex_offset + vertex_ix];
+		const ufbx_skin_weight *weights = skin->weights.data + skin_vertex.weight_begin;
+		ufbx_real dq_weight = skin_vertex.dq_weight;
+		ufbx_real lbs_weight = 1.0f - dq_weight;
+		bool use_dq = dq_weight > 0.0f;
+		bool use_lbs = dq_weight < 1.0f;
+
+		ufbx_matrix mat = { 0.0f };
+		ufbx_real dq[12] = { 0.0f };
+		const ufbx_real *first_q0 = NULL;
+		ufbx_real total_weight = 0.0f;
+
+		for (uint32_t i = 0; i < skin_vertex.num_weights; i++) {
+			ufbx_skin_weight weight = weights[i];
+			size_t cluster_ix = weight.cluster_index;
+			ufbx_assert(cluster_ix < sc->num_clusters);
+			if (!sc->valid[cluster_ix]) continue;
+
+			total_weight += weight.weight;
+			if (use_dq) {
+				const ufbx_real *vdq = sc->dual_quats + cluster_ix * 12;
+				if (i == 0) first_q0 = vdq;
+
+				// Flip to the same hemisphere as the first quaternion by negating the weight
+				ufbx_real dq_sign_weight = weight.weight;
+				if (first_q0 && first_q0[0]*vdq[0] + first_q0[1]*vdq[1] + first_q0[2]*vdq[2] + first_q0[3]*vdq[3] < 0.0f) {
+					dq_sign_weight = -dq_sign_weight;
+				}
+
+				ufbxi_skin_add_weighted(dq, vdq, dq_sign_weight, 8);
+				ufbxi_skin_add_weighted(dq + 8, vdq + 8, weight.weight, 4);
+			}
+
+			if (use_lbs) {
+				ufbxi_skin_add_weighted(mat.v, sc->matrices[cluster_ix].v, lbs_weight * weight.weight, 12);
+			}
+		}
+
+		if (total_weight <= 0.0f) {
+			mat = fallback ? *fallback : ufbx_identity_matrix;
+		} else {
+			if (ufbx_fabs(total_weight - 1.0f) > UFBX_EPSILON) {
+				ufbx_real rcp_weight = ufbx_fabs(total_weight) > UFBX_EPSILON ? 1.0f / total_weight : 0.0f;
+				if (use_dq) {
+					for (size_t i = 0; i < 11; i++) dq[i] *= rcp_weight;
+				}
+				if (use_lbs) {
+					for (size_t i = 0; i < 12; i++) mat.v[i] *= rcp_weight;
+				}
+			}
+
+			if (use_dq) {
+				const ufbx_real *q0 = dq, *qe = dq + 4, *qs = dq + 8;
+				ufbx_transform dqt; // ufbxi_uninit
+				ufbx_real rcp_len = (ufbx_real)(1.0 / ufbx_sqrt(q0[0]*q0[0] + q0[1]*q0[1] + q0[2]*q0[2] + q0[3]*q0[3]));
+				ufbx_real rcp_len2x2 = 2.0f * rcp_len * rcp_len;
+				dqt.rotation.x = q0[0] * rcp_len;
+				dqt.rotation.y = q0[1] * rcp_len;
+				dqt.rotation.z = q0[2] * rcp_len;
+				dqt.rotation.w = q0[3] * rcp_len;
+				dqt.scale.x = qs[0];
+				dqt.scale.y = qs[1];
+				dqt.scale.z = qs[2];
+				dqt.translation.x = rcp_len2x2 * (- qe[3]*q0[0] + qe[0]*q0[3] - qe[1]*q0[2] + qe[2]*q0[1]);
+				dqt.translation.y = rcp_len2x2 * (- qe[3]*q0[1] + qe[0]*q0[2] + qe[1]*q0[3] - qe[2]*q0[0]);
+				dqt.translation.z = rcp_len2x2 * (- qe[3]*q0[2] - qe[0]*q0[1] + qe[1]*q0[0] + qe[2]*q0[3]);
+				ufbx_matrix dqm = ufbx_transform_to_matrix(&dqt);
+				if (use_lbs) {
+					ufbxi_skin_add_weighted(mat.v, dqm.v, dq_weight, 12);
+				} else {
+					mat = dqm;
+				}
+			}
+		}
+
+		if (positions_out) {
+			ufbx_vec3 v = positions_in[vertex_ix];
+			ufbx_vec3 r; // ufbxi_uninit
+			r.x = mat.m00*v.x + mat.m01*v.y + mat.m02*v.z + mat.m03;
+			r.y = mat.m10*v.x + mat.m11*v.y + mat.m12*v.z + mat.m13;
+			r.z = mat.m20*v.x + mat.m21*v.y + mat.m22*v.z + mat.m23;
+			positions_out[vertex_ix] = r;
+		}
+
+		if (normals_out) {
+			// Transform by the cofactor matrix like `ufbx_matrix_for_normals()`, the sign of
+			// the determinant is applied after normalizing as negation does not round.
+			ufbx_vec3 n = normals_in[vertex_ix];
+			ufbx_real c00 = mat.m11*mat.m22 - mat.m12*mat.m21;
+			ufbx_real c01 = mat.m12*mat.m20 - mat.m10*mat.m22;
+			ufbx_real c02 = mat.m10*mat.m21 - mat.m11*mat.m20;
+			ufbx_real c10 = mat.m02*mat.m21 - mat.m01*mat.m22;
+			ufbx_real c11 = mat.m00*mat.m22 - mat.m02*mat.m20;
+			ufbx_real c12 = mat.m01*mat.m20 - mat.m00*mat.m21;
+			ufbx_real c20 = mat.m01*mat.m12 - mat.m02*mat.m11;
+			ufbx_real c21 = mat.m02*mat.m10 - mat.m00*mat.m12;
+			ufbx_real c22 = mat.m00*mat.m11 - mat.m01*mat.m10;
+			ufbx_real det = mat.m00*c00 + mat.m01*c01 + mat.m02*c02;
+
+			ufbx_vec3 r; // ufbxi_uninit
+			r.x = c00*n.x + c01*n.y + c02*n.z;
+			r.y = c10*n.x + c11*n.y + c12*n.z;
+			r.z = c20*n.x + c21*n.y + c22*n.z;
+			r = ufbxi_normalize3(r);
+			normals_out[vertex_ix] = det >= 0.0f ? r : ufbxi_neg3(r);
+		}
+	}
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_skin_vertices_check(const ufbx_skin_deformer *skin,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_skin_vertices_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_err_msg(error, opts->vertex_offset <= skin->vertices.count && count <= skin->vertices.count - opts->vertex_offset, "Bad index");
+	ufbxi_check_err(error, !positions_out || positions_in);
+	ufbxi_check_err(error, !normals_out || normals_in);
+	return 1;
+}
+
+static ufbxi_noinline bool ufbxi_skin_vertices(const ufbx_skin_deformer *skin,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_skin_vertices_opts *opts, ufbx_error *error)
+{
+	ufbx_skin_vertices_opts local_opts; // ufbxi_uninit
+	if (!opts) {
+		memset(&local_opts, 0, sizeof(local_opts));
+		opts = &local_opts;
+	}
+
+	ufbxi_allocator ator = { 0 };
+	ufbxi_init_ator(error, &ator, &opts->temp_allocator, "temp");
+
+	ufbxi_buf buf = { 0 };
+	buf.ator = &ator;
+
+	ufbxi_skin_clusters sc; // ufbxi_uninit
+	bool ok = ufbxi_skin_vertices_check(skin, positions_in, positions_out, normals_in, normals_out, count, opts, error)
+		&& ufbxi_alloc_skin_clusters(&sc, error, &buf, skin->clusters.count);
+	if (ok) {
+		ufbxi_pack_skin_clusters(&sc, skin);
+		ufbxi_skin_vertices_imp(&sc, skin, opts->vertex_offset, positions_in, positions_out, normals_in, normals_out,
+			count, opts->use_fallback_matrix ? &opts->fallback_matrix : NULL);
+		ufbxi_clear_error(error);
+	} else {
+		ufbxi_fix_error_type(error, "Failed to skin vertices", NULL);
+	}
+
+	ufbxi_buf_free(&buf);
+	ufbxi_free_ator(&ator);
+
+	return ok;
+}
+
+#else
+
+static ufbxi_noinline bool ufbxi_skin_vertices(const ufbx_skin_deformer *skin,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_skin_vertices_opts *opts, ufbx_error *error)
+{
+	ufbxi_ignore(skin); ufbxi_ignore(positions_in); ufbxi_ignore(positions_out);
+	ufbxi_ignore(normals_in); ufbxi_ignore(normals_out); ufbxi_ignore(count); ufbxi_ignore(opts);
+	ufbxi_fmt_err_info(error, "UFBX_ENABLE_SKINNING_EVALUATION");
+	ufbxi_report_err_msg(error, "UFBXI_FEATURE_SKINNING_EVALUATION", "Feature disabled");
+	ufbxi_fix_error_type(error, "Failed to skin vertices", NULL);
+	return false;
+}
+
+#endif
+
 // -- Curve evaluation
 
 static ufbxi_forceinline double ufbxi_find_cubic_bezier_t(double p1, double p2, double x0)
@@ -25052,21 +28429,164 @@ static ufbxi_forceinline double ufbxi_find_cubic_bezier_t(double p1, double p2,
 	return t;
 }
 
+typedef struct ufbxi_skinning_mesh ufbxi_skinning_mesh;
+
+#if UFBXI_FEATURE_SKINNING_EVALUATION
+
+// Per-mesh state for `ufbxi_evaluate_skinning()`, buffers are allocated up front
+// so that the tasks below only read the scene and write to their own outputs.
+// Retained by evaluated scenes for `ufbx_evaluate_scene_update()`.
+struct ufbxi_skinning_mesh {
+	ufbx_mesh *mesh;
+	ufbx_vec3 *positions;
+	bool src_is_local;
+
+	ufbx_cache_channel *position_cache;
+	ufbx_cache_channel *normal_cache;
+
+	bool deform_positions;
+	ufbx_skin_deformer *skin;
+	const ufbx_matrix *skin_fallback;
+	ufbxi_skin_clusters skin_clusters;
+
+	ufbx_topo_edge *topo;
+	uint32_t *normal_indices;
+	size_t num_normals;
+	ufbx_vec3 *normals;
+
+	// Skinned attributes of the mesh, restored when updating after `ufbxi_reset_skinning()`
+	ufbx_vertex_vec3 skinned_position;
+	ufbx_vertex_vec3 skinned_normal;
+	bool generated_normals;
+};
+
+static bool ufbxi_skinning_mapping_task_fn(ufbxi_task *task)
+{
+	ufbxi_skinning_mesh *sm = (ufbxi_skinning_mesh*)task->data;
+	ufbx_mesh *mesh = sm->mesh;
+
+	if (sm->deform_positions) {
+		size_t num_vertices = mesh->num_vertices;
+		memcpy(sm->positions, mesh->vertices.data, num_vertices * sizeof(ufbx_vec3));
+
+		ufbxi_for_ptr_list(ufbx_blend_deformer, p_blend, mesh->blend_deformers) {
+			ufbx_add_blend_vertex_offsets(*p_blend, sm->positions, num_vertices, 1.0f);
+		}
+
+		// TODO: What should we do about multiple skins??
+		if (sm->skin) {
+			size_t num_skinned = ufbxi_min_sz(num_vertices, sm->skin->vertices.count);
+			ufbxi_pack_skin_clusters(&sm->skin_clusters, sm->skin);
+			ufbxi_skin_vertices_imp(&sm->skin_clusters, sm->skin, 0, sm->positions, sm->positions, NULL, NULL, num_skinned, sm->skin_fallback);
+		}
+	}
+
+	// Topology is only needed for the normal mapping, which is retained on update
+	if (sm->topo) {
+		size_t num_indices = mesh->num_indices;
+		ufbx_compute_topology(mesh, sm->topo, num_indices);
+		sm->num_normals = ufbx_generate_normal_mapping(mesh, sm->topo, num_indices, sm->normal_indices, num_indices, false);
+	}
+
+	return true;
+}
+
+static bool ufbxi_skinning_normal_task_fn(ufbxi_task *task)
+{
+	ufbxi_skinning_mesh *sm = (ufbxi_skinning_mesh*)task->data;
+	ufbx_mesh *mesh = sm->mesh;
+	ufbx_compute_normals(mesh, &mesh->skinned_position, sm->normal_indices, mesh->num_indices, sm->normals, sm->num_normals);
+	return true;
+}
+
+static ufbxi_noinline bool ufbxi_skinning_read_position_cache(ufbxi_skinning_mesh *sm, double time, ufbx_geometry_cache_data_opts *cache_opts)
+{
+	size_t num_vertices = sm->mesh->num_vertices;
+	size_t num_read = ufbx_sample_geometry_cache_vec3(sm->position_cache, time, sm->positions, num_vertices, cache_opts);
+	return num_read == num_vertices;
+}
+
+// Scratch buffers for `ufbxi_skinning_mapping_task_fn()`, sized for the largest mesh.
+typedef struct {
+	ufbx_topo_edge *topo;
+	ufbxi_skin_clusters skin_clusters;
+} ufbxi_skinning_scratch;
+
+// Allocate scratch buffers for as many concurrent mapping tasks as fit in the thread memory limit.
+// Mesh `i` uses `scratch[i % num_scratch]`, see `ufbxi_skinning_scratch_for()`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_alloc_skinning_scratch(ufbx_error *error, ufbxi_buf *buf, ufbxi_thread_pool *thread_pool,
+	size_t num_meshes, size_t max_indices, size_t max_clusters, ufbxi_skinning_scratch **p_scratch, size_t *p_num_scratch)
+{
+	size_t num_scratch = 1;
+	if (thread_pool->enabled) {
+		size_t memory_limit = thread_pool->opts.memory_limit ? thread_pool->opts.memory_limit : 32*1024*1024;
+		size_t scratch_size = max_indices * sizeof(ufbx_topo_edge) + max_clusters * (sizeof(ufbx_matrix) + 12 * sizeof(ufbx_real) + sizeof(bool));
+		num_scratch = scratch_size > 0 ? memory_limit / scratch_size : num_meshes;
+		num_scratch = ufbxi_min_sz(num_scratch, ufbxi_min_sz(num_meshes, UFBXI_MAX_SKINNING_SCRATCH));
+		num_scratch = ufbxi_max_sz(num_scratch, 1);
+	}
+
+	ufbxi_skinning_scratch *scratch = ufbxi_push_zero(buf, ufbxi_skinning_scratch, num_scratch);
+	ufbxi_check_err(error, scratch);
+	for (size_t i = 0; i < num_scratch; i++) {
+		if (max_indices > 0) {
+			scratch[i].topo = ufbxi_push(buf, ufbx_topo_edge, max_indices);
+			ufbxi_check_err(error, scratch[i].topo);
+		}
+		ufbxi_check_err(error, ufbxi_alloc_skin_clusters(&scratch[i].skin_clusters, error, buf, max_clusters));
+	}
+
+	*p_scratch = scratch;
+	*p_num_scratch = num_scratch;
+	return 1;
+}
+
+// Returns the scratch buffers for the `index`th mapping task, waiting for the
+// previous tasks to finish when every scratch has been handed out.
+ufbxi_nodiscard static ufbxi_noinline ufbxi_skinning_scratch *ufbxi_skinning_scratch_for(ufbx_error *error, ufbxi_thread_pool *thread_pool,
+	ufbxi_skinning_scratch *scratch, size_t num_scratch, size_t index)
+{
+	size_t slot = index % num_scratch;
+	if (index > 0 && slot == 0) {
+		if (!ufbxi_thread_pool_dispatch_wait(thread_pool, error)) return NULL;
+	}
+	return &scratch[slot];
+}
+
+#endif
+
 ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_skinning(ufbx_scene *scene, ufbx_error *error, ufbxi_buf *buf_result, ufbxi_buf *buf_tmp,
-	double time, bool load_caches, ufbx_geometry_cache_data_opts *cache_opts)
+	ufbxi_thread_pool *thread_pool, double time, bool load_caches, ufbx_geometry_cache_data_opts *cache_opts,
+	ufbxi_skinning_mesh **p_skinning_meshes, size_t *p_num_skinning_meshes)
 {
 #if UFBXI_FEATURE_SKINNING_EVALUATION
-	size_t max_skinned_indices = 0;
+	size_t max_topo_indices = 0;
+	size_t max_skin_clusters = 0;
+	size_t num_skinned_meshes = 0;
 
 	ufbxi_for_ptr_list(ufbx_mesh, p_mesh, scene->meshes) {
 		ufbx_mesh *mesh = *p_mesh;
 		if (mesh->blend_deformers.count == 0 && mesh->skin_deformers.count == 0 && (mesh->cache_deformers.count == 0 || !load_caches)) continue;
-		max_skinned_indices = ufbxi_max_sz(max_skinned_indices, mesh->num_indices);
+		if (mesh->num_vertices == 0) continue;
+		if (!mesh->topology) {
+			max_topo_indices = ufbxi_max_sz(max_topo_indices, mesh->num_indices);
+		}
+		if (mesh->skin_deformers.count > 0) {
+			max_skin_clusters = ufbxi_max_sz(max_skin_clusters, mesh->skin_deformers.data[0]->clusters.count);
+		}
+		num_skinned_meshes++;
 	}
 
-	ufbx_topo_edge *topo = ufbxi_push(buf_tmp, ufbx_topo_edge, max_skinned_indices);
-	ufbxi_check_err(error, topo);
+	// Retain the per-mesh state in the result if requested
+	ufbxi_buf *buf_meshes = p_skinning_meshes ? buf_result : buf_tmp;
+	ufbxi_skinning_mesh *skinning_meshes = ufbxi_push_zero(buf_meshes, ufbxi_skinning_mesh, num_skinned_meshes);
+	ufbxi_check_err(error, skinning_meshes);
+
+	ufbxi_skinning_scratch *scratch = NULL;
+	size_t num_scratch = 0;
+	ufbxi_check_err(error, ufbxi_alloc_skinning_scratch(error, buf_tmp, thread_pool, num_skinned_meshes, max_topo_indices, max_skin_clusters, &scratch, &num_scratch));
 
+	size_t skinned_mesh_ix = 0;
 	ufbxi_for_ptr_list(ufbx_mesh, p_mesh, scene->meshes) {
 		ufbx_mesh *mesh = *p_mesh;
 		if (mesh->blend_deformers.count == 0 && mesh->skin_deformers.count == 0 && (mesh->cache_deformers.count == 0 || !load_caches)) continue;
@@ -25079,6 +28599,14 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_skinning(ufbx_scene *sc
 		result_pos[0] = ufbx_zero_vec3;
 		result_pos++;
 
+		ufbxi_skinning_scratch *sm_scratch = ufbxi_skinning_scratch_for(error, thread_pool, scratch, num_scratch, skinned_mesh_ix);
+		ufbxi_check_err(error, sm_scratch);
+
+		ufbxi_skinning_mesh *sm = &skinning_meshes[skinned_mesh_ix++];
+		sm->mesh = mesh;
+		sm->positions = result_pos;
+		sm->src_is_local = mesh->skinned_is_local;
+
 		bool cached_position = false, cached_normals = false;
 		if (load_caches && mesh->cache_deformers.count > 0) {
 			ufbxi_for_ptr_list(ufbx_cache_deformer, p_cache, mesh->cache_deformers) {
@@ -25086,8 +28614,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_skinning(ufbx_scene *sc
 				if (!channel) continue;
 
 				if ((channel->interpretation == UFBX_CACHE_INTERPRETATION_VERTEX_POSITION || channel->interpretation == UFBX_CACHE_INTERPRETATION_POINTS) && !cached_position) {
-					size_t num_read = ufbx_sample_geometry_cache_vec3(channel, time, result_pos, num_vertices, cache_opts);
-					if (num_read == num_vertices) {
+					sm->position_cache = channel;
+					if (ufbxi_skinning_read_position_cache(sm, time, cache_opts)) {
 						mesh->skinned_is_local = true;
 						cached_position = true;
 					}
@@ -25102,72 +28630,191 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_skinning(ufbx_scene *sc
 					size_t num_read = ufbx_sample_geometry_cache_vec3(channel, time, normal_data, num_normals, cache_opts);
 					if (num_read == num_normals) {
 						cached_normals = true;
+						sm->normal_cache = channel;
 						mesh->skinned_normal.values.data = normal_data;
 					}
 				}
 			}
 		}
 
-		if (!cached_position) {
-			memcpy(result_pos, mesh->vertices.data, num_vertices * sizeof(ufbx_vec3));
-
-			ufbxi_for_ptr_list(ufbx_blend_deformer, p_blend, mesh->blend_deformers) {
-				ufbx_add_blend_vertex_offsets(*p_blend, result_pos, num_vertices, 1.0f);
-			}
-
-			// TODO: What should we do about multiple skins??
-			if (mesh->skin_deformers.count > 0) {
-				ufbx_matrix *fallback = mesh->instances.count > 0 ? &mesh->instances.data[0]->geometry_to_world : NULL;
-				ufbx_skin_deformer *skin = mesh->skin_deformers.data[0];
-				for (size_t i = 0; i < num_vertices; i++) {
-					ufbx_matrix mat = ufbx_get_skin_vertex_matrix(skin, i, fallback);
-					result_pos[i] = ufbx_transform_position(&mat, result_pos[i]);
-				}
+		if (mesh->skin_deformers.count > 0) {
+			ufbx_skin_deformer *skin = mesh->skin_deformers.data[0];
+			sm->skin = skin;
+			sm->skin_fallback = mesh->instances.count > 0 ? &mesh->instances.data[0]->geometry_to_world : NULL;
+			sm->skin_clusters = sm_scratch->skin_clusters;
+		}
 
+		if (!cached_position) {
+			sm->deform_positions = true;
+			if (sm->skin) {
 				mesh->skinned_is_local = false;
 			}
 		}
 
 		mesh->skinned_position.values.data = result_pos;
 
-		if (!cached_normals) {
+		if (!cached_normals && mesh->topology) {
+			// Use the normal mapping retained during loading
+			sm->normal_indices = mesh->topology->normal_indices.data;
+			sm->num_normals = mesh->topology->num_normals;
+		} else if (!cached_normals) {
 			size_t num_indices = mesh->num_indices;
-			uint32_t *normal_indices = ufbxi_push(buf_result, uint32_t, num_indices);
-			ufbxi_check_err(error, normal_indices);
+			sm->normal_indices = ufbxi_push(buf_result, uint32_t, num_indices);
+			ufbxi_check_err(error, sm->normal_indices);
+			sm->topo = sm_scratch->topo;
+		}
 
-			ufbx_compute_topology(mesh, topo, num_indices);
-			size_t num_normals = ufbx_generate_normal_mapping(mesh, topo, num_indices, normal_indices, num_indices, false);
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(thread_pool, error, &ufbxi_skinning_mapping_task_fn, sm));
+	}
 
-			if (num_normals == mesh->num_vertices) {
-				mesh->skinned_normal.unique_per_vertex = true;
-			}
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(thread_pool, error));
+
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinned_meshes) {
+		// Scratch buffers are not valid after this function
+		sm->topo = NULL;
+		sm->skin_clusters.num_clusters = 0;
+
+		if (!sm->normal_indices) continue;
+		ufbx_mesh *mesh = sm->mesh;
+
+		size_t num_normals = sm->num_normals;
+		if (num_normals == mesh->num_vertices) {
+			mesh->skinned_normal.unique_per_vertex = true;
+		}
+
+		ufbx_vec3 *normal_data = ufbxi_push(buf_result, ufbx_vec3, num_normals + 1);
+		ufbxi_check_err(error, normal_data);
+
+		normal_data[0] = ufbx_zero_vec3;
+		normal_data++;
+		sm->normals = normal_data;
+
+		mesh->generated_normals = true;
+		mesh->skinned_normal.exists = true;
+		mesh->skinned_normal.values.data = normal_data;
+		mesh->skinned_normal.values.count = num_normals;
+		mesh->skinned_normal.indices.data = sm->normal_indices;
+		mesh->skinned_normal.indices.count = mesh->num_indices;
+		mesh->skinned_normal.value_reals = 3;
 
-			ufbx_vec3 *normal_data = ufbxi_push(buf_result, ufbx_vec3, num_normals + 1);
-			ufbxi_check_err(error, normal_data);
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(thread_pool, error, &ufbxi_skinning_normal_task_fn, sm));
+	}
+
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(thread_pool, error));
 
-			normal_data[0] = ufbx_zero_vec3;
-			normal_data++;
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinned_meshes) {
+		sm->skinned_position = sm->mesh->skinned_position;
+		sm->skinned_normal = sm->mesh->skinned_normal;
+		sm->generated_normals = sm->mesh->generated_normals;
+	}
 
-			ufbx_compute_normals(mesh, &mesh->skinned_position, normal_indices, num_indices, normal_data, num_normals);
+	if (p_skinning_meshes) {
+		*p_skinning_meshes = skinning_meshes;
+		*p_num_skinning_meshes = num_skinned_meshes;
+	}
+
+	return 1;
+#else
+	ufbxi_ignore(thread_pool);
+	ufbxi_ignore(p_skinning_meshes);
+	ufbxi_ignore(p_num_skinning_meshes);
+	ufbxi_fmt_err_info(error, "UFBX_ENABLE_SKINNING_EVALUATION");
+	ufbxi_report_err_msg(error, "UFBXI_FEATURE_SKINNING_EVALUATION", "Feature disabled");
+	return 0;
+#endif
+}
 
-			mesh->generated_normals = true;
-			mesh->skinned_normal.exists = true;
-			mesh->skinned_normal.values.data = normal_data;
-			mesh->skinned_normal.values.count = num_normals;
-			mesh->skinned_normal.indices.data = normal_indices;
-			mesh->skinned_normal.indices.count = num_indices;
-			mesh->skinned_normal.value_reals = 3;
+// Re-evaluate meshes from a previous `ufbxi_evaluate_skinning()` in place.
+// The normal mapping does not depend on the vertex positions so only the normals are recomputed.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_update_skinning(ufbx_error *error, ufbxi_buf *buf_tmp, ufbxi_thread_pool *thread_pool,
+	double time, bool load_caches, ufbx_geometry_cache_data_opts *cache_opts, ufbxi_skinning_mesh *skinning_meshes, size_t num_skinning_meshes)
+{
+#if UFBXI_FEATURE_SKINNING_EVALUATION
+	size_t max_skin_clusters = 0;
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinning_meshes) {
+		if (sm->skin) {
+			max_skin_clusters = ufbxi_max_sz(max_skin_clusters, sm->skin->clusters.count);
 		}
 	}
 
+	ufbxi_skinning_scratch *scratch = NULL;
+	size_t num_scratch = 0;
+	ufbxi_check_err(error, ufbxi_alloc_skinning_scratch(error, buf_tmp, thread_pool, num_skinning_meshes, 0, max_skin_clusters, &scratch, &num_scratch));
+
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinning_meshes) {
+		ufbxi_skinning_scratch *sm_scratch = ufbxi_skinning_scratch_for(error, thread_pool, scratch, num_scratch, (size_t)(sm - skinning_meshes));
+		ufbxi_check_err(error, sm_scratch);
+
+		ufbx_mesh *mesh = sm->mesh;
+		mesh->skinned_position = sm->skinned_position;
+		mesh->skinned_normal = sm->skinned_normal;
+		mesh->generated_normals = sm->generated_normals;
+
+		bool cached_position = load_caches && sm->position_cache && ufbxi_skinning_read_position_cache(sm, time, cache_opts);
+		if (cached_position) {
+			mesh->skinned_is_local = true;
+		} else {
+			mesh->skinned_is_local = sm->skin ? false : sm->src_is_local;
+		}
+		sm->deform_positions = !cached_position;
+
+		if (load_caches && sm->normal_cache) {
+			ufbx_sample_geometry_cache_vec3(sm->normal_cache, time, mesh->skinned_normal.values.data, mesh->skinned_normal.values.count, cache_opts);
+		}
+
+		if (sm->skin && sm->deform_positions) {
+			sm->skin_clusters = sm_scratch->skin_clusters;
+		}
+
+		ufbx_assert(sm->topo == NULL);
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(thread_pool, error, &ufbxi_skinning_mapping_task_fn, sm));
+	}
+
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(thread_pool, error));
+
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinning_meshes) {
+		sm->skin_clusters.num_clusters = 0;
+		if (!sm->normals) continue;
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(thread_pool, error, &ufbxi_skinning_normal_task_fn, sm));
+	}
+
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(thread_pool, error));
+
 	return 1;
 #else
+	ufbxi_ignore(buf_tmp);
+	ufbxi_ignore(thread_pool);
+	ufbxi_ignore(time);
+	ufbxi_ignore(load_caches);
+	ufbxi_ignore(cache_opts);
+	ufbxi_ignore(skinning_meshes);
+	ufbxi_ignore(num_skinning_meshes);
 	ufbxi_fmt_err_info(error, "UFBX_ENABLE_SKINNING_EVALUATION");
 	ufbxi_report_err_msg(error, "UFBXI_FEATURE_SKINNING_EVALUATION", "Feature disabled");
 	return 0;
 #endif
 }
 
+// Restore the unskinned attributes of meshes from a previous `ufbxi_evaluate_skinning()`,
+// the retained buffers are reused if skinning is evaluated again.
+static ufbxi_noinline void ufbxi_reset_skinning(const ufbx_scene *src_scene, ufbxi_skinning_mesh *skinning_meshes, size_t num_skinning_meshes)
+{
+#if UFBXI_FEATURE_SKINNING_EVALUATION
+	ufbxi_for(ufbxi_skinning_mesh, sm, skinning_meshes, num_skinning_meshes) {
+		ufbx_mesh *mesh = sm->mesh;
+		const ufbx_mesh *src = (const ufbx_mesh*)src_scene->elements.data[mesh->element_id];
+		mesh->skinned_is_local = src->skinned_is_local;
+		mesh->skinned_position = src->skinned_position;
+		mesh->skinned_normal = src->skinned_normal;
+		mesh->generated_normals = src->generated_normals;
+	}
+#else
+	ufbxi_ignore(src_scene);
+	ufbxi_ignore(skinning_meshes);
+	ufbxi_ignore(num_skinning_meshes);
+#endif
+}
+
 ufbxi_nodiscard static ufbxi_noinline int ufbxi_fixup_opts_string(ufbxi_context *uc, ufbx_string *str, bool push)
 {
 	if (str->length > 0) {
@@ -25205,6 +28852,9 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 {
 	// Check for deferred failure
 	if (uc->deferred_failure) return 0;
+
+	ufbxi_stats_begin(uc);
+
 	if (uc->deferred_load) {
 		ufbx_stream stream = { 0 };
 		ufbx_open_file_opts opts = { 0 };
@@ -25221,7 +28871,13 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 		}
 		ufbx_error error;
 		error.type = UFBX_ERROR_NONE;
-		if (uc->opts.open_main_file_with_default || uc->opts.open_file_cb.fn == &ufbx_default_open_file) {
+		bool open_default = uc->opts.open_main_file_with_default || uc->opts.open_file_cb.fn == &ufbx_default_open_file;
+		if (open_default && uc->opts.use_memory_map) {
+			ufbxi_check(ufbxi_mmap_open(uc, filename, filename_len, opts.filename_null_terminated));
+		}
+		if (uc->mmap_data) {
+			ok = true;
+		} else if (open_default) {
 			ufbx_open_file_context ctx = (ufbx_open_file_context)&uc->ator_tmp;
 			ok = ufbx_open_file_ctx(&stream, ctx, filename, filename_len, &opts, &error);
 		} else {
@@ -25257,6 +28913,9 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 	ufbxi_check(ufbxi_fixup_opts_string(uc, &uc->opts.scale_helper_name, true));
 
 	ufbxi_check(ufbxi_thread_pool_init(&uc->thread_pool, &uc->error, &uc->ator_tmp, &uc->opts.thread_opts));
+#if UFBXI_FEATURE_LOAD_STATS
+	uc->thread_pool.clock = uc->stats_clock;
+#endif
 
 	if (!uc->opts.allow_unsafe) {
 		ufbxi_check_msg(uc->opts.index_error_handling != UFBX_INDEX_ERROR_HANDLING_UNSAFE_IGNORE, "Unsafe options");
@@ -25265,6 +28924,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 		uc->scene.metadata.is_unsafe = true;
 	}
 
+	uc->no_copy_arrays = uc->opts.no_copy_arrays && uc->source_data != NULL;
+
 	if (uc->opts.index_error_handling == UFBX_INDEX_ERROR_HANDLING_NO_INDEX) {
 		uc->scene.metadata.may_contain_no_index = true;
 	}
@@ -25289,6 +28950,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 
 	ufbx_file_format format = uc->scene.metadata.file_format;
 
+	ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_PARSE);
+
 	if (format == UFBX_FILE_FORMAT_FBX) {
 		ufbxi_check(ufbxi_begin_parse(uc));
 		if (uc->version < 6000) {
@@ -25317,6 +28980,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 		uc->scene.dom_root = dom_root;
 	}
 
+	ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_FINALIZE);
+
 	ufbxi_check(ufbxi_pre_finalize_scene(uc));
 
 	// We can free `tmp_parse` already here as all parsing is done by now.
@@ -25324,6 +28989,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 
 	ufbxi_check(ufbxi_finalize_scene(uc));
 
+	ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_POSTPROCESS);
+
 	ufbxi_update_scene_settings(&uc->scene.settings);
 	if (uc->scene.metadata.file_format == UFBX_FILE_FORMAT_OBJ) {
 		ufbxi_update_scene_settings_obj(uc);
@@ -25345,6 +29012,10 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 	ufbxi_check(ufbxi_modify_geometry(uc));
 	ufbxi_postprocess_scene(uc);
 
+	if (uc->opts.retain_topology) {
+		ufbxi_check(ufbxi_retain_topology(uc));
+	}
+
 	ufbxi_update_scene(&uc->scene, true, NULL, 0);
 
 	// Force a non-NULL anim pointer
@@ -25353,15 +29024,17 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 	}
 
 	if (uc->opts.load_external_files) {
+		ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_EXTERNAL_FILES);
 		ufbxi_check(ufbxi_load_external_files(uc));
 	}
 
 	// Evaluate skinning if requested
 	if (uc->opts.evaluate_skinning) {
+		ufbxi_stats_phase(uc, UFBX_LOAD_PHASE_SKINNING);
 		ufbx_geometry_cache_data_opts cache_opts = { 0 };
 		cache_opts.open_file_cb = uc->opts.open_file_cb;
-		ufbxi_check(ufbxi_evaluate_skinning(&uc->scene, &uc->error, &uc->result, &uc->tmp,
-			0.0, uc->opts.load_external_files && uc->opts.evaluate_caches, &cache_opts));
+		ufbxi_check(ufbxi_evaluate_skinning(&uc->scene, &uc->error, &uc->result, &uc->tmp, &uc->thread_pool,
+			0.0, uc->opts.load_external_files && uc->opts.evaluate_caches, &cache_opts, NULL, NULL));
 	}
 
 	// Pop warnings to metadata
@@ -25376,9 +29049,11 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 	uc->scene.metadata.animation_ignored = uc->opts.ignore_animation;
 	uc->scene.metadata.embedded_ignored = uc->opts.ignore_embedded;
 
+	ufbxi_stats_finish(uc);
+
 	// Retain the scene, this must be the final allocation as we copy
 	// `ator_result` to `ufbx_scene_imp`.
-	ufbxi_scene_imp *imp = ufbxi_push(&uc->result, ufbxi_scene_imp, 1);
+	ufbxi_scene_imp *imp = ufbxi_push_zero(&uc->result, ufbxi_scene_imp, 1);
 	ufbxi_check(imp);
 
 	ufbxi_init_ref(&imp->refcount, UFBXI_SCENE_IMP_MAGIC, NULL);
@@ -25394,6 +29069,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_load_imp(ufbxi_context *uc)
 	imp->refcount.buf.ator = &imp->refcount.ator;
 	imp->string_buf = uc->string_pool.buf;
 	imp->string_buf.ator = &imp->refcount.ator;
+	imp->file_maps = uc->file_maps;
 
 	imp->scene.metadata.result_memory_used = imp->refcount.ator.current_size;
 	imp->scene.metadata.temp_memory_used = uc->ator_tmp.current_size;
@@ -25430,6 +29106,9 @@ static ufbxi_noinline void ufbxi_free_temp(ufbxi_context *uc)
 	for (size_t i = 0; i < UFBX_THREAD_GROUP_COUNT; i++) {
 		ufbxi_buf_free(&uc->tmp_thread_parse[i]);
 	}
+	for (size_t i = 0; i < UFBXI_ASCII_WINDOW_COUNT; i++) {
+		ufbxi_buf_free(&uc->ascii.windows[i].buf);
+	}
 	ufbxi_buf_free(&uc->tmp_stack);
 	ufbxi_buf_free(&uc->tmp_connections);
 	ufbxi_buf_free(&uc->tmp_node_ids);
@@ -25603,6 +29282,7 @@ static ufbxi_noinline ufbx_scene *ufbxi_load(ufbxi_context *uc, const ufbx_load_
 	if (uc->close_fn) {
 		uc->close_fn(uc->read_user);
 	}
+	ufbxi_mmap_close(uc);
 
 	ufbxi_free_temp(uc);
 
@@ -25619,6 +29299,7 @@ static ufbxi_noinline ufbx_scene *ufbxi_load(ufbxi_context *uc, const ufbx_load_
 			p_error->type = UFBX_ERROR_UNSUPPORTED_VERSION;
 			ufbxi_fmt_err_info(p_error, "%u", uc->version);
 		}
+		ufbxi_unmap_files(uc->file_maps);
 		ufbxi_free_result(uc);
 		return NULL;
 	}
@@ -25756,7 +29437,20 @@ static ufbxi_forceinline bool ufbxi_anim_layer_might_contain_id(const ufbx_anim_
 	return ok;
 }
 
-static ufbxi_noinline void ufbxi_evaluate_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *props, size_t num_props, uint32_t flags)
+// Number of keyframes to scan linearly from a cursor before falling back to binary search.
+#define UFBXI_CURVE_CURSOR_SCAN 4
+
+static ufbxi_noinline ufbx_real ufbxi_evaluate_curve(const ufbx_anim_curve *curve, double time, ufbx_real default_value, uint32_t flags, uint32_t *p_key);
+static ufbxi_noinline ufbx_vec3 ufbxi_evaluate_anim_value_vec3(const ufbx_anim_value *anim_value, double time, uint32_t flags, ufbx_uint32_list *curve_keys);
+
+static ufbxi_forceinline uint32_t *ufbxi_curve_key_hint(ufbx_uint32_list *curve_keys, const ufbx_anim_curve *curve)
+{
+	if (!curve_keys || !curve || curve->typed_id >= curve_keys->count) return NULL;
+	return &curve_keys->data[curve->typed_id];
+}
+
+// `curve_keys` is an optional cursor of keyframe indices per `ufbx_anim_curve.typed_id`.
+static ufbxi_noinline void ufbxi_evaluate_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *props, size_t num_props, uint32_t flags, ufbx_uint32_list *curve_keys)
 {
 	ufbxi_anim_layer_combine_ctx combine_ctx = { anim, element, time };
 
@@ -25772,7 +29466,9 @@ static ufbxi_noinline void ufbxi_evaluate_props(const ufbx_anim *anim, const ufb
 		if (layer->weight_is_animated && layer->blended) {
 			ufbx_anim_prop *weight_aprop = ufbxi_find_anim_prop_start(layer, &layer->element);
 			if (weight_aprop) {
-				weight = ufbx_evaluate_anim_value_real_flags(weight_aprop->anim_value, time, flags) / (ufbx_real)100.0;
+				const ufbx_anim_value *weight_value = weight_aprop->anim_value;
+				const ufbx_anim_curve *weight_curve = weight_value->curves[0];
+				weight = ufbxi_evaluate_curve(weight_curve, time, weight_value->default_value.x, flags, ufbxi_curve_key_hint(curve_keys, weight_curve)) / (ufbx_real)100.0;
 				if (weight < 0.0f) weight = 0.0f;
 				if (weight > 0.99999f) weight = 1.0f;
 			}
@@ -25801,7 +29497,7 @@ static ufbxi_noinline void ufbxi_evaluate_props(const ufbx_anim *anim, const ufb
 			// This could be done by having `UFBX_PROP_FLAG_ANIMATION_EVALUATED`
 			// that gets set for the first layer of animation that is applied.
 			if (aprop->prop_name.data == prop->name.data) {
-				ufbx_vec3 v = ufbx_evaluate_anim_value_vec3_flags(aprop->anim_value, time, flags);
+				ufbx_vec3 v = ufbxi_evaluate_anim_value_vec3(aprop->anim_value, time, flags, curve_keys);
 				if (layer_ix == 0) {
 					prop->value_vec3 = v;
 				} else {
@@ -25923,7 +29619,7 @@ static ufbxi_forceinline const ufbx_prop *ufbxi_next_prop(ufbxi_prop_iter *iter)
 	}
 }
 
-static ufbxi_noinline ufbx_props ufbxi_evaluate_selected_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *props, const char *const *prop_names, size_t max_props, uint32_t flags)
+static ufbxi_noinline ufbx_props ufbxi_evaluate_selected_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *props, const char *const *prop_names, size_t max_props, uint32_t flags, ufbx_uint32_list *curve_keys)
 {
 	const char *name = prop_names[0];
 	uint32_t key = ufbxi_get_name_key_c(name);
@@ -25964,7 +29660,7 @@ static ufbxi_noinline ufbx_props ufbxi_evaluate_selected_props(const ufbx_anim *
 		}
 	}
 
-	ufbxi_evaluate_props(anim, element, time, props, num_props, flags);
+	ufbxi_evaluate_props(anim, element, time, props, num_props, flags, curve_keys);
 
 	ufbx_props prop_list;
 	prop_list.props.data = props;
@@ -25973,6 +29669,202 @@ static ufbxi_noinline ufbx_props ufbxi_evaluate_selected_props(const ufbx_anim *
 	return prop_list;
 }
 
+static ufbxi_noinline ufbx_prop ufbxi_evaluate_prop(const ufbx_anim *anim, const ufbx_element *element, const char *name, size_t name_len, double time, uint32_t flags, ufbx_uint32_list *curve_keys)
+{
+	ufbx_prop result;
+
+	ufbx_prop *prop = ufbx_find_prop_len(&element->props, name, name_len);
+	if (prop) {
+		result = *prop;
+	} else {
+		memset(&result, 0, sizeof(result));
+		result.name.data = name;
+		result.name.length = name_len;
+		result._internal_key = ufbxi_get_name_key(name, name_len);
+		result.flags = UFBX_PROP_FLAG_NOT_FOUND;
+		result.value_str.data = ufbxi_empty_char;
+		result.value_str.length = 0;
+		result.value_blob.data = NULL;
+		result.value_blob.size = 0;
+	}
+
+	if (anim->prop_overrides.count > 0) {
+		ufbxi_find_prop_override(&anim->prop_overrides, element->element_id, &result);
+		return result;
+	}
+
+	if ((result.flags & (UFBX_PROP_FLAG_ANIMATED|UFBX_PROP_FLAG_CONNECTED)) == 0) return result;
+
+	if ((prop->flags & UFBX_PROP_FLAG_CONNECTED) != 0 && !anim->ignore_connections) {
+		ufbxi_evaluate_connected_prop(&result, anim, element, prop->name.data, time, flags);
+	}
+
+	ufbxi_evaluate_props(anim, element, time, &result, 1, flags, curve_keys);
+
+	return result;
+}
+
+static ufbxi_noinline ufbx_props ufbxi_evaluate_element_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *buffer, size_t buffer_size, uint32_t flags, ufbx_uint32_list *curve_keys)
+{
+	ufbx_props ret = { NULL };
+	if (!element) return ret;
+
+	size_t num_anim = 0;
+	ufbxi_prop_iter iter; // ufbxi_uninit
+	ufbxi_init_prop_iter(&iter, anim, element);
+	const ufbx_prop *prop = NULL;
+	while ((prop = ufbxi_next_prop(&iter)) != NULL) {
+		if (!(prop->flags & (UFBX_PROP_FLAG_ANIMATED|UFBX_PROP_FLAG_OVERRIDDEN|UFBX_PROP_FLAG_CONNECTED))) continue;
+		if (num_anim >= buffer_size) break;
+
+		ufbx_prop *dst = &buffer[num_anim++];
+		*dst = *prop;
+
+		if ((prop->flags & UFBX_PROP_FLAG_CONNECTED) != 0 && !anim->ignore_connections) {
+			ufbxi_evaluate_connected_prop(dst, anim, element, prop->name.data, time, flags);
+		}
+	}
+
+	ufbxi_evaluate_props(anim, element, time, buffer, num_anim, flags, curve_keys);
+
+	ret.props.data = buffer;
+	ret.props.count = ret.num_animated = num_anim;
+	ret.defaults = (ufbx_props*)&element->props;
+	return ret;
+}
+
+static const char *const ufbxi_transform_props_all[] = {
+	ufbxi_Lcl_Rotation,
+	ufbxi_Lcl_Scaling,
+	ufbxi_Lcl_Translation,
+	ufbxi_PostRotation,
+	ufbxi_PreRotation,
+	ufbxi_RotationOffset,
+	ufbxi_RotationOrder,
+	ufbxi_RotationPivot,
+	ufbxi_ScalingOffset,
+	ufbxi_ScalingPivot,
+};
+
+static const char *const ufbxi_transform_props_rotation[] = {
+	ufbxi_Lcl_Rotation,
+	ufbxi_PostRotation,
+	ufbxi_PreRotation,
+	ufbxi_RotationOrder,
+};
+
+static const char *const ufbxi_transform_props_scale[] = {
+	ufbxi_Lcl_Scaling,
+};
+
+static const char *const ufbxi_transform_props_rotation_scale[] = {
+	ufbxi_Lcl_Rotation,
+	ufbxi_Lcl_Scaling,
+	ufbxi_PostRotation,
+	ufbxi_PreRotation,
+	ufbxi_RotationOrder,
+};
+
+static ufbxi_noinline ufbx_transform ufbxi_evaluate_transform(const ufbx_anim *anim, const ufbx_node *node, double time, uint32_t flags, ufbx_uint32_list *curve_keys)
+{
+	ufbx_assert(anim);
+	ufbx_assert(node);
+	if (!node) return ufbx_identity_transform;
+	if (!anim) return node->local_transform;
+	if (node->is_root) return node->local_transform;
+
+	if ((flags & UFBX_TRANSFORM_FLAG_EXPLICIT_INCLUDES) == 0) {
+		flags |= UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION;
+	}
+
+	const char *const *prop_names = ufbxi_transform_props_all;
+	size_t num_prop_names = ufbxi_arraycount(ufbxi_transform_props_all);
+	uint32_t components = flags & (UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION);
+	if (components == (UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE)) {
+		prop_names = ufbxi_transform_props_rotation_scale;
+		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_rotation_scale);
+	} else if (components == UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION) {
+		prop_names = ufbxi_transform_props_rotation;
+		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_rotation);
+	} else if (components == UFBX_TRANSFORM_FLAG_INCLUDE_SCALE) {
+		prop_names = ufbxi_transform_props_scale;
+		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_scale);
+	} else if (components == 0) {
+		return ufbx_identity_transform;
+	}
+
+	const ufbx_vec3 *translation_scale = NULL;
+	ufbx_prop helper_scale; // ufbxi_uninit
+	ufbx_vec3 scale_factor = ufbxi_one_vec3;
+	bool use_scale_factor = false;
+
+	if (node->parent && (flags & (UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION)) != 0) {
+		ufbx_node *parent = node->parent;
+
+		if ((flags & UFBX_TRANSFORM_FLAG_IGNORE_COMPONENTWISE_SCALE) == 0 && parent->inherit_scale_node) {
+			ufbx_node *p = parent->inherit_scale_node;
+
+			if (node->is_scale_helper) {
+				use_scale_factor = true;
+			}
+
+			while (p && p->scale_helper) {
+				ufbx_prop scale = ufbxi_evaluate_prop(anim, &p->scale_helper->element, ufbxi_Lcl_Scaling, sizeof(ufbxi_Lcl_Scaling) - 1, time, 0, curve_keys);
+				scale_factor.x *= scale.value_vec3.x;
+				scale_factor.y *= scale.value_vec3.y;
+				scale_factor.z *= scale.value_vec3.z;
+				p = p->inherit_scale_node;
+			}
+		}
+
+		if (parent->scale_helper && (flags & UFBX_TRANSFORM_FLAG_IGNORE_SCALE_HELPER) == 0) {
+			helper_scale = ufbxi_evaluate_prop(anim, &parent->scale_helper->element, ufbxi_Lcl_Scaling, sizeof(ufbxi_Lcl_Scaling) - 1, time, 0, curve_keys);
+			if (helper_scale.flags & UFBX_PROP_FLAG_NOT_FOUND) {
+				helper_scale.value_vec3.x = 1.0f;
+				helper_scale.value_vec3.y = 1.0f;
+				helper_scale.value_vec3.z = 1.0f;
+			}
+			helper_scale.value_vec3.x *= scale_factor.x;
+			helper_scale.value_vec3.y *= scale_factor.y;
+			helper_scale.value_vec3.z *= scale_factor.z;
+			translation_scale = &helper_scale.value_vec3;
+		}
+	}
+
+	uint32_t eval_flags = 0;
+	if (flags & UFBX_TRANSFORM_FLAG_NO_EXTRAPOLATION) {
+		eval_flags |= UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION;
+	}
+
+	ufbx_prop buf[ufbxi_arraycount(ufbxi_transform_props_all)]; // ufbxi_uninit
+	ufbx_props props = ufbxi_evaluate_selected_props(anim, &node->element, time, buf, prop_names, num_prop_names, eval_flags, curve_keys);
+	ufbx_rotation_order order = (ufbx_rotation_order)ufbxi_find_enum(&props, ufbxi_RotationOrder, UFBX_ROTATION_ORDER_XYZ, UFBX_ROTATION_ORDER_SPHERIC);
+
+	ufbx_transform transform; // ufbxi_uninit
+	if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION) != 0) {
+		transform = ufbxi_get_transform(&props, order, node, translation_scale);
+	} else {
+		transform.translation = ufbx_zero_vec3;
+		if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION) != 0) {
+			transform.rotation = ufbxi_get_rotation(&props, order, node);
+		} else {
+			transform.rotation = ufbx_identity_quat;
+		}
+		if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_SCALE) != 0) {
+			transform.scale = ufbxi_get_scale(&props, node);
+		} else {
+			transform.scale = ufbxi_one_vec3;
+		}
+	}
+
+	if (use_scale_factor) {
+		transform.scale.x *= scale_factor.x;
+		transform.scale.y *= scale_factor.y;
+		transform.scale.z *= scale_factor.z;
+	}
+	return transform;
+}
+
 // Recursion limited by not calling `ufbx_evaluate_curve()` with `UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION`.
 static ufbxi_noinline ufbx_real ufbxi_extrapolate_curve(const ufbx_anim_curve *curve, double real_time, uint32_t flags)
 	ufbxi_recursive_function(ufbx_real, ufbxi_extrapolate_curve, (curve, real_time, flags), 3,
@@ -26041,6 +29933,131 @@ static ufbxi_noinline ufbx_real ufbxi_extrapolate_curve(const ufbx_anim_curve *c
 	return value;
 }
 
+// Find the index of the first keyframe after `time`, starting from `hint` which is the
+// result of a previous search. Time usually moves forward in small steps so try a few
+// keyframes after the hint before falling back to binary search.
+// Keyframe times are read from `times` with a byte stride of `stride`.
+static ufbxi_forceinline size_t ufbxi_find_key_time(const char *times, size_t stride, size_t count, double time, size_t hint)
+{
+	#define ufbxi_key_time(ix) (*(const double*)(times + (ix) * stride))
+
+	size_t begin = 0;
+	size_t end = count;
+	if (hint <= count) {
+		if (hint > 0 && ufbxi_key_time(hint - 1) > time) {
+			end = hint - 1;
+		} else {
+			size_t scan_end = ufbxi_min_sz(hint + UFBXI_CURVE_CURSOR_SCAN, count);
+			for (begin = hint; begin < scan_end; begin++) {
+				if (ufbxi_key_time(begin) > time) return begin;
+			}
+		}
+	}
+
+	while (end - begin >= 8) {
+		size_t mid = (begin + end) >> 1;
+		if (ufbxi_key_time(mid) <= time) {
+			begin = mid + 1;
+		} else {
+			end = mid;
+		}
+	}
+
+	for (; begin < count; begin++) {
+		if (ufbxi_key_time(begin) > time) break;
+	}
+	return begin;
+
+	#undef ufbxi_key_time
+}
+
+static ufbxi_forceinline size_t ufbxi_find_curve_key(const ufbx_keyframe *keys, size_t count, double time, size_t hint)
+{
+	return ufbxi_find_key_time((const char*)&keys->time, sizeof(ufbx_keyframe), count, time, hint);
+}
+
+static ufbxi_noinline ufbx_real ufbxi_evaluate_curve(const ufbx_anim_curve *curve, double time, ufbx_real default_value, uint32_t flags, uint32_t *p_key)
+{
+	if (!curve) return default_value;
+	if (curve->keyframes.count <= 1) {
+		if (curve->keyframes.count == 1) {
+			return curve->keyframes.data[0].value;
+		} else {
+			return default_value;
+		}
+	}
+
+	if ((flags & UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION) == 0) {
+		if (time < curve->min_time || time > curve->max_time) {
+			return ufbxi_extrapolate_curve(curve, time, flags);
+		}
+	}
+
+	const ufbx_keyframe *keys = curve->keyframes.data;
+	size_t count = curve->keyframes.count;
+	size_t index = ufbxi_find_curve_key(keys, count, time, p_key ? *p_key : SIZE_MAX);
+	if (p_key) *p_key = (uint32_t)ufbxi_min_sz(index, UINT32_MAX);
+
+	// Last keyframe
+	if (index == count) return keys[count - 1].value;
+
+	// First keyframe
+	const ufbx_keyframe *next = &keys[index];
+	if (index == 0) return next->value;
+
+	const ufbx_keyframe *prev = next - 1;
+
+	// Exact keyframe
+	if (prev->time == time) return prev->value;
+
+	double rcp_delta = 1.0 / (next->time - prev->time);
+	double t = (time - prev->time) * rcp_delta;
+
+	switch (prev->interpolation) {
+
+	case UFBX_INTERPOLATION_CONSTANT_PREV:
+		return prev->value;
+
+	case UFBX_INTERPOLATION_CONSTANT_NEXT:
+		return next->value;
+
+	case UFBX_INTERPOLATION_LINEAR:
+		return (ufbx_real)(prev->value*(1.0 - t) + next->value*t);
+
+	case UFBX_INTERPOLATION_CUBIC:
+	{
+		double x1 = prev->right.dx * rcp_delta;
+		double x2 = 1.0 - next->left.dx * rcp_delta;
+		t = ufbxi_find_cubic_bezier_t(x1, x2, t);
+
+		double t2 = t*t, t3 = t2*t;
+		double u = 1.0 - t, u2 = u*u, u3 = u2*u;
+
+		double y0 = prev->value;
+		double y3 = next->value;
+		double y1 = y0 + prev->right.dy;
+		double y2 = y3 - next->left.dy;
+
+		return (ufbx_real)(u3*y0 + 3.0 * (u2*t*y1 + u*t2*y2) + t3*y3);
+	}
+
+	default:
+		ufbxi_unreachable("Bad interpolation mode");
+		return 0.0f;
+
+	}
+}
+
+static ufbxi_noinline ufbx_vec3 ufbxi_evaluate_anim_value_vec3(const ufbx_anim_value *anim_value, double time, uint32_t flags, ufbx_uint32_list *curve_keys)
+{
+	ufbx_vec3 res = anim_value->default_value;
+	for (size_t i = 0; i < 3; i++) {
+		const ufbx_anim_curve *curve = anim_value->curves[i];
+		if (curve) res.v[i] = ufbxi_evaluate_curve(curve, time, res.v[i], flags, ufbxi_curve_key_hint(curve_keys, curve));
+	}
+	return res;
+}
+
 #if UFBXI_FEATURE_SCENE_EVALUATION
 
 typedef struct {
@@ -26061,12 +30078,49 @@ typedef struct {
 
 	ufbxi_buf result;
 	ufbxi_buf tmp;
+	ufbxi_buf tmp_stack;
+
+	ufbxi_thread_pool thread_pool;
 
 	ufbx_scene scene;
 
 	ufbxi_scene_imp *scene_imp;
 } ufbxi_eval_context;
 
+// Copy of the animation inputs that affect which elements need to be evaluated,
+// compared by value as the same `ufbx_anim` pointer may be reused for a different animation.
+typedef struct {
+	uint32_t evaluate_flags;
+	bool ignore_connections;
+	ufbx_anim_layer_list layers;
+	ufbx_real_list override_layer_weights;
+	ufbx_prop_override_list prop_overrides;
+	size_t layer_capacity;
+	size_t layer_weight_capacity;
+	size_t prop_override_capacity;
+} ufbxi_eval_key;
+
+// Retained in evaluated scenes, allocated from the scene result buffer.
+struct ufbxi_eval_state {
+	// Inputs of the latest full evaluation, `dynamic_element_ids` are valid for it.
+	ufbxi_eval_key key;
+	bool has_dynamic_elements;
+	uint32_t *dynamic_element_ids;
+	size_t num_dynamic_elements;
+
+	// Property buffers owned by the evaluated scene and their allocated sizes, or `NULL` and zero.
+	// NOTE: Kept separately as `ufbx_element.props` refers to the source scene for elements without animated properties.
+	ufbx_prop **prop_buffers;
+	uint32_t *prop_capacity;
+
+	// Keyframe cursor per `ufbx_anim_curve.typed_id` shared by consecutive updates.
+	ufbx_uint32_list curve_keys;
+
+	bool evaluated_skinning;
+	ufbxi_skinning_mesh *skinning_meshes;
+	size_t num_skinning_meshes;
+};
+
 static ufbxi_forceinline ufbx_element *ufbxi_translate_element(ufbxi_eval_context *ec, void *elem)
 {
 	return elem ? (ufbx_element*)(ec->dst_element + ((char*)elem - ec->src_element)) : NULL;
@@ -26102,11 +30156,42 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_translate_anim(ufbxi_eval_contex
 	return 1;
 }
 
+// Element with animated or overridden properties evaluated by `ufbxi_eval_props_task_fn()`.
+typedef struct {
+	ufbx_element *element;
+	ufbx_prop_override_list overrides;
+	ufbx_prop *props;
+	size_t num_animated;
+	ufbx_props result;
+} ufbxi_eval_element;
+
+typedef struct {
+	const ufbx_anim *anim;
+	double time;
+	uint32_t flags;
+	ufbxi_eval_element *elements;
+	size_t count;
+} ufbxi_eval_props_task;
+
+static bool ufbxi_eval_props_task_fn(ufbxi_task *task)
+{
+	ufbxi_eval_props_task *t = (ufbxi_eval_props_task*)task->data;
+	ufbx_anim anim = *t->anim;
+	ufbxi_for(ufbxi_eval_element, ee, t->elements, t->count) {
+		anim.prop_overrides = ee->overrides;
+		ee->result = ufbx_evaluate_props_flags(&anim, ee->element, t->time, ee->props, ee->num_animated, t->flags);
+	}
+	return true;
+}
+
 ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_imp(ufbxi_eval_context *ec)
 {
 	ec->scene = ec->src_scene;
 	size_t num_elements = ec->scene.elements.count;
 
+	ufbxi_eval_state *state = ufbxi_push_zero(&ec->result, ufbxi_eval_state, 1);
+	ufbxi_check_err(&ec->error, state);
+
 	char *element_data = (char*)ufbxi_push(&ec->result, uint64_t, ec->scene.metadata.element_buffer_size/8);
 	ufbxi_check_err(&ec->error, element_data);
 
@@ -26374,7 +30459,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_imp(ufbxi_eval_context
 	ufbx_anim anim = *ec->anim;
 	ufbx_prop_override *over = anim.prop_overrides.data, *over_end = ufbxi_add_ptr(over, anim.prop_overrides.count);
 
-	// Evaluate the properties
+	// Allocate property buffers for elements with animated or overridden properties
+	size_t num_eval_elements = 0;
 	ufbxi_for_ptr_list(ufbx_element, p_elem, ec->scene.elements) {
 		ufbx_element *elem = *p_elem;
 		size_t num_animated = elem->props.num_animated;
@@ -26389,13 +30475,40 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_imp(ufbxi_eval_context
 		num_animated += num_override;
 		if (num_animated == 0) continue;
 
-		anim.prop_overrides.data = ufbxi_sub_ptr(over, num_override);
-		anim.prop_overrides.count = num_override;
-
-		ufbx_prop *props = ufbxi_push(&ec->result, ufbx_prop, num_animated);
-		ufbxi_check_err(&ec->error, props);
-
-		elem->props = ufbx_evaluate_props_flags(&anim, elem, ec->time, props, num_animated, ec->opts.evaluate_flags);
+		ufbxi_eval_element *ee = ufbxi_push(&ec->tmp_stack, ufbxi_eval_element, 1);
+		ufbxi_check_err(&ec->error, ee);
+		ee->element = elem;
+		ee->overrides.data = ufbxi_sub_ptr(over, num_override);
+		ee->overrides.count = num_override;
+		ee->num_animated = num_animated;
+		ee->props = ufbxi_push(&ec->result, ufbx_prop, num_animated);
+		ufbxi_check_err(&ec->error, ee->props);
+		num_eval_elements++;
+	}
+
+	ufbxi_eval_element *eval_elements = ufbxi_push_pop(&ec->tmp, &ec->tmp_stack, ufbxi_eval_element, num_eval_elements);
+	ufbxi_check_err(&ec->error, eval_elements);
+
+	// Evaluate the properties in chunks, the results are assigned only after all the
+	// tasks have finished as connected properties may read other elements.
+	size_t num_eval_tasks = (num_eval_elements + UFBXI_EVALUATE_PROPS_CHUNK_SIZE - 1) / UFBXI_EVALUATE_PROPS_CHUNK_SIZE;
+	ufbxi_eval_props_task *eval_tasks = ufbxi_push(&ec->tmp, ufbxi_eval_props_task, num_eval_tasks);
+	ufbxi_check_err(&ec->error, eval_tasks);
+	for (size_t i = 0; i < num_eval_tasks; i++) {
+		ufbxi_eval_props_task *t = &eval_tasks[i];
+		size_t begin = i * UFBXI_EVALUATE_PROPS_CHUNK_SIZE;
+		t->anim = &anim;
+		t->time = ec->time;
+		t->flags = ec->opts.evaluate_flags;
+		t->elements = eval_elements + begin;
+		t->count = ufbxi_min_sz(num_eval_elements - begin, UFBXI_EVALUATE_PROPS_CHUNK_SIZE);
+		ufbxi_check_err(&ec->error, ufbxi_thread_pool_dispatch(&ec->thread_pool, &ec->error, &ufbxi_eval_props_task_fn, t));
+	}
+	ufbxi_check_err(&ec->error, ufbxi_thread_pool_dispatch_wait(&ec->thread_pool, &ec->error));
+
+	ufbxi_for(ufbxi_eval_element, ee, eval_elements, num_eval_elements) {
+		ufbx_element *elem = ee->element;
+		elem->props = ee->result;
 		elem->props.defaults = &ec->src_scene.elements.data[elem->element_id]->props;
 	}
 
@@ -26406,8 +30519,10 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_imp(ufbxi_eval_context
 	if (ec->opts.evaluate_skinning) {
 		ufbx_geometry_cache_data_opts cache_opts = { 0 };
 		cache_opts.open_file_cb = ec->opts.open_file_cb;
-		ufbxi_check_err(&ec->error, ufbxi_evaluate_skinning(&ec->scene, &ec->error, &ec->result, &ec->tmp,
-			ec->time, ec->opts.load_external_files && ec->opts.evaluate_caches, &cache_opts));
+		ufbxi_check_err(&ec->error, ufbxi_evaluate_skinning(&ec->scene, &ec->error, &ec->result, &ec->tmp, &ec->thread_pool,
+			ec->time, ec->opts.load_external_files && ec->opts.evaluate_caches, &cache_opts,
+			&state->skinning_meshes, &state->num_skinning_meshes));
+		state->evaluated_skinning = true;
 	}
 
 	// Retain the scene, this must be the final allocation as we copy
@@ -26420,6 +30535,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_imp(ufbxi_eval_context
 
 	imp->magic = UFBXI_SCENE_IMP_MAGIC;
 	imp->scene = ec->scene;
+	imp->eval_state = state;
 	imp->refcount.ator = ec->ator_result;
 	imp->refcount.ator.error = NULL;
 
@@ -26461,12 +30577,15 @@ ufbxi_nodiscard static ufbxi_noinline ufbx_scene *ufbxi_evaluate_scene(ufbxi_eva
 
 	ec->result.ator = &ec->ator_result;
 	ec->tmp.ator = &ec->ator_tmp;
+	ec->tmp_stack.ator = &ec->ator_tmp;
 
 	ec->result.unordered = true;
 	ec->tmp.unordered = true;
 
-	if (ufbxi_evaluate_imp(ec)) {
+	if (ufbxi_thread_pool_init(&ec->thread_pool, &ec->error, &ec->ator_tmp, &ec->opts.thread_opts) && ufbxi_evaluate_imp(ec)) {
+		ufbxi_thread_pool_free(&ec->thread_pool);
 		ufbxi_buf_free(&ec->tmp);
+		ufbxi_buf_free(&ec->tmp_stack);
 		ufbxi_free_ator(&ec->ator_tmp);
 		if (p_error) {
 			ufbxi_clear_error(p_error);
@@ -26474,7 +30593,9 @@ ufbxi_nodiscard static ufbxi_noinline ufbx_scene *ufbxi_evaluate_scene(ufbxi_eva
 		return &ec->scene_imp->scene;
 	} else {
 		ufbxi_fix_error_type(&ec->error, "Failed to evaluate", p_error);
+		ufbxi_thread_pool_free(&ec->thread_pool);
 		ufbxi_buf_free(&ec->tmp);
+		ufbxi_buf_free(&ec->tmp_stack);
 		ufbxi_buf_free(&ec->result);
 		ufbxi_free_ator(&ec->ator_tmp);
 		ufbxi_free_ator(&ec->ator_result);
@@ -26482,6 +30603,255 @@ ufbxi_nodiscard static ufbxi_noinline ufbx_scene *ufbxi_evaluate_scene(ufbxi_eva
 	}
 }
 
+// Returns `true` if the evaluated properties of `elem` may change depending on time.
+static ufbxi_noinline bool ufbxi_is_element_dynamic(const ufbx_anim *anim, const ufbx_element *elem)
+{
+	if (!anim->ignore_connections) {
+		ufbxi_for_list(ufbx_prop, prop, elem->props.props) {
+			if (prop->flags & UFBX_PROP_FLAG_CONNECTED) return true;
+		}
+	}
+
+	ufbxi_for_ptr_list(ufbx_anim_layer, p_layer, anim->layers) {
+		ufbx_anim_prop_list anim_props = ufbx_find_anim_props(*p_layer, elem);
+		ufbxi_for_list(ufbx_anim_prop, anim_prop, anim_props) {
+			ufbx_anim_value *value = anim_prop->anim_value;
+			for (size_t i = 0; i < 3; i++) {
+				if (value->curves[i] && value->curves[i]->keyframes.count > 0) return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static ufbxi_noinline bool ufbxi_prop_override_equal(const ufbx_prop_override *a, const ufbx_prop_override *b)
+{
+	return a->element_id == b->element_id && a->prop_name.data == b->prop_name.data && a->prop_name.length == b->prop_name.length
+		&& a->value.x == b->value.x && a->value.y == b->value.y && a->value.z == b->value.z && a->value.w == b->value.w
+		&& a->value_str.data == b->value_str.data && a->value_str.length == b->value_str.length && a->value_int == b->value_int;
+}
+
+// Returns `true` if evaluating `anim` with `evaluate_flags` finds the same dynamic elements as `key`.
+// NOTE: Strings are compared by pointer which may cause unnecessary full updates but never misses a change.
+static ufbxi_noinline bool ufbxi_eval_key_equal(const ufbxi_eval_key *key, const ufbx_anim *anim, uint32_t evaluate_flags)
+{
+	if (key->evaluate_flags != evaluate_flags || key->ignore_connections != anim->ignore_connections) return false;
+	if (key->layers.count != anim->layers.count) return false;
+	if (key->override_layer_weights.count != anim->override_layer_weights.count) return false;
+	if (key->prop_overrides.count != anim->prop_overrides.count) return false;
+
+	for (size_t i = 0; i < anim->layers.count; i++) {
+		if (key->layers.data[i] != anim->layers.data[i]) return false;
+	}
+	for (size_t i = 0; i < anim->override_layer_weights.count; i++) {
+		if (key->override_layer_weights.data[i] != anim->override_layer_weights.data[i]) return false;
+	}
+	for (size_t i = 0; i < anim->prop_overrides.count; i++) {
+		if (!ufbxi_prop_override_equal(&key->prop_overrides.data[i], &anim->prop_overrides.data[i])) return false;
+	}
+	return true;
+}
+
+// Copy `count` elements of `size` bytes to `*p_data`, growing it from `buf` if it has less than `count` capacity.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_eval_key_copy(ufbx_error *error, ufbxi_buf *buf, void *p_data, size_t *p_capacity, const void *src, size_t count, size_t size)
+{
+	void **p_dst = (void**)p_data;
+	if (count > *p_capacity) {
+		*p_dst = ufbxi_push_size(buf, size, count);
+		ufbxi_check_err(error, *p_dst);
+		*p_capacity = count;
+	}
+	if (count > 0) {
+		memcpy(*p_dst, src, count * size);
+	}
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_eval_key_store(ufbxi_eval_key *key, ufbx_error *error, ufbxi_buf *buf, const ufbx_anim *anim, uint32_t evaluate_flags)
+{
+	key->evaluate_flags = evaluate_flags;
+	key->ignore_connections = anim->ignore_connections;
+	ufbxi_check_err(error, ufbxi_eval_key_copy(error, buf, &key->layers.data, &key->layer_capacity,
+		anim->layers.data, anim->layers.count, sizeof(ufbx_anim_layer*)));
+	ufbxi_check_err(error, ufbxi_eval_key_copy(error, buf, &key->override_layer_weights.data, &key->layer_weight_capacity,
+		anim->override_layer_weights.data, anim->override_layer_weights.count, sizeof(ufbx_real)));
+	ufbxi_check_err(error, ufbxi_eval_key_copy(error, buf, &key->prop_overrides.data, &key->prop_override_capacity,
+		anim->prop_overrides.data, anim->prop_overrides.count, sizeof(ufbx_prop_override)));
+	key->layers.count = anim->layers.count;
+	key->override_layer_weights.count = anim->override_layer_weights.count;
+	key->prop_overrides.count = anim->prop_overrides.count;
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_evaluate_update_imp(ufbxi_eval_context *ec, ufbxi_scene_imp *imp)
+{
+	ufbxi_eval_state *state = imp->eval_state;
+	ufbx_scene *scene = &imp->scene;
+	ufbxi_buf *result = &imp->refcount.buf;
+	size_t num_elements = scene->elements.count;
+	const ufbx_anim *src_anim = ec->anim;
+
+	// `ec->result` points to temporary memory here, anything retained by the
+	// evaluated scene is allocated from `imp->refcount.buf`.
+	ec->src_element = (char*)ec->src_scene.elements.data[0];
+	ec->dst_element = (char*)scene->elements.data[0];
+	ufbxi_check_err(&ec->error, ufbxi_translate_anim(ec, &ec->anim));
+
+	if (!state->prop_capacity) {
+		state->prop_buffers = ufbxi_push(result, ufbx_prop*, num_elements);
+		state->prop_capacity = ufbxi_push(result, uint32_t, num_elements);
+		ufbxi_check_err(&ec->error, state->prop_buffers && state->prop_capacity);
+		for (size_t i = 0; i < num_elements; i++) {
+			ufbx_element *src = ec->src_scene.elements.data[i];
+			ufbx_element *elem = scene->elements.data[i];
+			bool owned = elem->props.props.data != src->props.props.data;
+			state->prop_buffers[i] = owned ? elem->props.props.data : NULL;
+			state->prop_capacity[i] = owned ? (uint32_t)elem->props.props.count : 0;
+		}
+	}
+
+	if (!state->dynamic_element_ids) {
+		state->dynamic_element_ids = ufbxi_push(result, uint32_t, num_elements);
+		ufbxi_check_err(&ec->error, state->dynamic_element_ids);
+	}
+
+	if (!state->curve_keys.data) {
+		state->curve_keys.data = ufbxi_push_zero(result, uint32_t, scene->anim_curves.count);
+		ufbxi_check_err(&ec->error, state->curve_keys.data);
+		state->curve_keys.count = scene->anim_curves.count;
+	}
+
+	ufbx_anim anim = *ec->anim;
+
+	// Changing the animation requires evaluating every element, otherwise
+	// we can skip the ones that evaluate to the same value at any time.
+	bool full_update = !state->has_dynamic_elements || !ufbxi_eval_key_equal(&state->key, src_anim, ec->opts.evaluate_flags);
+	if (full_update) {
+		// Not valid until the full update succeeds
+		state->has_dynamic_elements = false;
+	}
+	bool all_dynamic = false;
+	ufbxi_for_ptr_list(ufbx_anim_layer, p_layer, anim.layers) {
+		if ((*p_layer)->weight_is_animated) all_dynamic = true;
+	}
+
+	size_t num_update = full_update ? num_elements : state->num_dynamic_elements;
+	size_t num_dynamic = 0;
+	for (size_t i = 0; i < num_update; i++) {
+		uint32_t element_id = full_update ? (uint32_t)i : state->dynamic_element_ids[i];
+		ufbx_element *src = ec->src_scene.elements.data[element_id];
+		ufbx_element *elem = scene->elements.data[element_id];
+
+		ufbx_prop *props = state->prop_buffers[element_id];
+		elem->props = src->props;
+
+		ufbx_prop_override_list overrides = ufbxi_find_element_prop_overrides(&ec->anim->prop_overrides, element_id);
+		size_t num_animated = src->props.num_animated + overrides.count;
+		if (num_animated == 0) continue;
+
+		if (full_update && (all_dynamic || ufbxi_is_element_dynamic(&anim, elem))) {
+			state->dynamic_element_ids[num_dynamic++] = element_id;
+		}
+
+		if (num_animated > state->prop_capacity[element_id]) {
+			props = ufbxi_push(result, ufbx_prop, num_animated);
+			ufbxi_check_err(&ec->error, props);
+			state->prop_buffers[element_id] = props;
+			state->prop_capacity[element_id] = (uint32_t)num_animated;
+		}
+
+		anim.prop_overrides = overrides;
+		elem->props = ufbxi_evaluate_element_props(&anim, elem, ec->time, props, num_animated, ec->opts.evaluate_flags, &state->curve_keys);
+		elem->props.defaults = &src->props;
+	}
+
+	if (full_update) {
+		ufbxi_check_err(&ec->error, ufbxi_eval_key_store(&state->key, &ec->error, result, src_anim, ec->opts.evaluate_flags));
+		state->has_dynamic_elements = true;
+		state->num_dynamic_elements = num_dynamic;
+	}
+
+	// Update all derived values
+	ufbxi_update_scene(scene, false, anim.transform_overrides.data, anim.transform_overrides.count);
+
+	if (ec->opts.evaluate_skinning) {
+		ufbx_geometry_cache_data_opts cache_opts = { 0 };
+		cache_opts.open_file_cb = ec->opts.open_file_cb;
+		bool load_caches = ec->opts.load_external_files && ec->opts.evaluate_caches;
+		if (state->evaluated_skinning) {
+			ufbxi_check_err(&ec->error, ufbxi_update_skinning(&ec->error, &ec->tmp, &ec->thread_pool,
+				ec->time, load_caches, &cache_opts, state->skinning_meshes, state->num_skinning_meshes));
+		} else {
+			ufbxi_check_err(&ec->error, ufbxi_evaluate_skinning(scene, &ec->error, result, &ec->tmp, &ec->thread_pool,
+				ec->time, load_caches, &cache_opts, &state->skinning_meshes, &state->num_skinning_meshes));
+			state->evaluated_skinning = true;
+		}
+	} else if (state->evaluated_skinning) {
+		// Don't leave skinned vertices from a previous update in the meshes
+		ufbxi_reset_skinning(&ec->src_scene, state->skinning_meshes, state->num_skinning_meshes);
+	}
+
+	scene->metadata.result_memory_used = imp->refcount.ator.current_size;
+	scene->metadata.temp_memory_used = ec->ator_tmp.current_size;
+	scene->metadata.result_allocs = imp->refcount.ator.num_allocs;
+	scene->metadata.temp_allocs = ec->ator_tmp.num_allocs;
+
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline bool ufbxi_evaluate_scene_update(ufbxi_eval_context *ec, ufbx_scene *scene, const ufbx_anim *anim, double time, const ufbx_evaluate_opts *user_opts, ufbx_error *p_error)
+{
+	if (user_opts) {
+		ec->opts = *user_opts;
+	} else {
+		memset(&ec->opts, 0, sizeof(ec->opts));
+	}
+
+	ufbxi_scene_imp *imp = ufbxi_get_imp(ufbxi_scene_imp, scene);
+	ufbx_assert(imp->magic == UFBXI_SCENE_IMP_MAGIC);
+
+	ufbxi_init_ator(&ec->error, &ec->ator_tmp, &ec->opts.temp_allocator, "temp");
+	ec->result.ator = &ec->ator_tmp;
+	ec->tmp.ator = &ec->ator_tmp;
+	ec->result.unordered = true;
+	ec->tmp.unordered = true;
+
+	bool ok = false;
+	if (imp->magic != UFBXI_SCENE_IMP_MAGIC) {
+		ufbxi_report_err_msg(&ec->error, "imp->magic", "Bad scene");
+	} else if (!imp->eval_state || !imp->refcount.parent) {
+		ufbxi_report_err_msg(&ec->error, "imp->eval_state", "Scene is not evaluated");
+	} else {
+		// Allow allocating retained data to the evaluated scene
+		imp->refcount.ator.error = &ec->error;
+
+		// `ufbxi_refcount` is the first member of `ufbxi_scene_imp`
+		ec->src_imp = (ufbxi_scene_imp*)imp->refcount.parent;
+		ufbx_assert(ec->src_imp->magic == UFBXI_SCENE_IMP_MAGIC);
+		ec->src_scene = ec->src_imp->scene;
+		ec->anim = anim ? (ufbx_anim*)anim : ec->src_scene.anim;
+		ec->time = time;
+
+		ok = ufbxi_thread_pool_init(&ec->thread_pool, &ec->error, &ec->ator_tmp, &ec->opts.thread_opts) && ufbxi_evaluate_update_imp(ec, imp);
+		imp->refcount.ator.error = NULL;
+	}
+
+	ufbxi_thread_pool_free(&ec->thread_pool);
+	ufbxi_buf_free(&ec->tmp);
+	ufbxi_buf_free(&ec->result);
+	ufbxi_free_ator(&ec->ator_tmp);
+
+	if (ok) {
+		if (p_error) {
+			ufbxi_clear_error(p_error);
+		}
+	} else {
+		ufbxi_fix_error_type(&ec->error, "Failed to update evaluated scene", p_error);
+	}
+	return ok;
+}
+
 #endif
 
 typedef struct {
@@ -26667,6 +31037,423 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_create_anim_imp(ufbxi_create_ani
 	return 1;
 }
 
+typedef struct {
+	ufbxi_refcount refcount;
+	ufbx_anim_cursor cursor;
+	uint32_t magic;
+} ufbxi_anim_cursor_imp;
+
+typedef struct {
+	ufbx_error error;
+
+	const ufbx_scene *scene;
+	const ufbx_anim *anim;
+	ufbx_anim_cursor_opts opts;
+
+	ufbxi_allocator ator_result;
+	ufbxi_buf result;
+
+	ufbxi_anim_cursor_imp *imp;
+} ufbxi_create_anim_cursor_context;
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_create_anim_cursor_imp(ufbxi_create_anim_cursor_context *cc)
+{
+	ufbxi_init_ator(&cc->error, &cc->ator_result, &cc->opts.result_allocator, "result");
+	cc->result.unordered = true;
+	cc->result.ator = &cc->ator_result;
+
+	ufbx_anim_cursor cursor = { cc->anim };
+	cursor.curve_keys.count = cc->scene->anim_curves.count;
+	cursor.curve_keys.data = ufbxi_push_zero(&cc->result, uint32_t, cursor.curve_keys.count);
+	ufbxi_check_err(&cc->error, cursor.curve_keys.data);
+
+	cc->imp = ufbxi_push(&cc->result, ufbxi_anim_cursor_imp, 1);
+	ufbxi_check_err(&cc->error, cc->imp);
+
+	// Custom animations are retained as they may be freed independently of the scene.
+	ufbxi_refcount *parent = &(ufbxi_get_imp(ufbxi_scene_imp, cc->scene))->refcount;
+	if (cc->anim->custom) {
+		parent = &(ufbxi_get_imp(ufbxi_anim_imp, cc->anim))->refcount;
+	}
+	ufbxi_init_ref(&cc->imp->refcount, UFBXI_ANIM_CURSOR_IMP_MAGIC, parent);
+
+	cc->imp->magic = UFBXI_ANIM_CURSOR_IMP_MAGIC;
+	cc->imp->cursor = cursor;
+	cc->imp->refcount.ator = cc->ator_result;
+	cc->imp->refcount.buf = cc->result;
+
+	return 1;
+}
+
+typedef struct {
+	ufbx_rotation_order rotation_order;
+
+	// Evaluated using `ufbxi_evaluate_transform()`.
+	bool fallback;
+
+	// Some of the transform values are written by animation curves,
+	// otherwise the node has a constant `transform`.
+	bool animated;
+	ufbx_transform transform;
+} ufbxi_compiled_node;
+
+// Curves are grouped by interpolation mode so that each group can be evaluated in a
+// tight loop, curves that use multiple interpolation modes go to `MIXED`.
+// Keyframes of `MIXED` and `CUBIC` curves are stored first, see `ufbxi_compiled_anim_imp`.
+typedef enum {
+	UFBXI_COMPILED_CURVE_MIXED,
+	UFBXI_COMPILED_CURVE_CUBIC,
+	UFBXI_COMPILED_CURVE_LINEAR,
+	UFBXI_COMPILED_CURVE_CONSTANT_PREV,
+	UFBXI_COMPILED_CURVE_CONSTANT_NEXT,
+
+	UFBXI_COMPILED_CURVE_GROUP_COUNT,
+} ufbxi_compiled_curve_group;
+
+typedef struct {
+	// Keyframes in `key_time[]` and `key_value[]`.
+	uint32_t key_begin;
+	uint32_t key_count;
+
+	// Index to `values` as an array of `ufbx_real`.
+	uint32_t dst;
+
+	// Keyframe cursor relative to `key_begin`.
+	uint32_t cursor;
+} ufbxi_compiled_curve;
+
+// Cubic segment starting from a keyframe, precomputed from the keyframe
+// tangents the same way as in `ufbxi_evaluate_curve()`.
+typedef struct {
+	double x1, x2;
+	double y1, y2;
+} ufbxi_compiled_cubic;
+
+typedef struct {
+	ufbxi_refcount refcount;
+	ufbx_compiled_anim compiled;
+	uint32_t magic;
+
+	uint32_t transform_flags;
+	uint32_t evaluate_flags;
+
+	ufbxi_compiled_node *nodes;
+	ufbxi_transform_values *values;
+
+	// Animation curves sorted by `ufbxi_compiled_curve_group`, `group_end[]` contains
+	// the end index of each group. `src_curves[]` is only used for extrapolation.
+	ufbxi_compiled_curve *curves;
+	const ufbx_anim_curve **src_curves;
+	uint32_t group_end[UFBXI_COMPILED_CURVE_GROUP_COUNT];
+
+	// Keyframes of all the curves flattened into a structure of arrays.
+	// `key_cubic[]` is parallel to the keyframes of `MIXED` and `CUBIC` curves and
+	// `key_interpolation[]` to the keyframes of `MIXED` curves.
+	double *key_time;
+	ufbx_real *key_value;
+	ufbxi_compiled_cubic *key_cubic;
+	uint8_t *key_interpolation;
+
+	// Keyframe cursor for `fallback` nodes.
+	ufbx_uint32_list fallback_curve_keys;
+} ufbxi_compiled_anim_imp;
+
+typedef struct {
+	ufbx_error error;
+
+	const ufbx_scene *scene;
+	const ufbx_anim *anim;
+	ufbx_compile_anim_opts opts;
+
+	ufbxi_allocator ator_tmp;
+	ufbxi_allocator ator_result;
+
+	ufbxi_buf result;
+	ufbxi_buf tmp_curves[UFBXI_COMPILED_CURVE_GROUP_COUNT];
+	ufbxi_buf tmp_compiled_curves[UFBXI_COMPILED_CURVE_GROUP_COUNT];
+
+	ufbxi_compiled_anim_imp *imp;
+} ufbxi_compile_anim_context;
+
+static const char *const ufbxi_compiled_transform_props[] = {
+	ufbxi_Lcl_Translation,
+	ufbxi_Lcl_Rotation,
+	ufbxi_Lcl_Scaling,
+};
+
+// Check if the node is affected by something else than the `Lcl Translation/Rotation/Scaling`
+// properties on the first animation layer.
+static ufbxi_noinline bool ufbxi_compiled_node_needs_fallback(const ufbx_anim *anim, const ufbx_node *node, uint32_t flags)
+{
+	if ((flags & UFBX_TRANSFORM_FLAG_EXPLICIT_INCLUDES) != 0) return true;
+
+	if (node->parent) {
+		if ((flags & UFBX_TRANSFORM_FLAG_IGNORE_COMPONENTWISE_SCALE) == 0 && node->parent->inherit_scale_node) return true;
+		if ((flags & UFBX_TRANSFORM_FLAG_IGNORE_SCALE_HELPER) == 0 && node->parent->scale_helper) return true;
+	}
+
+	if (ufbxi_find_element_prop_overrides(&anim->prop_overrides, node->element_id).count > 0) return true;
+
+	for (size_t i = 0; i < ufbxi_arraycount(ufbxi_transform_props_all); i++) {
+		const char *name = ufbxi_transform_props_all[i];
+		ufbx_prop *prop = ufbx_find_prop_len(&node->props, name, strlen(name));
+		if (prop && (prop->flags & UFBX_PROP_FLAG_CONNECTED) != 0 && !anim->ignore_connections) return true;
+	}
+
+	for (size_t layer_ix = 0; layer_ix < anim->layers.count; layer_ix++) {
+		ufbx_anim_prop_list anim_props = ufbx_find_anim_props(anim->layers.data[layer_ix], &node->element);
+		ufbxi_for_list(ufbx_anim_prop, aprop, anim_props) {
+			const char *name = aprop->prop_name.data;
+			bool is_transform = false, is_compiled = false;
+			for (size_t i = 0; i < ufbxi_arraycount(ufbxi_transform_props_all); i++) {
+				if (name == ufbxi_transform_props_all[i]) is_transform = true;
+			}
+			for (size_t i = 0; i < ufbxi_arraycount(ufbxi_compiled_transform_props); i++) {
+				if (name == ufbxi_compiled_transform_props[i]) is_compiled = true;
+			}
+			if (is_transform && (layer_ix > 0 || !is_compiled)) return true;
+		}
+	}
+
+	return false;
+}
+
+static ufbxi_forceinline ufbx_interpolation ufbxi_compiled_curve_group_interpolation(ufbxi_compiled_curve_group group)
+{
+	switch (group) {
+	case UFBXI_COMPILED_CURVE_CUBIC: return UFBX_INTERPOLATION_CUBIC;
+	case UFBXI_COMPILED_CURVE_LINEAR: return UFBX_INTERPOLATION_LINEAR;
+	case UFBXI_COMPILED_CURVE_CONSTANT_PREV: return UFBX_INTERPOLATION_CONSTANT_PREV;
+	case UFBXI_COMPILED_CURVE_CONSTANT_NEXT: return UFBX_INTERPOLATION_CONSTANT_NEXT;
+	default: return UFBX_INTERPOLATION_CUBIC;
+	}
+}
+
+static ufbxi_noinline ufbxi_compiled_curve_group ufbxi_compiled_curve_group_for(const ufbx_anim_curve *curve)
+{
+	// The interpolation mode of the last keyframe is never used
+	ufbx_interpolation interpolation = curve->keyframes.data[0].interpolation;
+	for (size_t i = 1; i + 1 < curve->keyframes.count; i++) {
+		if (curve->keyframes.data[i].interpolation != interpolation) return UFBXI_COMPILED_CURVE_MIXED;
+	}
+
+	switch (interpolation) {
+	case UFBX_INTERPOLATION_CONSTANT_PREV: return UFBXI_COMPILED_CURVE_CONSTANT_PREV;
+	case UFBX_INTERPOLATION_CONSTANT_NEXT: return UFBXI_COMPILED_CURVE_CONSTANT_NEXT;
+	case UFBX_INTERPOLATION_LINEAR: return UFBXI_COMPILED_CURVE_LINEAR;
+	case UFBX_INTERPOLATION_CUBIC: return UFBXI_COMPILED_CURVE_CUBIC;
+	default: return UFBXI_COMPILED_CURVE_MIXED;
+	}
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_compile_anim_node(ufbxi_compile_anim_context *cc, size_t index, const ufbx_node *node)
+{
+	const ufbx_anim *anim = cc->anim;
+	ufbxi_compiled_node *cn = &cc->imp->nodes[index];
+	ufbxi_transform_values *values = &cc->imp->values[index];
+	uint32_t flags = cc->opts.transform_flags;
+
+	ufbxi_get_transform_values(values, &node->props);
+	cn->rotation_order = (ufbx_rotation_order)ufbxi_find_enum(&node->props, ufbxi_RotationOrder, UFBX_ROTATION_ORDER_XYZ, UFBX_ROTATION_ORDER_SPHERIC);
+
+	if (node->is_root) {
+		cn->transform = node->local_transform;
+		return 1;
+	}
+
+	if (ufbxi_compiled_node_needs_fallback(anim, node, flags)) {
+		cn->fallback = true;
+		cc->imp->compiled.num_fallback_nodes++;
+		return 1;
+	}
+
+	// Only the first layer can contain the animation at this point, which is
+	// applied without blending, see `ufbxi_evaluate_props()`.
+	ufbx_anim_layer *layer = anim->layers.count > 0 ? anim->layers.data[0] : NULL;
+	for (size_t i = 0; i < ufbxi_arraycount(ufbxi_compiled_transform_props) && layer; i++) {
+		const char *name = ufbxi_compiled_transform_props[i];
+		ufbx_prop *prop = ufbx_find_prop_len(&node->props, name, strlen(name));
+		if (!prop || (prop->flags & UFBX_PROP_FLAG_ANIMATED) == 0) continue;
+
+		ufbx_anim_prop *aprop = ufbx_find_anim_prop_len(layer, &node->element, name, strlen(name));
+		if (!aprop) continue;
+
+		// `translation`, `rotation` and `scaling` are the first members of `ufbxi_transform_values`
+		ufbx_vec3 *dst = &values->translation + i;
+		const ufbx_anim_value *value = aprop->anim_value;
+		*dst = value->default_value;
+		for (size_t axis = 0; axis < 3; axis++) {
+			const ufbx_anim_curve *curve = value->curves[axis];
+			if (!curve) continue;
+			if (curve->keyframes.count <= 1) {
+				// Constant value, doesn't depend on time or flags
+				dst->v[axis] = ufbxi_evaluate_curve(curve, 0.0, dst->v[axis], 0, NULL);
+				continue;
+			}
+
+			size_t offset = (size_t)(dst->v + axis - (ufbx_real*)cc->imp->values);
+			ufbxi_check_err_msg(&cc->error, offset <= UINT32_MAX, "Too many nodes");
+
+			ufbxi_compiled_curve_group group = ufbxi_compiled_curve_group_for(curve);
+			ufbxi_compiled_curve *compiled_curve = ufbxi_push_zero(&cc->tmp_compiled_curves[group], ufbxi_compiled_curve, 1);
+			ufbxi_check_err(&cc->error, compiled_curve);
+			compiled_curve->dst = (uint32_t)offset;
+			ufbxi_check_err(&cc->error, ufbxi_push_copy(&cc->tmp_curves[group], const ufbx_anim_curve*, 1, &curve));
+			cn->animated = true;
+		}
+	}
+
+	if (!cn->animated) {
+		cn->transform = ufbxi_get_transform_from_values(values, cn->rotation_order, node, NULL);
+	}
+
+	return 1;
+}
+
+// Flatten the keyframes of the curves collected by `ufbxi_compile_anim_node()`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_compile_anim_curves(ufbxi_compile_anim_context *cc)
+{
+	ufbxi_compiled_anim_imp *imp = cc->imp;
+
+	size_t num_curves = 0;
+	for (size_t group = 0; group < UFBXI_COMPILED_CURVE_GROUP_COUNT; group++) {
+		num_curves += cc->tmp_curves[group].num_items;
+		imp->group_end[group] = (uint32_t)num_curves;
+	}
+	imp->compiled.num_curves = num_curves;
+
+	imp->curves = ufbxi_push(&cc->result, ufbxi_compiled_curve, num_curves);
+	imp->src_curves = ufbxi_push(&cc->result, const ufbx_anim_curve*, num_curves);
+	ufbxi_check_err(&cc->error, imp->curves && imp->src_curves);
+
+	size_t curve_ix = 0;
+	for (size_t group = 0; group < UFBXI_COMPILED_CURVE_GROUP_COUNT; group++) {
+		size_t count = cc->tmp_curves[group].num_items;
+		ufbxi_pop(&cc->tmp_curves[group], const ufbx_anim_curve*, count, imp->src_curves + curve_ix);
+		ufbxi_pop(&cc->tmp_compiled_curves[group], ufbxi_compiled_curve, count, imp->curves + curve_ix);
+		curve_ix += count;
+	}
+
+	size_t num_keys = 0, num_cubic_keys = 0, num_mixed_keys = 0;
+	for (size_t i = 0; i < num_curves; i++) {
+		ufbxi_compiled_curve *curve = &imp->curves[i];
+		size_t count = imp->src_curves[i]->keyframes.count;
+		ufbxi_check_err_msg(&cc->error, count <= UINT32_MAX - num_keys, "Too many keyframes");
+		curve->key_begin = (uint32_t)num_keys;
+		curve->key_count = (uint32_t)count;
+		num_keys += count;
+		if (i < imp->group_end[UFBXI_COMPILED_CURVE_CUBIC]) num_cubic_keys = num_keys;
+		if (i < imp->group_end[UFBXI_COMPILED_CURVE_MIXED]) num_mixed_keys = num_keys;
+	}
+
+	imp->key_time = ufbxi_push(&cc->result, double, num_keys);
+	imp->key_value = ufbxi_push(&cc->result, ufbx_real, num_keys);
+	imp->key_cubic = ufbxi_push_zero(&cc->result, ufbxi_compiled_cubic, num_cubic_keys);
+	imp->key_interpolation = ufbxi_push(&cc->result, uint8_t, num_mixed_keys);
+	ufbxi_check_err(&cc->error, imp->key_time && imp->key_value && imp->key_cubic && imp->key_interpolation);
+
+	for (size_t i = 0; i < num_curves; i++) {
+		const ufbxi_compiled_curve *curve = &imp->curves[i];
+		const ufbx_keyframe *keys = imp->src_curves[i]->keyframes.data;
+		size_t begin = curve->key_begin, count = curve->key_count;
+
+		for (size_t j = 0; j < count; j++) {
+			imp->key_time[begin + j] = keys[j].time;
+			imp->key_value[begin + j] = keys[j].value;
+		}
+
+		if (begin < num_cubic_keys) {
+			for (size_t j = 0; j + 1 < count; j++) {
+				const ufbx_keyframe *prev = &keys[j], *next = &keys[j + 1];
+				// Empty segments are never evaluated
+				if (!(next->time > prev->time)) continue;
+
+				ufbxi_compiled_cubic *cubic = &imp->key_cubic[begin + j];
+				double rcp_delta = 1.0 / (next->time - prev->time);
+				cubic->x1 = prev->right.dx * rcp_delta;
+				cubic->x2 = 1.0 - next->left.dx * rcp_delta;
+				cubic->y1 = (double)prev->value + prev->right.dy;
+				cubic->y2 = (double)next->value - next->left.dy;
+			}
+		}
+
+		if (begin < num_mixed_keys) {
+			for (size_t j = 0; j < count; j++) {
+				imp->key_interpolation[begin + j] = (uint8_t)keys[j].interpolation;
+			}
+		}
+	}
+
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_compile_anim_imp(ufbxi_compile_anim_context *cc)
+{
+	const ufbx_scene *scene = cc->scene;
+
+	ufbxi_init_ator(&cc->error, &cc->ator_tmp, &cc->opts.temp_allocator, "temp");
+	ufbxi_init_ator(&cc->error, &cc->ator_result, &cc->opts.result_allocator, "result");
+	cc->result.unordered = true;
+	cc->result.ator = &cc->ator_result;
+	for (size_t i = 0; i < UFBXI_COMPILED_CURVE_GROUP_COUNT; i++) {
+		cc->tmp_curves[i].ator = &cc->ator_tmp;
+		cc->tmp_compiled_curves[i].ator = &cc->ator_tmp;
+	}
+
+	cc->imp = ufbxi_push_zero(&cc->result, ufbxi_compiled_anim_imp, 1);
+	ufbxi_check_err(&cc->error, cc->imp);
+	ufbxi_compiled_anim_imp *imp = cc->imp;
+	ufbx_compiled_anim *compiled = &imp->compiled;
+
+	compiled->anim = cc->anim;
+	imp->transform_flags = cc->opts.transform_flags;
+	if (cc->opts.transform_flags & UFBX_TRANSFORM_FLAG_NO_EXTRAPOLATION) {
+		imp->evaluate_flags |= UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION;
+	}
+
+	size_t num_nodes = cc->opts.node_ids.count > 0 ? cc->opts.node_ids.count : scene->nodes.count;
+	compiled->nodes.count = num_nodes;
+	compiled->nodes.data = ufbxi_push(&cc->result, ufbx_node*, num_nodes);
+	ufbxi_check_err(&cc->error, compiled->nodes.data);
+	for (size_t i = 0; i < num_nodes; i++) {
+		uint32_t index = (uint32_t)i;
+		if (cc->opts.node_ids.count > 0) {
+			index = cc->opts.node_ids.data[i];
+			ufbxi_check_err_msg(&cc->error, index < scene->nodes.count, "node_ids out of bounds");
+		}
+		compiled->nodes.data[i] = scene->nodes.data[index];
+	}
+
+	imp->nodes = ufbxi_push_zero(&cc->result, ufbxi_compiled_node, num_nodes);
+	imp->values = ufbxi_push(&cc->result, ufbxi_transform_values, num_nodes);
+	ufbxi_check_err(&cc->error, imp->nodes && imp->values);
+
+	for (size_t i = 0; i < num_nodes; i++) {
+		ufbxi_check_err(&cc->error, ufbxi_compile_anim_node(cc, i, compiled->nodes.data[i]));
+	}
+
+	ufbxi_check_err(&cc->error, ufbxi_compile_anim_curves(cc));
+
+	if (compiled->num_fallback_nodes > 0) {
+		imp->fallback_curve_keys.count = scene->anim_curves.count;
+		imp->fallback_curve_keys.data = ufbxi_push_zero(&cc->result, uint32_t, scene->anim_curves.count);
+		ufbxi_check_err(&cc->error, imp->fallback_curve_keys.data);
+	}
+
+	// Custom animations are retained as they may be freed independently of the scene.
+	ufbxi_refcount *parent = &(ufbxi_get_imp(ufbxi_scene_imp, scene))->refcount;
+	if (cc->anim->custom) {
+		parent = &(ufbxi_get_imp(ufbxi_anim_imp, cc->anim))->refcount;
+	}
+	ufbxi_init_ref(&imp->refcount, UFBXI_COMPILED_ANIM_IMP_MAGIC, parent);
+
+	imp->magic = UFBXI_COMPILED_ANIM_IMP_MAGIC;
+	imp->refcount.ator = cc->ator_result;
+	imp->refcount.buf = cc->result;
+
+	return 1;
+}
+
 // -- Animation baking
 
 typedef struct {
@@ -26684,6 +31471,12 @@ typedef struct {
 
 UFBX_LIST_TYPE(ufbxi_bake_time_list, ufbxi_bake_time);
 
+typedef struct ufbxi_bake_task ufbxi_bake_task;
+
+// Granularity of threaded baking, see `ufbxi_bake_elements_threaded()`.
+#define UFBXI_BAKE_TASK_MIN_PROPS 16
+#define UFBXI_BAKE_MAX_TASKS 64
+
 typedef struct {
 	ufbx_error error;
 	ufbxi_allocator ator_tmp;
@@ -26720,6 +31513,13 @@ typedef struct {
 
 	ufbx_baked_anim bake;
 	ufbxi_baked_anim_imp *imp;
+
+	ufbxi_thread_pool thread_pool;
+	ufbxi_bake_task *tasks;
+	size_t num_tasks;
+
+	// Keyframe cursor per `ufbx_anim_curve.typed_id`, private to each task.
+	ufbx_uint32_list curve_keys;
 } ufbxi_bake_context;
 
 typedef struct {
@@ -26729,6 +31529,15 @@ typedef struct {
 	ufbx_anim_value *anim_value;
 } ufbxi_bake_prop;
 
+// Independent elements are baked in tasks using private contexts,
+// see `ufbxi_bake_elements_threaded()`.
+struct ufbxi_bake_task {
+	ufbxi_bake_context bc;
+	ufbxi_bake_prop *props;
+	size_t num_props;
+	bool ok;
+};
+
 static bool ufbxi_bake_prop_less(void *user, const void *va, const void *vb)
 {
 	(void)user;
@@ -27407,7 +32216,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_node_imp(ufbxi_bake_context
 		}
 
 		double eval_time = ufbxi_bake_time_sample_time(bake_time);
-		ufbx_transform transform = ufbx_evaluate_transform_flags(bc->anim, node, eval_time, flags);
+		ufbx_transform transform = ufbxi_evaluate_transform(bc->anim, node, eval_time, flags, &bc->curve_keys);
 
 		if (flags & UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION) {
 			if (scale_helper_t) {
@@ -27525,7 +32334,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_anim_prop(ufbxi_bake_contex
 	for (size_t i = 0; i < times.count; i++) {
 		ufbxi_bake_time bake_time = times.data[i];
 		double eval_time = ufbxi_bake_time_sample_time(bake_time);
-		ufbx_prop prop = ufbx_evaluate_prop_flags_len(bc->anim, element, name.data, name.length, eval_time, bc->opts.evaluate_flags);
+		ufbx_prop prop = ufbxi_evaluate_prop(bc->anim, element, name.data, name.length, eval_time, bc->opts.evaluate_flags, &bc->curve_keys);
 		keys.data[i].time = bake_time.time;
 		keys.data[i].value = prop.value_vec3;
 		keys.data[i].flags = (ufbx_baked_key_flags)bake_time.flags;
@@ -27584,6 +32393,211 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_element(ufbxi_bake_context
 	return 1;
 }
 
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_elements(ufbxi_bake_context *bc, ufbxi_bake_prop *props, size_t count)
+{
+	if (!bc->curve_keys.data) {
+		bc->curve_keys.data = ufbxi_push_zero(&bc->tmp, uint32_t, bc->scene->anim_curves.count);
+		ufbxi_check_err(&bc->error, bc->curve_keys.data);
+		bc->curve_keys.count = bc->scene->anim_curves.count;
+	}
+
+	size_t begin = 0;
+	while (begin < count) {
+		uint32_t element_id = props[begin].element_id;
+		size_t end = begin + 1;
+		while (end < count && props[end].element_id == element_id) {
+			end++;
+		}
+		ufbxi_check_err(&bc->error, ufbxi_bake_element(bc, element_id, props + begin, end - begin));
+		begin = end;
+	}
+
+	return 1;
+}
+
+static ufbxi_noinline void ufbxi_bake_init_tmp_bufs(ufbxi_bake_context *bc)
+{
+	bc->tmp.unordered = true;
+	bc->tmp.ator = &bc->ator_tmp;
+
+	bc->tmp_prop.ator = &bc->ator_tmp;
+	bc->tmp_prop.unordered = true;
+	bc->tmp_prop.clearable = true;
+
+	bc->tmp_times.ator = &bc->ator_tmp;
+	bc->tmp_bake_props.ator = &bc->ator_tmp;
+	bc->tmp_nodes.ator = &bc->ator_tmp;
+	bc->tmp_elements.ator = &bc->ator_tmp;
+	bc->tmp_props.ator = &bc->ator_tmp;
+	bc->tmp_bake_stack.ator = &bc->ator_tmp;
+}
+
+static ufbxi_noinline void ufbxi_bake_free_tmp_bufs(ufbxi_bake_context *bc)
+{
+	ufbxi_buf_free(&bc->tmp);
+	ufbxi_buf_free(&bc->tmp_prop);
+	ufbxi_buf_free(&bc->tmp_times);
+	ufbxi_buf_free(&bc->tmp_bake_props);
+	ufbxi_buf_free(&bc->tmp_nodes);
+	ufbxi_buf_free(&bc->tmp_elements);
+	ufbxi_buf_free(&bc->tmp_props);
+	ufbxi_buf_free(&bc->tmp_bake_stack);
+	ufbxi_free(&bc->ator_tmp, char, bc->tmp_arr, bc->tmp_arr_size);
+}
+
+// Must be called only after all the tasks have finished.
+static ufbxi_noinline void ufbxi_bake_free_tasks(ufbxi_bake_context *bc)
+{
+	ufbxi_for(ufbxi_bake_task, task, bc->tasks, bc->num_tasks) {
+		ufbxi_bake_free_tmp_bufs(&task->bc);
+		ufbxi_buf_free(&task->bc.result);
+		ufbxi_free_task_ator(&bc->ator_tmp, &task->bc.ator_tmp);
+	}
+	bc->num_tasks = 0;
+}
+
+static bool ufbxi_bake_task_fn(ufbxi_task *task)
+{
+	ufbxi_bake_task *t = (ufbxi_bake_task*)task->data;
+	t->ok = ufbxi_bake_elements(&t->bc, t->props, t->num_props) != 0;
+	return true;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_copy_vec3_keys(ufbxi_bake_context *bc, ufbx_baked_vec3_list *keys)
+{
+	if (keys->count == 0) return 1;
+	keys->data = ufbxi_push_copy(&bc->result, ufbx_baked_vec3, keys->count, keys->data);
+	ufbxi_check_err(&bc->error, keys->data);
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_copy_quat_keys(ufbxi_bake_context *bc, ufbx_baked_quat_list *keys)
+{
+	if (keys->count == 0) return 1;
+	keys->data = ufbxi_push_copy(&bc->result, ufbx_baked_quat, keys->count, keys->data);
+	ufbxi_check_err(&bc->error, keys->data);
+	return 1;
+}
+
+// Move the results of a finished task to the main context, copying the key data to `bc->result`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_merge_task(ufbxi_bake_context *bc, ufbxi_bake_context *tc)
+{
+	size_t num_nodes = tc->tmp_nodes.num_items;
+	ufbx_baked_node *nodes = ufbxi_push_pop(&bc->tmp_nodes, &tc->tmp_nodes, ufbx_baked_node, num_nodes);
+	ufbxi_check_err(&bc->error, nodes);
+
+	ufbxi_for(ufbx_baked_node, node, nodes, num_nodes) {
+		// The task pointed `baked_nodes[]` to its own buffer which is freed after merging
+		bc->baked_nodes[node->typed_id] = node;
+		ufbxi_check_err(&bc->error, ufbxi_bake_copy_vec3_keys(bc, &node->translation_keys));
+		ufbxi_check_err(&bc->error, ufbxi_bake_copy_quat_keys(bc, &node->rotation_keys));
+		ufbxi_check_err(&bc->error, ufbxi_bake_copy_vec3_keys(bc, &node->scale_keys));
+	}
+
+	size_t num_elements = tc->tmp_elements.num_items;
+	ufbx_baked_element *elements = ufbxi_push_pop(&bc->tmp_elements, &tc->tmp_elements, ufbx_baked_element, num_elements);
+	ufbxi_check_err(&bc->error, elements);
+
+	ufbxi_for(ufbx_baked_element, elem, elements, num_elements) {
+		elem->props.data = ufbxi_push_copy(&bc->result, ufbx_baked_prop, elem->props.count, elem->props.data);
+		ufbxi_check_err(&bc->error, elem->props.data);
+
+		ufbxi_for_list(ufbx_baked_prop, prop, elem->props) {
+			prop->name.data = ufbxi_push_copy(&bc->result, char, prop->name.length + 1, prop->name.data);
+			ufbxi_check_err(&bc->error, prop->name.data);
+			ufbxi_check_err(&bc->error, ufbxi_bake_copy_vec3_keys(bc, &prop->keys));
+		}
+	}
+
+	if (tc->time_min < bc->time_min) bc->time_min = tc->time_min;
+	if (tc->time_max > bc->time_max) bc->time_max = tc->time_max;
+
+	return 1;
+}
+
+// Scale helpers must be baked before the nodes that depend on them, so bake them
+// first serially. After that rest of the elements are independent from each other.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_elements_threaded(ufbxi_bake_context *bc, ufbxi_bake_prop *props, size_t count)
+{
+	ufbxi_bake_prop *task_props = ufbxi_push(&bc->tmp, ufbxi_bake_prop, count);
+	ufbxi_check_err(&bc->error, task_props);
+	size_t num_task_props = 0;
+
+	size_t begin = 0;
+	while (begin < count) {
+		uint32_t element_id = props[begin].element_id;
+		size_t end = begin + 1;
+		while (end < count && props[end].element_id == element_id) {
+			end++;
+		}
+
+		ufbx_element *element = bc->scene->elements.data[element_id];
+		if (element->type == UFBX_ELEMENT_NODE && ((ufbx_node*)element)->is_scale_helper) {
+			ufbxi_check_err(&bc->error, ufbxi_bake_element(bc, element_id, props + begin, end - begin));
+		} else {
+			memcpy(task_props + num_task_props, props + begin, (end - begin) * sizeof(ufbxi_bake_prop));
+			num_task_props += end - begin;
+		}
+		begin = end;
+	}
+
+	size_t props_per_task = ufbxi_max_sz(UFBXI_BAKE_TASK_MIN_PROPS, num_task_props / UFBXI_BAKE_MAX_TASKS + 1);
+	size_t max_tasks = num_task_props / props_per_task + 1;
+	bc->tasks = ufbxi_push_zero(&bc->tmp, ufbxi_bake_task, max_tasks);
+	ufbxi_check_err(&bc->error, bc->tasks);
+
+	begin = 0;
+	while (begin < num_task_props) {
+		size_t end = ufbxi_min_sz(begin + props_per_task, num_task_props);
+		while (end < num_task_props && task_props[end].element_id == task_props[end - 1].element_id) {
+			end++;
+		}
+
+		ufbx_assert(bc->num_tasks < max_tasks);
+		ufbxi_bake_task *task = &bc->tasks[bc->num_tasks++];
+		task->props = task_props + begin;
+		task->num_props = end - begin;
+
+		// Tasks allocate both temporary and result data using a private share of the temporary
+		// allocator, the results are copied to `bc->result` in `ufbxi_bake_merge_task()`.
+		ufbxi_bake_context *tc = &task->bc;
+		ufbxi_init_task_ator(&tc->error, &tc->ator_tmp, &bc->ator_tmp, max_tasks, "temp");
+		ufbxi_bake_init_tmp_bufs(tc);
+		tc->result.unordered = true;
+		tc->result.ator = &tc->ator_tmp;
+
+		tc->layer_weight_times = bc->layer_weight_times;
+		tc->baked_nodes = bc->baked_nodes;
+		tc->nodes_to_bake = bc->nodes_to_bake;
+		tc->scene = bc->scene;
+		tc->anim = bc->anim;
+		tc->opts = bc->opts;
+		tc->ktime_offset = bc->ktime_offset;
+		tc->time_begin = bc->time_begin;
+		tc->time_end = bc->time_end;
+		tc->time_min = UFBX_INFINITY;
+		tc->time_max = -UFBX_INFINITY;
+
+		ufbxi_check_err(&bc->error, ufbxi_thread_pool_dispatch(&bc->thread_pool, &bc->error, &ufbxi_bake_task_fn, task));
+		begin = end;
+	}
+
+	ufbxi_check_err(&bc->error, ufbxi_thread_pool_dispatch_wait(&bc->thread_pool, &bc->error));
+
+	// Merge in order to keep the output independent of the task scheduling
+	ufbxi_for(ufbxi_bake_task, task, bc->tasks, bc->num_tasks) {
+		if (!task->ok) {
+			bc->error = task->bc.error;
+			return 0;
+		}
+		ufbxi_check_err(&bc->error, ufbxi_bake_merge_task(bc, &task->bc));
+	}
+
+	ufbxi_bake_free_tasks(bc);
+
+	return 1;
+}
+
 static ufbxi_noinline bool ufbxi_baked_node_less(void *user, const void *va, const void *vb)
 {
 	(void)user;
@@ -27665,15 +32679,10 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_anim(ufbxi_bake_context *bc
 		}
 	}
 
-	size_t begin = 0;
-	while (begin < num_props) {
-		uint32_t element_id = props[begin].element_id;
-		size_t end = begin + 1;
-		while (end < num_props && props[end].element_id == element_id) {
-			end++;
-		}
-		ufbxi_check_err(&bc->error, ufbxi_bake_element(bc, element_id, props + begin, end - begin));
-		begin = end;
+	if (bc->thread_pool.enabled) {
+		ufbxi_check_err(&bc->error, ufbxi_bake_elements_threaded(bc, props, num_props));
+	} else {
+		ufbxi_check_err(&bc->error, ufbxi_bake_elements(bc, props, num_props));
 	}
 
 	size_t num_nodes = bc->tmp_nodes.num_items;
@@ -27722,19 +32731,9 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_bake_anim_imp(ufbxi_bake_context
 	bc->result.unordered = true;
 	bc->result.ator = &bc->ator_result;
 
-	bc->tmp.unordered = true;
-	bc->tmp.ator = &bc->ator_tmp;
-
-	bc->tmp_prop.ator = &bc->ator_tmp;
-	bc->tmp_prop.unordered = true;
-	bc->tmp_prop.clearable = true;
+	ufbxi_bake_init_tmp_bufs(bc);
 
-	bc->tmp_times.ator = &bc->ator_tmp;
-	bc->tmp_bake_props.ator = &bc->ator_tmp;
-	bc->tmp_nodes.ator = &bc->ator_tmp;
-	bc->tmp_elements.ator = &bc->ator_tmp;
-	bc->tmp_props.ator = &bc->ator_tmp;
-	bc->tmp_bake_stack.ator = &bc->ator_tmp;
+	ufbxi_check_err(&bc->error, ufbxi_thread_pool_init(&bc->thread_pool, &bc->error, &bc->ator_tmp, &bc->opts.thread_opts));
 
 	bc->anim = anim;
 	if (anim->time_begin < anim->time_end) {
@@ -28420,7 +33419,13 @@ ufbxi_noinline static void ufbxi_kd_build(ufbxi_ngon_context *nc, uint32_t *indi
 	ufbxi_recursive_function_void(ufbxi_kd_build, (nc, indices, tmp, num, axis, fast_index, depth), 32,
 		(ufbxi_ngon_context *nc, uint32_t *indices, uint32_t *tmp, uint32_t num, uint32_t axis, uint32_t fast_index, uint32_t depth))
 {
-	if (num == 0) return;
+	if (num == 0) {
+		// Mark empty nodes explicitly so `nc` can be reused between faces
+		if (depth < UFBXI_KD_FAST_DEPTH) {
+			nc->kd_nodes[fast_index].index_plus_one = 0;
+		}
+		return;
+	}
 
 	ufbx_vertex_vec3 pos = nc->positions;
 	ufbx_vec3 axis_dir = nc->axes[axis];
@@ -28687,6 +33692,326 @@ ufbxi_noinline static uint32_t ufbxi_triangulate_ngon(ufbxi_ngon_context *nc, ui
 	return num_triangles;
 }
 
+// Quad: Split along the shortest axis unless a vertex crosses the axis
+static ufbxi_noinline void ufbxi_triangulate_quad(const ufbx_mesh *mesh, ufbx_face face, uint32_t *indices)
+{
+	uint32_t i0 = face.index_begin + 0;
+	uint32_t i1 = face.index_begin + 1;
+	uint32_t i2 = face.index_begin + 2;
+	uint32_t i3 = face.index_begin + 3;
+	ufbx_vec3 v0 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i0]];
+	ufbx_vec3 v1 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i1]];
+	ufbx_vec3 v2 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i2]];
+	ufbx_vec3 v3 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i3]];
+
+	ufbx_vec3 a = ufbxi_sub3(v2, v0);
+	ufbx_vec3 b = ufbxi_sub3(v3, v1);
+
+	ufbx_vec3 na1 = ufbxi_normalize3(ufbxi_cross3(a, ufbxi_sub3(v1, v0)));
+	ufbx_vec3 na3 = ufbxi_normalize3(ufbxi_cross3(a, ufbxi_sub3(v0, v3)));
+	ufbx_vec3 nb0 = ufbxi_normalize3(ufbxi_cross3(b, ufbxi_sub3(v1, v0)));
+	ufbx_vec3 nb2 = ufbxi_normalize3(ufbxi_cross3(b, ufbxi_sub3(v2, v1)));
+
+	ufbx_real dot_aa = ufbxi_dot3(a, a);
+	ufbx_real dot_bb = ufbxi_dot3(b, b);
+	ufbx_real dot_na = ufbxi_dot3(na1, na3);
+	ufbx_real dot_nb = ufbxi_dot3(nb0, nb2);
+
+	bool split_a = dot_aa <= dot_bb;
+
+	if (dot_na < 0.0f || dot_nb < 0.0f) {
+		split_a = dot_na >= dot_nb;
+	}
+
+	if (split_a) {
+		indices[0] = i0;
+		indices[1] = i1;
+		indices[2] = i2;
+		indices[3] = i2;
+		indices[4] = i3;
+		indices[5] = i0;
+	} else {
+		indices[0] = i1;
+		indices[1] = i2;
+		indices[2] = i3;
+		indices[3] = i3;
+		indices[4] = i0;
+		indices[5] = i1;
+	}
+}
+
+// Triangulate a face with more than 4 vertices using `nc`, which is initialized with
+// the mesh positions and can be reused for multiple faces.
+static ufbxi_noinline uint32_t ufbxi_triangulate_ngon_face(ufbxi_ngon_context *nc, ufbx_face face, uint32_t *indices, size_t num_indices)
+{
+	nc->face = face;
+
+	uint32_t num_indices_u32 = num_indices < UINT32_MAX ? (uint32_t)num_indices : UINT32_MAX;
+
+	uint32_t local_indices[12]; // ufbxi_uninit
+	if (num_indices_u32 < 12) {
+		uint32_t num_tris = ufbxi_triangulate_ngon(nc, local_indices, 12);
+		memcpy(indices, local_indices, num_tris * 3 * sizeof(uint32_t));
+		return num_tris;
+	} else {
+		return ufbxi_triangulate_ngon(nc, indices, num_indices_u32);
+	}
+}
+
+// Triangulate a face with enough space for `(face.num_indices - 2) * 3` indices
+static ufbxi_noinline uint32_t ufbxi_triangulate_face(const ufbx_mesh *mesh, ufbx_face face, uint32_t *indices, size_t num_indices)
+{
+	if (face.num_indices == 3) {
+		// Fast case: Already a triangle
+		indices[0] = face.index_begin + 0;
+		indices[1] = face.index_begin + 1;
+		indices[2] = face.index_begin + 2;
+		return 1;
+	} else if (face.num_indices == 4) {
+		ufbxi_triangulate_quad(mesh, face, indices);
+		return 2;
+	} else {
+		ufbxi_ngon_context nc = { 0 };
+		nc.positions = mesh->vertex_position;
+		return ufbxi_triangulate_ngon_face(&nc, face, indices, num_indices);
+	}
+}
+
+// Whole mesh triangulation: Triangle counts are summed per chunk of faces and
+// converted to offsets in order, after which each chunk triangulates its faces
+// directly to their final location. Meshes consisting only of triangles or quads
+// have implicit offsets and skip counting. The result is identical to calling
+// `ufbx_triangulate_face()` for each face in order.
+
+typedef enum {
+	UFBXI_TRIANGULATE_MODE_GENERIC,
+	UFBXI_TRIANGULATE_MODE_TRIANGLES,
+	UFBXI_TRIANGULATE_MODE_QUADS,
+} ufbxi_triangulate_mode;
+
+typedef struct ufbxi_triangulate_task ufbxi_triangulate_task;
+
+typedef struct {
+	ufbx_error *error;
+	ufbxi_allocator ator;
+	ufbxi_thread_pool thread_pool;
+
+	const ufbx_mesh *mesh;
+	ufbxi_triangulate_mode mode;
+	uint32_t *indices;
+	size_t num_indices;
+	size_t num_triangles;
+
+	size_t num_chunks;
+	ufbxi_triangulate_task *tasks;
+} ufbxi_triangulate_context;
+
+struct ufbxi_triangulate_task {
+	ufbxi_triangulate_context *tc;
+	size_t index;
+	size_t num_triangles;
+	size_t triangle_offset;
+};
+
+static ufbxi_noinline size_t ufbxi_count_face_triangles(const ufbx_mesh *mesh, size_t begin, size_t end)
+{
+	size_t num_triangles = 0;
+	for (size_t i = begin; i < end; i++) {
+		uint32_t num_indices = mesh->faces.data[i].num_indices;
+		if (num_indices >= 3) num_triangles += num_indices - 2;
+	}
+	return num_triangles;
+}
+
+// Triangulate faces `[begin, end)` to `indices`, returns the number of triangles.
+static ufbxi_noinline size_t ufbxi_triangulate_faces(const ufbx_mesh *mesh, ufbxi_triangulate_mode mode, uint32_t *indices, size_t begin, size_t end)
+{
+	const ufbx_face *faces = mesh->faces.data;
+	size_t num_triangles = 0;
+
+	switch (mode) {
+	case UFBXI_TRIANGULATE_MODE_TRIANGLES:
+		for (size_t i = begin; i < end; i++) {
+			uint32_t index_begin = faces[i].index_begin;
+			indices[0] = index_begin + 0;
+			indices[1] = index_begin + 1;
+			indices[2] = index_begin + 2;
+			indices += 3;
+		}
+		num_triangles = end - begin;
+		break;
+	case UFBXI_TRIANGULATE_MODE_QUADS:
+		for (size_t i = begin; i < end; i++) {
+			ufbxi_triangulate_quad(mesh, faces[i], indices);
+			indices += 6;
+		}
+		num_triangles = (end - begin) * 2;
+		break;
+	default:
+	{
+		// Share the n-gon context between faces, the projection basis and KD-tree
+		// depend on the face so they are still built per face.
+		ufbxi_ngon_context nc = { 0 };
+		nc.positions = mesh->vertex_position;
+
+		for (size_t i = begin; i < end; i++) {
+			ufbx_face face = faces[i];
+			uint32_t *dst = indices + num_triangles * 3;
+			if (face.num_indices == 3) {
+				dst[0] = face.index_begin + 0;
+				dst[1] = face.index_begin + 1;
+				dst[2] = face.index_begin + 2;
+				num_triangles += 1;
+			} else if (face.num_indices == 4) {
+				ufbxi_triangulate_quad(mesh, face, dst);
+				num_triangles += 2;
+			} else if (face.num_indices > 4) {
+				size_t face_indices = ((size_t)face.num_indices - 2) * 3;
+				num_triangles += ufbxi_triangulate_ngon_face(&nc, face, dst, face_indices);
+			}
+		}
+	} break;
+	}
+
+	return num_triangles;
+}
+
+static bool ufbxi_triangulate_count_task_fn(ufbxi_task *task)
+{
+	ufbxi_triangulate_task *t = (ufbxi_triangulate_task*)task->data;
+	const ufbx_mesh *mesh = t->tc->mesh;
+	size_t begin = t->index * UFBXI_TRIANGULATE_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_TRIANGULATE_CHUNK_SIZE, mesh->num_faces);
+	t->num_triangles = ufbxi_count_face_triangles(mesh, begin, end);
+	return true;
+}
+
+static bool ufbxi_triangulate_task_fn(ufbxi_task *task)
+{
+	ufbxi_triangulate_task *t = (ufbxi_triangulate_task*)task->data;
+	ufbxi_triangulate_context *tc = t->tc;
+	const ufbx_mesh *mesh = tc->mesh;
+	size_t begin = t->index * UFBXI_TRIANGULATE_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_TRIANGULATE_CHUNK_SIZE, mesh->num_faces);
+	size_t num_triangles = ufbxi_triangulate_faces(mesh, tc->mode, tc->indices + t->triangle_offset * 3, begin, end);
+	ufbx_assert(num_triangles == t->num_triangles);
+	return num_triangles == t->num_triangles;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_triangulate_mesh_threaded_imp(ufbxi_triangulate_context *tc)
+{
+	const ufbx_mesh *mesh = tc->mesh;
+
+	tc->num_chunks = (mesh->num_faces + UFBXI_TRIANGULATE_CHUNK_SIZE - 1) / UFBXI_TRIANGULATE_CHUNK_SIZE;
+	tc->tasks = ufbxi_alloc(&tc->ator, ufbxi_triangulate_task, tc->num_chunks);
+	ufbxi_check_err(tc->error, tc->tasks);
+
+	for (size_t i = 0; i < tc->num_chunks; i++) {
+		ufbxi_triangulate_task *t = &tc->tasks[i];
+		t->tc = tc;
+		t->index = i;
+	}
+
+	if (tc->mode == UFBXI_TRIANGULATE_MODE_GENERIC) {
+		for (size_t i = 0; i < tc->num_chunks; i++) {
+			ufbxi_check_err(tc->error, ufbxi_thread_pool_dispatch(&tc->thread_pool, tc->error, &ufbxi_triangulate_count_task_fn, &tc->tasks[i]));
+		}
+		ufbxi_check_err(tc->error, ufbxi_thread_pool_dispatch_wait(&tc->thread_pool, tc->error));
+	} else {
+		size_t face_triangles = tc->mode == UFBXI_TRIANGULATE_MODE_QUADS ? 2 : 1;
+		for (size_t i = 0; i < tc->num_chunks; i++) {
+			size_t begin = i * UFBXI_TRIANGULATE_CHUNK_SIZE;
+			size_t end = ufbxi_min_sz(begin + UFBXI_TRIANGULATE_CHUNK_SIZE, mesh->num_faces);
+			tc->tasks[i].num_triangles = (end - begin) * face_triangles;
+		}
+	}
+
+	size_t num_triangles = 0;
+	for (size_t i = 0; i < tc->num_chunks; i++) {
+		tc->tasks[i].triangle_offset = num_triangles;
+		num_triangles += tc->tasks[i].num_triangles;
+	}
+	ufbxi_check_err_msg(tc->error, num_triangles <= tc->num_indices / 3, "Index buffer too small");
+
+	for (size_t i = 0; i < tc->num_chunks; i++) {
+		ufbxi_check_err(tc->error, ufbxi_thread_pool_dispatch(&tc->thread_pool, tc->error, &ufbxi_triangulate_task_fn, &tc->tasks[i]));
+	}
+	ufbxi_check_err(tc->error, ufbxi_thread_pool_dispatch_wait(&tc->thread_pool, tc->error));
+
+	tc->num_triangles = num_triangles;
+	return 1;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_triangulate_mesh_imp(ufbxi_triangulate_context *tc, const ufbx_thread_opts *thread_opts)
+{
+	const ufbx_mesh *mesh = tc->mesh;
+
+	// Meshes with only triangles or quads have a fixed amount of triangles per face
+	tc->mode = UFBXI_TRIANGULATE_MODE_GENERIC;
+	if (mesh->num_empty_faces == 0 && mesh->num_point_faces == 0 && mesh->num_line_faces == 0) {
+		if (mesh->num_triangles == mesh->num_faces) {
+			tc->mode = UFBXI_TRIANGULATE_MODE_TRIANGLES;
+		} else if (mesh->max_face_triangles == 2 && mesh->num_triangles == mesh->num_faces * 2) {
+			tc->mode = UFBXI_TRIANGULATE_MODE_QUADS;
+		}
+	}
+
+	if (mesh->num_faces > UFBXI_TRIANGULATE_CHUNK_SIZE) {
+		ufbxi_check_err(tc->error, ufbxi_thread_pool_init(&tc->thread_pool, tc->error, &tc->ator, thread_opts));
+	}
+
+	if (tc->thread_pool.enabled) {
+		ufbxi_check_err(tc->error, ufbxi_triangulate_mesh_threaded_imp(tc));
+	} else {
+		size_t num_triangles = ufbxi_count_face_triangles(mesh, 0, mesh->num_faces);
+		ufbxi_check_err_msg(tc->error, num_triangles <= tc->num_indices / 3, "Index buffer too small");
+		tc->num_triangles = ufbxi_triangulate_faces(mesh, tc->mode, tc->indices, 0, mesh->num_faces);
+		ufbx_assert(tc->num_triangles == num_triangles);
+	}
+
+	return 1;
+}
+
+static ufbxi_noinline size_t ufbxi_triangulate_mesh(const ufbx_mesh *mesh, uint32_t *indices, size_t num_indices, const ufbx_triangulate_opts *opts, ufbx_error *error)
+{
+	ufbxi_triangulate_context tc; // ufbxi_uninit
+	memset(&tc, 0, sizeof(tc));
+	tc.error = error;
+	tc.mesh = mesh;
+	tc.indices = indices;
+	tc.num_indices = num_indices;
+
+	ufbxi_init_ator(error, &tc.ator, &opts->temp_allocator, "temp");
+
+	size_t num_triangles = 0;
+	if (ufbxi_triangulate_mesh_imp(&tc, &opts->thread_opts)) {
+		num_triangles = tc.num_triangles;
+		ufbxi_clear_error(error);
+	} else {
+		ufbxi_fix_error_type(error, "Failed to triangulate mesh", NULL);
+	}
+
+	ufbxi_thread_pool_free(&tc.thread_pool);
+	ufbxi_free(&tc.ator, ufbxi_triangulate_task, tc.tasks, tc.num_chunks);
+	ufbxi_free_ator(&tc.ator);
+
+	return num_triangles;
+}
+
+#else
+
+static ufbxi_noinline size_t ufbxi_triangulate_mesh(const ufbx_mesh *mesh, uint32_t *indices, size_t num_indices, const ufbx_triangulate_opts *opts, ufbx_error *error)
+{
+	(void)mesh;
+	(void)indices;
+	(void)num_indices;
+	(void)opts;
+	memset(error, 0, sizeof(ufbx_error));
+	ufbxi_fmt_err_info(error, "UFBX_ENABLE_TRIANGULATION");
+	ufbxi_report_err_msg(error, "UFBXI_FEATURE_TRIANGULATION", "Feature disabled");
+	return 0;
+}
+
 #endif
 
 static bool ufbxi_topo_less_index_prev_next(void *user, const void *va, const void *vb)
@@ -28841,6 +34166,9 @@ typedef struct {
 	bool check_split_data;
 	bool ignore_indices;
 
+	// `sum_fn()` may be called concurrently from multiple threads
+	bool thread_safe_sum;
+
 	ufbx_subdivision_boundary boundary;
 
 } ufbxi_subdivide_layer_input;
@@ -28858,6 +34186,11 @@ typedef struct {
 	size_t num_weights;
 } ufbxi_subdivision_vertex_weights;
 
+typedef struct ufbxi_subdivide_task ufbxi_subdivide_task;
+
+// Granularity of threaded subdivision, see `ufbxi_subdivide_run_tasks()`.
+#define UFBXI_SUBDIVIDE_MAX_TASKS 64
+
 typedef struct {
 	ufbxi_mesh_imp *imp;
 
@@ -28866,7 +34199,7 @@ typedef struct {
 	ufbx_mesh *src_mesh_ptr;
 	ufbx_mesh src_mesh;
 	ufbx_mesh dst_mesh;
-	ufbx_topo_edge *topo;
+	const ufbx_topo_edge *topo;
 	size_t num_topo;
 
 	ufbx_subdivide_opts opts;
@@ -28886,6 +34219,12 @@ typedef struct {
 	size_t total_weights;
 	size_t max_vertex_weights;
 
+	ufbxi_thread_pool thread_pool;
+
+	// `UFBXI_SUBDIVIDE_MAX_TASKS` tasks, allocated on the first threaded layer,
+	// see `ufbxi_subdivide_begin_tasks()`.
+	ufbxi_subdivide_task *tasks;
+
 } ufbxi_subdivide_context;
 
 static int ufbxi_subdivide_sum_vec2(void *user, void *output, const ufbxi_subdivide_input *inputs, size_t num_inputs)
@@ -29041,84 +34380,65 @@ static ufbx_real ufbxi_edge_crease(const ufbx_mesh *mesh, bool split, const ufbx
 	return 0.0f;
 }
 
-static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufbxi_subdivide_layer_output *output, const ufbxi_subdivide_layer_input *input)
-{
-	ufbx_subdivision_boundary boundary = input->boundary;
-
-	const ufbx_mesh *mesh = &sc->src_mesh;
-	const ufbx_topo_edge *topo = sc->topo;
-	size_t num_topo = sc->num_topo;
-
-	uint32_t *edge_indices = ufbxi_push(&sc->result, uint32_t, mesh->num_indices);
-	ufbxi_check_err(&sc->error, edge_indices);
-
-	size_t num_edge_values = 0;
-	for (uint32_t ix = 0; ix < (uint32_t)mesh->num_indices; ix++) {
-		uint32_t twin = topo[ix].twin;
-		if (twin < ix && !ufbxi_is_edge_split(input, topo, ix)) {
-			edge_indices[ix] = edge_indices[twin];
-		} else {
-			edge_indices[ix] = (uint32_t)num_edge_values++;
-		}
-	}
-
-	size_t stride = input->stride;
-	size_t num_initial_values = (num_edge_values + mesh->num_faces + mesh->num_indices);
-	char *values = (char*)ufbxi_push_size(&sc->tmp, stride, num_initial_values);
-	ufbxi_check_err(&sc->error, values);
+typedef enum {
+	UFBXI_SUBDIVIDE_PASS_FACE_POINTS,
+	UFBXI_SUBDIVIDE_PASS_EDGE_POINTS,
+	UFBXI_SUBDIVIDE_PASS_COUNT_VERTEX_VALUES,
+	UFBXI_SUBDIVIDE_PASS_VERTEX_POINTS,
+} ufbxi_subdivide_pass;
+
+// Shared read-only state of `ufbxi_subdivide_layer()`, each pass writes only to
+// the values and indices of the faces, edges or vertices in its own range.
+typedef struct {
+	const ufbxi_subdivide_layer_input *input;
+	const ufbx_mesh *mesh;
+	const ufbx_topo_edge *topo;
+	size_t num_topo;
 
-	char *face_values = values;
-	char *edge_values = face_values + mesh->num_faces * stride;
-	char *vertex_values = edge_values + num_edge_values * stride;
+	const uint32_t *edge_indices;
+	uint32_t *vertex_indices;
 
-	size_t num_vertex_values = 0;
+	char *face_values;
+	char *edge_values;
+	char *vertex_values;
 
-	uint32_t *vertex_indices = ufbxi_push(&sc->result, uint32_t, mesh->num_indices);
-	ufbxi_check_err(&sc->error, vertex_indices);
+	bool sharp_corners;
+	bool sharp_splits;
+	bool sharp_all;
 
-	size_t min_inputs = ufbxi_max_sz(32, mesh->max_face_triangles + 2);
-	ufbxi_check_err(&sc->error, ufbxi_grow_array(&sc->ator_tmp, &sc->inputs, &sc->inputs_cap, min_inputs));
-	ufbxi_subdivide_input *inputs = sc->inputs;
+	ufbxi_subdivide_pass pass;
+} ufbxi_subdivide_layer_context;
 
-	// Assume initially unique per vertex, remove if not the case
-	output->unique_per_vertex = true;
+struct ufbxi_subdivide_task {
+	const ufbxi_subdivide_layer_context *lc;
+	ufbx_error *error;
+	ufbxi_allocator *ator;
 
-	bool sharp_corners = false;
-	bool sharp_splits = false;
-	bool sharp_all = false;
+	ufbxi_subdivide_input *inputs;
+	size_t inputs_cap;
 
-	switch (boundary) {
-	case UFBX_SUBDIVISION_BOUNDARY_DEFAULT:
-	case UFBX_SUBDIVISION_BOUNDARY_SHARP_NONE:
-	case UFBX_SUBDIVISION_BOUNDARY_LEGACY:
-		// All smooth
-		break;
-	case UFBX_SUBDIVISION_BOUNDARY_SHARP_CORNERS:
-		sharp_corners = true;
-		break;
-	case UFBX_SUBDIVISION_BOUNDARY_SHARP_BOUNDARY:
-		sharp_corners = true;
-		sharp_splits = true;
-		break;
-	case UFBX_SUBDIVISION_BOUNDARY_SHARP_INTERIOR:
-		sharp_all = true;
-		break;
-	default:
-		ufbxi_unreachable("Bad boundary mode");
-	}
+	size_t begin, end;
+	size_t value_offset;
+	size_t num_values;
+	bool unique_per_vertex;
+	bool ok;
 
-	ufbxi_subdivide_sum_fn *sum_fn = input->sum_fn;
-	void *sum_user = input->sum_user;
+	// Private storage for `error` and `ator` when running on the thread pool
+	ufbx_error task_error;
+	ufbxi_allocator task_ator;
+};
 
-	// Mark unused indices as `UFBX_NO_INDEX` so we can patch non-manifold
-	ufbxi_nounroll for (size_t i = 0; i < mesh->num_indices; i++) {
-		vertex_indices[i] = UFBX_NO_INDEX;
-	}
+static ufbxi_noinline int ufbxi_subdivide_face_points(ufbxi_subdivide_task *t)
+{
+	const ufbxi_subdivide_layer_context *lc = t->lc;
+	const ufbxi_subdivide_layer_input *input = lc->input;
+	const ufbx_mesh *mesh = lc->mesh;
+	size_t stride = input->stride;
+	ufbxi_subdivide_input *inputs = t->inputs;
 
-	// Face points
-	for (size_t fi = 0; fi < mesh->num_faces; fi++) {
+	for (size_t fi = t->begin; fi < t->end; fi++) {
 		ufbx_face face = mesh->faces.data[fi];
-		char *dst = face_values + fi * stride;
+		char *dst = lc->face_values + fi * stride;
 
 		ufbx_real weight = 1.0f / (ufbx_real)face.num_indices;
 		for (uint32_t ci = 0; ci < face.num_indices; ci++) {
@@ -29127,18 +34447,30 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 			inputs[ci].weight = weight;
 		}
 
-		ufbxi_check_err(&sc->error, sum_fn(sum_user, dst, inputs, face.num_indices));
+		ufbxi_check_err(t->error, input->sum_fn(input->sum_user, dst, inputs, face.num_indices));
 	}
 
-	// Edge points
-	for (uint32_t ix = 0; ix < mesh->num_indices; ix++) {
-		char *dst = edge_values + edge_indices[ix] * stride;
+	return 1;
+}
+
+static ufbxi_noinline int ufbxi_subdivide_edge_points(ufbxi_subdivide_task *t)
+{
+	const ufbxi_subdivide_layer_context *lc = t->lc;
+	const ufbxi_subdivide_layer_input *input = lc->input;
+	const ufbx_mesh *mesh = lc->mesh;
+	const ufbx_topo_edge *topo = lc->topo;
+	const char *face_values = lc->face_values;
+	size_t stride = input->stride;
+	ufbxi_subdivide_input *inputs = t->inputs;
+
+	for (uint32_t ix = (uint32_t)t->begin; ix < (uint32_t)t->end; ix++) {
+		char *dst = lc->edge_values + lc->edge_indices[ix] * stride;
 
 		uint32_t twin = topo[ix].twin;
 		bool split = ufbxi_is_edge_split(input, topo, ix);
 
 		if (split || (topo[ix].flags & UFBX_TOPO_NON_MANIFOLD) != 0) {
-			output->unique_per_vertex = false;
+			t->unique_per_vertex = false;
 		}
 
 		ufbx_real crease = 0.0f;
@@ -29147,7 +34479,7 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 		} else if (topo[ix].edge != UFBX_NO_INDEX && mesh->edge_crease.data) {
 			crease = mesh->edge_crease.data[topo[ix].edge] * (ufbx_real)10.0;
 		}
-		if (sharp_all) crease = 1.0f;
+		if (lc->sharp_all) crease = 1.0f;
 
 		const char *v0 = (const char*)input->values + input->indices[ix] * stride;
 		const char *v1 = (const char*)input->values + input->indices[topo[ix].next] * stride;
@@ -29166,13 +34498,13 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 			inputs[2].weight = 0.25f;
 			inputs[3].data = f1;
 			inputs[3].weight = 0.25f;
-			ufbxi_check_err(&sc->error, sum_fn(sum_user, dst, inputs, 4));
+			ufbxi_check_err(t->error, input->sum_fn(input->sum_user, dst, inputs, 4));
 		} else if (crease >= 1.0f) {
 			inputs[0].data = v0;
 			inputs[0].weight = 0.5f;
 			inputs[1].data = v1;
 			inputs[1].weight = 0.5f;
-			ufbxi_check_err(&sc->error, sum_fn(sum_user, dst, inputs, 2));
+			ufbxi_check_err(t->error, input->sum_fn(input->sum_user, dst, inputs, 2));
 		} else if (crease < 1.0f) {
 			const char *f0 = face_values + topo[ix].face * stride;
 			const char *f1 = face_values + topo[twin].face * stride;
@@ -29187,33 +34519,106 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 			inputs[2].weight = w1;
 			inputs[3].data = f1;
 			inputs[3].weight = w1;
-			ufbxi_check_err(&sc->error, sum_fn(sum_user, dst, inputs, 4));
+			ufbxi_check_err(t->error, input->sum_fn(input->sum_user, dst, inputs, 4));
 		}
 	}
 
-	// Vertex points
-	for (size_t vi = 0; vi < mesh->num_vertices; vi++) {
+	return 1;
+}
+
+// Find a topological boundary, or if not found a split edge
+static ufbxi_noinline uint32_t ufbxi_subdivide_vertex_start(const ufbxi_subdivide_layer_context *lc, uint32_t original_start)
+{
+	const ufbx_topo_edge *topo = lc->topo;
+	size_t num_topo = lc->num_topo;
+
+	uint32_t start = original_start;
+	for (uint32_t cur = start;;) {
+		uint32_t prev = ufbx_topo_prev_vertex_edge(topo, num_topo, cur);
+		if (prev == UFBX_NO_INDEX) { start = cur; break; } // Topological boundary: Stop and use as start
+		if (ufbxi_is_edge_split(lc->input, topo, prev)) start = cur; // Split edge: Consider as start
+		if (prev == original_start) break; // Loop: Stop, use original start or split if found
+		cur = prev;
+	}
+	return start;
+}
+
+// Count the values `ufbxi_subdivide_vertex_points()` emits for vertex `vi`, this
+// follows the same edges without evaluating anything.
+static ufbxi_noinline size_t ufbxi_subdivide_count_vertex_values(const ufbxi_subdivide_layer_context *lc, size_t vi)
+{
+	const ufbxi_subdivide_layer_input *input = lc->input;
+	const ufbx_topo_edge *topo = lc->topo;
+	size_t num_topo = lc->num_topo;
+
+	uint32_t original_start = lc->mesh->vertex_first_index.data[vi];
+	if (original_start == UFBX_NO_INDEX) return 0;
+
+	uint32_t start = ufbxi_subdivide_vertex_start(lc, original_start);
+	original_start = start;
+
+	size_t num_values = 0;
+	while (start != UFBX_NO_INDEX) {
+		num_values++;
+
+		uint32_t end_edge = topo[topo[start].prev].twin;
+		if (ufbxi_is_edge_split(input, topo, start)) {
+			start = ufbx_topo_next_vertex_edge(topo, num_topo, start);
+		} else {
+			uint32_t cur = start;
+			for (;;) {
+				cur = ufbx_topo_next_vertex_edge(topo, num_topo, cur);
+				if (cur == UFBX_NO_INDEX) {
+					start = UFBX_NO_INDEX;
+					break;
+				}
+
+				bool split = ufbxi_is_edge_split(input, topo, cur);
+				if (cur == end_edge && !split) {
+					start = UFBX_NO_INDEX;
+					break;
+				}
+				if (split) {
+					start = ufbx_topo_next_vertex_edge(topo, num_topo, cur);
+					break;
+				}
+			}
+		}
+
+		if (start == original_start) start = UFBX_NO_INDEX;
+	}
+
+	return num_values;
+}
+
+static ufbxi_noinline int ufbxi_subdivide_vertex_points(ufbxi_subdivide_task *t)
+{
+	const ufbxi_subdivide_layer_context *lc = t->lc;
+	const ufbxi_subdivide_layer_input *input = lc->input;
+	const ufbx_mesh *mesh = lc->mesh;
+	const ufbx_topo_edge *topo = lc->topo;
+	size_t num_topo = lc->num_topo;
+	const char *face_values = lc->face_values;
+	uint32_t *vertex_indices = lc->vertex_indices;
+	size_t stride = input->stride;
+	ufbxi_subdivide_input *inputs = t->inputs;
+
+	size_t num_vertex_values = t->value_offset;
+
+	for (size_t vi = t->begin; vi < t->end; vi++) {
 		uint32_t original_start = mesh->vertex_first_index.data[vi];
 		if (original_start == UFBX_NO_INDEX) continue;
 
-		// Find a topological boundary, or if not found a split edge
-		uint32_t start = original_start;
-		for (uint32_t cur = start;;) {
-			uint32_t prev = ufbx_topo_prev_vertex_edge(topo, num_topo, cur);
-			if (prev == UFBX_NO_INDEX) { start = cur; break; } // Topological boundary: Stop and use as start
-			if (ufbxi_is_edge_split(input, topo, prev)) start = cur; // Split edge: Consider as start
-			if (prev == original_start) break; // Loop: Stop, use original start or split if found
-			cur = prev;
-		}
+		uint32_t start = ufbxi_subdivide_vertex_start(lc, original_start);
 
 		original_start = start;
 		while (start != UFBX_NO_INDEX) {
 			if (start != original_start) {
-				output->unique_per_vertex = false;
+				t->unique_per_vertex = false;
 			}
 
 			uint32_t value_index = (uint32_t)num_vertex_values++;
-			char *dst = vertex_values + value_index * stride;
+			char *dst = lc->vertex_values + value_index * stride;
 
 			// We need to compute the average crease value and keep track of
 			// two creased edges, if there's more we use the corner rule that
@@ -29270,7 +34675,7 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 				on_boundary = true;
 			}
 
-			ufbxi_check_err(&sc->error, vertex_indices[start] == UFBX_NO_INDEX);
+			ufbxi_check_err(t->error, vertex_indices[start] == UFBX_NO_INDEX);
 			vertex_indices[start] = value_index;
 
 			if (start_split) {
@@ -29293,14 +34698,15 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 					}
 
 					non_manifold |= (topo[cur].flags & UFBX_TOPO_NON_MANIFOLD) != 0;
-					ufbxi_check_err(&sc->error, vertex_indices[cur] == UFBX_NO_INDEX);
+					ufbxi_check_err(t->error, vertex_indices[cur] == UFBX_NO_INDEX);
 					vertex_indices[cur] = value_index;
 
 					bool split = ufbxi_is_edge_split(input, topo, cur);
 
 					// Looped: Add the face from the other side still if not split
 					if (cur == end_edge && !split) {
-						ufbxi_check_err(&sc->error, ufbxi_grow_array(&sc->ator_tmp, &sc->inputs, &sc->inputs_cap, num_inputs + 1));
+						ufbxi_check_err(t->error, ufbxi_grow_array(t->ator, &t->inputs, &t->inputs_cap, num_inputs + 1));
+						inputs = t->inputs;
 						const char *f0 = face_values + topo[cur].face * stride;
 						inputs[num_inputs].data = f0;
 						start = UFBX_NO_INDEX;
@@ -29319,8 +34725,8 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 
 					// Add the new edge and face to the sum
 					{
-						ufbxi_check_err(&sc->error, ufbxi_grow_array(&sc->ator_tmp, &sc->inputs, &sc->inputs_cap, num_inputs + 2));
-						inputs = sc->inputs;
+						ufbxi_check_err(t->error, ufbxi_grow_array(t->ator, &t->inputs, &t->inputs_cap, num_inputs + 2));
+						inputs = t->inputs;
 
 						const char *e0 = (char*)input->values + input->indices[topo[cur].next] * stride;
 						const char *f0 = face_values + topo[cur].face * stride;
@@ -29348,9 +34754,9 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 
 			// Select the right subdivision mask depending on valence and crease
 			if (num_crease > 2
-				|| (sharp_corners && valence == 2 && (num_split > 0 || on_boundary))
-				|| (sharp_splits && (num_split > 0 || on_boundary))
-				|| sharp_all
+				|| (lc->sharp_corners && valence == 2 && (num_split > 0 || on_boundary))
+				|| (lc->sharp_splits && (num_split > 0 || on_boundary))
+				|| lc->sharp_all
 				|| non_manifold) {
 				// Corner: Copy as-is
 				inputs[0].data = v0;
@@ -29404,10 +34810,254 @@ static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufb
 			}
 #endif
 
-			ufbxi_check_err(&sc->error, sum_fn(sum_user, dst, inputs, num_inputs));
+			ufbxi_check_err(t->error, input->sum_fn(input->sum_user, dst, inputs, num_inputs));
+		}
+	}
+
+	t->num_values = num_vertex_values - t->value_offset;
+
+	return 1;
+}
+
+static ufbxi_noinline int ufbxi_subdivide_run_task(ufbxi_subdivide_task *t)
+{
+	switch (t->lc->pass) {
+	case UFBXI_SUBDIVIDE_PASS_FACE_POINTS:
+		return ufbxi_subdivide_face_points(t);
+	case UFBXI_SUBDIVIDE_PASS_EDGE_POINTS:
+		return ufbxi_subdivide_edge_points(t);
+	case UFBXI_SUBDIVIDE_PASS_COUNT_VERTEX_VALUES:
+		t->num_values = 0;
+		for (size_t vi = t->begin; vi < t->end; vi++) {
+			t->num_values += ufbxi_subdivide_count_vertex_values(t->lc, vi);
+		}
+		return 1;
+	case UFBXI_SUBDIVIDE_PASS_VERTEX_POINTS:
+		return ufbxi_subdivide_vertex_points(t);
+	default:
+		ufbxi_unreachable("Bad subdivide pass");
+		return 0;
+	}
+}
+
+static bool ufbxi_subdivide_task_fn(ufbxi_task *task)
+{
+	ufbxi_subdivide_task *t = (ufbxi_subdivide_task*)task->data;
+	t->ok = ufbxi_subdivide_run_task(t) != 0;
+	return true;
+}
+
+// Run `lc->pass` over `count` items split into contiguous ranges of `sc->tasks[]`
+// on the thread pool. The ranges only depend on `count` and are stored in order.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_run_tasks(ufbxi_subdivide_context *sc, ufbxi_subdivide_layer_context *lc,
+	ufbxi_subdivide_pass pass, size_t count, size_t *p_num_tasks)
+{
+	lc->pass = pass;
+
+	size_t num_tasks = ufbxi_min_sz(UFBXI_SUBDIVIDE_MAX_TASKS, (count + UFBXI_SUBDIVIDE_TASK_MIN_ITEMS - 1) / UFBXI_SUBDIVIDE_TASK_MIN_ITEMS);
+	size_t items_per_task = num_tasks > 0 ? (count + num_tasks - 1) / num_tasks : 0;
+	*p_num_tasks = num_tasks;
+
+	for (size_t i = 0; i < num_tasks; i++) {
+		ufbxi_subdivide_task *t = &sc->tasks[i];
+		t->lc = lc;
+		t->begin = ufbxi_min_sz(i * items_per_task, count);
+		t->end = ufbxi_min_sz(t->begin + items_per_task, count);
+		t->unique_per_vertex = true;
+		t->ok = false;
+		ufbxi_check_err(&sc->error, ufbxi_thread_pool_dispatch(&sc->thread_pool, &sc->error, &ufbxi_subdivide_task_fn, t));
+	}
+	ufbxi_check_err(&sc->error, ufbxi_thread_pool_dispatch_wait(&sc->thread_pool, &sc->error));
+
+	for (size_t i = 0; i < num_tasks; i++) {
+		if (!sc->tasks[i].ok) {
+			sc->error = sc->tasks[i].task_error;
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+// Prepare `sc->tasks[]` for threaded subdivision of a layer. Tasks get a share of the remaining
+// temporary memory limit, which is returned by `ufbxi_subdivide_end_tasks()`.
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_begin_tasks(ufbxi_subdivide_context *sc, size_t min_inputs)
+{
+	if (!sc->tasks) {
+		sc->tasks = ufbxi_alloc(&sc->ator_tmp, ufbxi_subdivide_task, UFBXI_SUBDIVIDE_MAX_TASKS);
+		ufbxi_check_err(&sc->error, sc->tasks);
+		memset(sc->tasks, 0, UFBXI_SUBDIVIDE_MAX_TASKS * sizeof(ufbxi_subdivide_task));
+	}
+
+	for (size_t i = 0; i < UFBXI_SUBDIVIDE_MAX_TASKS; i++) {
+		ufbxi_subdivide_task *t = &sc->tasks[i];
+		ufbxi_init_task_ator(&t->task_error, &t->task_ator, &sc->ator_tmp, UFBXI_SUBDIVIDE_MAX_TASKS, "temp");
+		t->error = &t->task_error;
+		t->ator = &t->task_ator;
+		ufbxi_check_err(&sc->error, ufbxi_grow_array(t->ator, &t->inputs, &t->inputs_cap, min_inputs));
+	}
+
+	return 1;
+}
+
+// Must be called only after all the tasks have finished.
+static ufbxi_noinline void ufbxi_subdivide_end_tasks(ufbxi_subdivide_context *sc)
+{
+	if (!sc->tasks) return;
+	for (size_t i = 0; i < UFBXI_SUBDIVIDE_MAX_TASKS; i++) {
+		ufbxi_subdivide_task *t = &sc->tasks[i];
+		if (!t->ator) continue;
+		ufbxi_free(t->ator, ufbxi_subdivide_input, t->inputs, t->inputs_cap);
+		ufbxi_free_task_ator(&sc->ator_tmp, t->ator);
+		t->inputs = NULL;
+		t->inputs_cap = 0;
+		t->ator = NULL;
+	}
+}
+
+static ufbxi_noinline int ufbxi_subdivide_layer(ufbxi_subdivide_context *sc, ufbxi_subdivide_layer_output *output, const ufbxi_subdivide_layer_input *input)
+{
+	ufbx_subdivision_boundary boundary = input->boundary;
+
+	const ufbx_mesh *mesh = &sc->src_mesh;
+	const ufbx_topo_edge *topo = sc->topo;
+
+	uint32_t *edge_indices = ufbxi_push(&sc->result, uint32_t, mesh->num_indices);
+	ufbxi_check_err(&sc->error, edge_indices);
+
+	size_t num_edge_values = 0;
+	for (uint32_t ix = 0; ix < (uint32_t)mesh->num_indices; ix++) {
+		uint32_t twin = topo[ix].twin;
+		if (twin < ix && !ufbxi_is_edge_split(input, topo, ix)) {
+			edge_indices[ix] = edge_indices[twin];
+		} else {
+			edge_indices[ix] = (uint32_t)num_edge_values++;
+		}
+	}
+
+	size_t stride = input->stride;
+	size_t num_initial_values = (num_edge_values + mesh->num_faces + mesh->num_indices);
+	char *values = (char*)ufbxi_push_size(&sc->tmp, stride, num_initial_values);
+	ufbxi_check_err(&sc->error, values);
+
+	char *face_values = values;
+	char *edge_values = face_values + mesh->num_faces * stride;
+	char *vertex_values = edge_values + num_edge_values * stride;
+
+	size_t num_vertex_values = 0;
+
+	uint32_t *vertex_indices = ufbxi_push(&sc->result, uint32_t, mesh->num_indices);
+	ufbxi_check_err(&sc->error, vertex_indices);
+
+	size_t min_inputs = ufbxi_max_sz(32, mesh->max_face_triangles + 2);
+	ufbxi_check_err(&sc->error, ufbxi_grow_array(&sc->ator_tmp, &sc->inputs, &sc->inputs_cap, min_inputs));
+
+	// Assume initially unique per vertex, remove if not the case
+	output->unique_per_vertex = true;
+
+	ufbxi_subdivide_layer_context lc; // ufbxi_uninit
+	lc.input = input;
+	lc.mesh = mesh;
+	lc.topo = topo;
+	lc.num_topo = sc->num_topo;
+	lc.edge_indices = edge_indices;
+	lc.vertex_indices = vertex_indices;
+	lc.face_values = face_values;
+	lc.edge_values = edge_values;
+	lc.vertex_values = vertex_values;
+	lc.sharp_corners = false;
+	lc.sharp_splits = false;
+	lc.sharp_all = false;
+	lc.pass = UFBXI_SUBDIVIDE_PASS_FACE_POINTS;
+
+	switch (boundary) {
+	case UFBX_SUBDIVISION_BOUNDARY_DEFAULT:
+	case UFBX_SUBDIVISION_BOUNDARY_SHARP_NONE:
+	case UFBX_SUBDIVISION_BOUNDARY_LEGACY:
+		// All smooth
+		break;
+	case UFBX_SUBDIVISION_BOUNDARY_SHARP_CORNERS:
+		lc.sharp_corners = true;
+		break;
+	case UFBX_SUBDIVISION_BOUNDARY_SHARP_BOUNDARY:
+		lc.sharp_corners = true;
+		lc.sharp_splits = true;
+		break;
+	case UFBX_SUBDIVISION_BOUNDARY_SHARP_INTERIOR:
+		lc.sharp_all = true;
+		break;
+	default:
+		ufbxi_unreachable("Bad boundary mode");
+	}
+
+	// Mark unused indices as `UFBX_NO_INDEX` so we can patch non-manifold
+	ufbxi_nounroll for (size_t i = 0; i < mesh->num_indices; i++) {
+		vertex_indices[i] = UFBX_NO_INDEX;
+	}
+
+	if (sc->thread_pool.enabled && input->thread_safe_sum && mesh->num_indices >= UFBXI_MIN_THREADED_SUBDIVIDE_INDICES) {
+		// Every output point only reads the source values and the face points, so faces,
+		// edges and vertices can be split into ranges. Vertices may emit multiple values
+		// so they are counted first to find the value offset of each range.
+		ufbxi_check_err(&sc->error, ufbxi_subdivide_begin_tasks(sc, min_inputs));
+
+		size_t num_tasks = 0;
+		ufbxi_check_err(&sc->error, ufbxi_subdivide_run_tasks(sc, &lc, UFBXI_SUBDIVIDE_PASS_FACE_POINTS, mesh->num_faces, &num_tasks));
+		ufbxi_check_err(&sc->error, ufbxi_subdivide_run_tasks(sc, &lc, UFBXI_SUBDIVIDE_PASS_EDGE_POINTS, mesh->num_indices, &num_tasks));
+		for (size_t i = 0; i < num_tasks; i++) {
+			output->unique_per_vertex &= sc->tasks[i].unique_per_vertex;
+		}
+
+		ufbxi_check_err(&sc->error, ufbxi_subdivide_run_tasks(sc, &lc, UFBXI_SUBDIVIDE_PASS_COUNT_VERTEX_VALUES, mesh->num_vertices, &num_tasks));
+		for (size_t i = 0; i < num_tasks; i++) {
+			sc->tasks[i].value_offset = num_vertex_values;
+			num_vertex_values += sc->tasks[i].num_values;
+		}
+
+		ufbxi_check_err(&sc->error, ufbxi_subdivide_run_tasks(sc, &lc, UFBXI_SUBDIVIDE_PASS_VERTEX_POINTS, mesh->num_vertices, &num_tasks));
+		for (size_t i = 0; i < num_tasks; i++) {
+			ufbxi_subdivide_task *t = &sc->tasks[i];
+			size_t end_offset = i + 1 < num_tasks ? sc->tasks[i + 1].value_offset : num_vertex_values;
+			ufbxi_check_err(&sc->error, t->value_offset + t->num_values == end_offset);
+			output->unique_per_vertex &= t->unique_per_vertex;
 		}
+
+		ufbxi_subdivide_end_tasks(sc);
+	} else {
+		ufbxi_subdivide_task t; // ufbxi_uninit
+		t.lc = &lc;
+		t.error = &sc->error;
+		t.ator = &sc->ator_tmp;
+		t.inputs = sc->inputs;
+		t.inputs_cap = sc->inputs_cap;
+		t.value_offset = 0;
+		t.num_values = 0;
+		t.unique_per_vertex = true;
+
+		t.begin = 0;
+		t.end = mesh->num_faces;
+		int ok = ufbxi_subdivide_face_points(&t);
+		if (ok) {
+			t.end = mesh->num_indices;
+			ok = ufbxi_subdivide_edge_points(&t);
+		}
+		if (ok) {
+			t.end = mesh->num_vertices;
+			ok = ufbxi_subdivide_vertex_points(&t);
+		}
+
+		sc->inputs = t.inputs;
+		sc->inputs_cap = t.inputs_cap;
+		ufbxi_check_err(&sc->error, ok);
+
+		num_vertex_values = t.num_values;
+		output->unique_per_vertex &= t.unique_per_vertex;
 	}
 
+	ufbxi_subdivide_input *inputs = sc->inputs;
+	ufbxi_subdivide_sum_fn *sum_fn = input->sum_fn;
+	void *sum_user = input->sum_user;
+
 	// Copy non-manifold vertex values as-is
 	for (size_t old_ix = 0; old_ix < mesh->num_indices; old_ix++) {
 		uint32_t ix = vertex_indices[old_ix];
@@ -29476,6 +35126,7 @@ static ufbxi_noinline int ufbxi_subdivide_attrib(ufbxi_subdivide_context *sc, uf
 	input.boundary = boundary;
 	input.check_split_data = check_split_data;
 	input.ignore_indices = false;
+	input.thread_safe_sum = true;
 
 	ufbxi_subdivide_layer_output output; // ufbxi_uninit
 	ufbxi_check_err(&sc->error, ufbxi_subdivide_layer(sc, &output, &input));
@@ -29559,6 +35210,7 @@ static ufbxi_noinline int ufbxi_subdivide_weights(ufbxi_subdivide_context *sc, u
 	input.boundary = sc->opts.boundary;
 	input.check_split_data = false;
 	input.ignore_indices = true;
+	input.thread_safe_sum = false;
 
 	sc->total_weights = 0;
 
@@ -29570,7 +35222,7 @@ static ufbxi_noinline int ufbxi_subdivide_weights(ufbxi_subdivide_context *sc, u
 
 	ufbx_subdivision_weight_range *dst_ranges = ufbxi_push(&sc->result, ufbx_subdivision_weight_range, num_vertices);
 	ufbx_subdivision_weight *dst_weights = ufbxi_push(&sc->result, ufbx_subdivision_weight, sc->total_weights);
-	ufbxi_check_err(&sc->error, ranges && weights);
+	ufbxi_check_err(&sc->error, dst_ranges && dst_weights);
 
 	ufbxi_subdivision_vertex_weights *src_weights = (ufbxi_subdivision_vertex_weights*)output.values;
 
@@ -29635,10 +35287,17 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_mesh_level(ufbxi_subdi
 
 	*result = *mesh;
 
-	ufbx_topo_edge *topo = ufbxi_push(&sc->tmp, ufbx_topo_edge, mesh->num_indices);
-	ufbxi_check_err(&sc->error, topo);
-	ufbx_compute_topology(mesh, topo, mesh->num_indices);
-	sc->topo = topo;
+	// The topology is not valid for the subdivided mesh
+	result->topology = NULL;
+
+	if (mesh->topology) {
+		sc->topo = mesh->topology->edges.data;
+	} else {
+		ufbx_topo_edge *topo = ufbxi_push(&sc->tmp, ufbx_topo_edge, mesh->num_indices);
+		ufbxi_check_err(&sc->error, topo);
+		ufbx_compute_topology(mesh, topo, mesh->num_indices);
+		sc->topo = topo;
+	}
 	sc->num_topo = mesh->num_indices;
 
 	ufbxi_check_err(&sc->error, ufbxi_subdivide_attrib(sc, (ufbx_vertex_attrib*)&result->vertex_position, sc->opts.boundary, false));
@@ -29762,6 +35421,10 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_mesh_level(ufbxi_subdi
 	result->num_indices = mesh->num_indices * 4;
 	result->num_faces = mesh->num_indices;
 	result->num_triangles = mesh->num_indices * 2;
+	result->max_face_triangles = 2;
+	result->num_empty_faces = 0;
+	result->num_point_faces = 0;
+	result->num_line_faces = 0;
 
 	result->vertex_indices.data = result->vertex_position.indices.data;
 	result->vertex_indices.count = result->num_indices;
@@ -29802,7 +35465,7 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_mesh_level(ufbxi_subdi
 		size_t di = 0;
 		for (size_t i = 0; i < mesh->num_edges; i++) {
 			ufbx_edge edge = mesh->edges.data[i];
-			uint32_t face_ix = topo[edge.a].face;
+			uint32_t face_ix = sc->topo[edge.a].face;
 			ufbx_face face = mesh->faces.data[face_ix];
 			uint32_t offset = edge.a - face.index_begin;
 			uint32_t next = (offset + 1) % (uint32_t)face.num_indices;
@@ -29944,6 +35607,8 @@ ufbxi_nodiscard static ufbxi_noinline int ufbxi_subdivide_mesh_imp(ufbxi_subdivi
 	sc->source.ator = &sc->ator_tmp;
 	sc->tmp.ator = &sc->ator_tmp;
 
+	ufbxi_check_err(&sc->error, ufbxi_thread_pool_init(&sc->thread_pool, &sc->error, &sc->ator_tmp, &sc->opts.thread_opts));
+
 	for (size_t i = 1; i < level; i++) {
 		sc->result.ator = &sc->ator_tmp;
 
@@ -30045,6 +35710,12 @@ ufbxi_noinline static ufbx_mesh *ufbxi_subdivide_mesh(const ufbx_mesh *mesh, siz
 
 	int ok = ufbxi_subdivide_mesh_imp(&sc, level);
 
+	// Wait for any tasks left running on failure before freeing them
+	ufbxi_thread_pool_free(&sc.thread_pool);
+	if (sc.tasks) {
+		ufbxi_subdivide_end_tasks(&sc);
+		ufbxi_free(&sc.ator_tmp, ufbxi_subdivide_task, sc.tasks, UFBXI_SUBDIVIDE_MAX_TASKS);
+	}
 	ufbxi_free(&sc.ator_tmp, ufbxi_subdivide_input, sc.inputs, sc.inputs_cap);
 	ufbxi_buf_free(&sc.tmp);
 	ufbxi_buf_free(&sc.source);
@@ -30080,6 +35751,183 @@ ufbxi_noinline static ufbx_mesh *ufbxi_subdivide_mesh(const ufbx_mesh *mesh, siz
 
 #endif
 
+// -- Subdivision stencils
+
+typedef struct {
+	ufbxi_refcount refcount;
+	ufbx_subdivision_stencils stencils;
+	uint32_t magic;
+} ufbxi_subdivision_stencils_imp;
+
+typedef struct {
+	ufbx_error error;
+
+	const ufbx_mesh *mesh;
+	size_t level;
+	ufbx_subdivision_stencils_opts opts;
+
+	ufbxi_allocator ator_result;
+	ufbxi_buf result;
+
+	ufbx_mesh *sub_mesh;
+	ufbxi_subdivision_stencils_imp *imp;
+} ufbxi_subdivision_stencils_context;
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_create_subdivision_stencils_imp(ufbxi_subdivision_stencils_context *sc)
+{
+	const ufbx_mesh *mesh = sc->mesh;
+
+	ufbxi_init_ator(&sc->error, &sc->ator_result, &sc->opts.result_allocator, "result");
+	sc->result.unordered = true;
+	sc->result.ator = &sc->ator_result;
+
+	sc->imp = ufbxi_push_zero(&sc->result, ufbxi_subdivision_stencils_imp, 1);
+	ufbxi_check_err(&sc->error, sc->imp);
+	ufbxi_subdivision_stencils_imp *imp = sc->imp;
+	ufbx_subdivision_stencils *stencils = &imp->stencils;
+
+	stencils->num_source_vertices = mesh->num_vertices;
+
+	if (sc->level == 0) {
+		size_t num_vertices = mesh->num_vertices;
+		stencils->num_vertices = num_vertices;
+		stencils->offsets.count = num_vertices + 1;
+		stencils->indices.count = num_vertices;
+		stencils->weights.count = num_vertices;
+		stencils->offsets.data = ufbxi_push(&sc->result, uint32_t, num_vertices + 1);
+		stencils->indices.data = ufbxi_push(&sc->result, uint32_t, num_vertices);
+		stencils->weights.data = ufbxi_push(&sc->result, ufbx_real, num_vertices);
+		ufbxi_check_err(&sc->error, stencils->offsets.data && stencils->indices.data && stencils->weights.data);
+
+		for (size_t i = 0; i < num_vertices; i++) {
+			stencils->offsets.data[i] = (uint32_t)i;
+			stencils->indices.data[i] = (uint32_t)i;
+			stencils->weights.data[i] = 1.0f;
+		}
+		stencils->offsets.data[num_vertices] = (uint32_t)num_vertices;
+
+		stencils->vertex_indices.count = mesh->vertex_indices.count;
+		stencils->vertex_indices.data = ufbxi_push_copy(&sc->result, uint32_t, mesh->vertex_indices.count, mesh->vertex_indices.data);
+		ufbxi_check_err(&sc->error, stencils->vertex_indices.data);
+	} else {
+		// Subdivide the topology once and gather the weights the mesh was subdivided with.
+		// The subdivided mesh itself is temporary so it's allocated using the temporary allocator.
+		ufbx_subdivide_opts sub_opts = { 0 };
+		sub_opts.temp_allocator = sc->opts.temp_allocator;
+		sub_opts.result_allocator = sc->opts.temp_allocator;
+		sub_opts.boundary = sc->opts.boundary;
+		sub_opts.ignore_normals = true;
+		sub_opts.evaluate_source_vertices = true;
+		sub_opts.max_source_vertices = sc->opts.max_source_vertices;
+
+		ufbx_error sub_error; // ufbxi_uninit
+		sc->sub_mesh = ufbxi_subdivide_mesh(mesh, sc->level, &sub_opts, &sub_error);
+		if (!sc->sub_mesh) {
+			sc->error = sub_error;
+			return 0;
+		}
+
+		const ufbx_mesh *sub_mesh = sc->sub_mesh;
+		const ufbx_subdivision_result *sub_result = sub_mesh->subdivision_result;
+		ufbxi_check_err(&sc->error, sub_result && sub_result->source_vertex_ranges.count == sub_mesh->num_vertices);
+
+		size_t num_vertices = sub_mesh->num_vertices;
+		size_t num_weights = sub_result->source_vertex_weights.count;
+		ufbxi_check_err_msg(&sc->error, num_weights <= UINT32_MAX, "Too many stencil weights");
+
+		stencils->num_vertices = num_vertices;
+		stencils->offsets.count = num_vertices + 1;
+		stencils->offsets.data = ufbxi_push(&sc->result, uint32_t, num_vertices + 1);
+		stencils->indices.data = ufbxi_push(&sc->result, uint32_t, num_weights);
+		stencils->weights.data = ufbxi_push(&sc->result, ufbx_real, num_weights);
+		ufbxi_check_err(&sc->error, stencils->offsets.data && stencils->indices.data && stencils->weights.data);
+
+		uint32_t offset = 0;
+		for (size_t i = 0; i < num_vertices; i++) {
+			ufbx_subdivision_weight_range range = sub_result->source_vertex_ranges.data[i];
+			ufbxi_check_err(&sc->error, range.weight_begin <= num_weights && range.num_weights <= num_weights - range.weight_begin);
+			ufbxi_check_err(&sc->error, range.num_weights <= num_weights - offset);
+
+			stencils->offsets.data[i] = offset;
+			const ufbx_subdivision_weight *weights = sub_result->source_vertex_weights.data + range.weight_begin;
+			for (size_t j = 0; j < range.num_weights; j++) {
+				ufbxi_check_err(&sc->error, weights[j].index < mesh->num_vertices);
+				stencils->indices.data[offset + j] = weights[j].index;
+				stencils->weights.data[offset + j] = weights[j].weight;
+			}
+			offset += range.num_weights;
+		}
+		stencils->offsets.data[num_vertices] = offset;
+		stencils->indices.count = offset;
+		stencils->weights.count = offset;
+
+		stencils->vertex_indices.count = sub_mesh->vertex_indices.count;
+		stencils->vertex_indices.data = ufbxi_push_copy(&sc->result, uint32_t, sub_mesh->vertex_indices.count, sub_mesh->vertex_indices.data);
+		ufbxi_check_err(&sc->error, stencils->vertex_indices.data);
+	}
+
+	ufbxi_init_ref(&imp->refcount, UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC, NULL);
+
+	imp->magic = UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC;
+	imp->refcount.ator = sc->ator_result;
+	imp->refcount.buf = sc->result;
+
+	return 1;
+}
+
+// Accumulate the weighted source positions of `dst[begin..end]`, the SIMD paths
+// perform the same operations in the same order as the scalar fallback.
+static ufbxi_noinline void ufbxi_apply_subdivision_stencils_imp(const ufbx_subdivision_stencils *stencils, const ufbx_vec3 *src, ufbx_vec3 *dst, size_t begin, size_t end)
+{
+	const uint32_t *offsets = stencils->offsets.data;
+	const uint32_t *indices = stencils->indices.data;
+	const ufbx_real *weights = stencils->weights.data;
+
+#if UFBXI_HAS_SSE
+	if (sizeof(ufbx_real) == sizeof(double)) {
+		for (size_t i = begin; i < end; i++) {
+			__m128d xy = _mm_setzero_pd();
+			__m128d z = _mm_setzero_pd();
+			for (uint32_t j = offsets[i], j_end = offsets[i + 1]; j < j_end; j++) {
+				const double *s = (const double*)(src + indices[j]);
+				__m128d w = _mm_set1_pd((double)weights[j]);
+				xy = _mm_add_pd(xy, _mm_mul_pd(_mm_loadu_pd(s), w));
+				z = _mm_add_sd(z, _mm_mul_sd(_mm_load_sd(s + 2), w));
+			}
+			double *d = (double*)(dst + i);
+			_mm_storeu_pd(d, xy);
+			_mm_store_sd(d + 2, z);
+		}
+		return;
+	} else if (sizeof(ufbx_real) == sizeof(float)) {
+		for (size_t i = begin; i < end; i++) {
+			__m128 xyz = _mm_setzero_ps();
+			for (uint32_t j = offsets[i], j_end = offsets[i + 1]; j < j_end; j++) {
+				const float *s = (const float*)(src + indices[j]);
+				__m128 v = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)s)), _mm_load_ss(s + 2));
+				xyz = _mm_add_ps(xyz, _mm_mul_ps(v, _mm_set1_ps((float)weights[j])));
+			}
+			float *d = (float*)(dst + i);
+			_mm_store_sd((double*)d, _mm_castps_pd(xyz));
+			_mm_store_ss(d + 2, _mm_movehl_ps(xyz, xyz));
+		}
+		return;
+	}
+#endif
+
+	for (size_t i = begin; i < end; i++) {
+		ufbx_vec3 sum = { 0.0f, 0.0f, 0.0f };
+		for (uint32_t j = offsets[i], j_end = offsets[i + 1]; j < j_end; j++) {
+			ufbx_vec3 s = src[indices[j]];
+			ufbx_real w = weights[j];
+			sum.x += s.x * w;
+			sum.y += s.y * w;
+			sum.z += s.z * w;
+		}
+		dst[i] = sum;
+	}
+}
+
 // -- Utility
 
 #if UFBXI_FEATURE_INDEX_GENERATION
@@ -30226,6 +36074,260 @@ static ufbxi_noinline size_t ufbxi_generate_indices(const ufbx_vertex_stream *us
 	return result_vertices;
 }
 
+// Multithreaded index generation: Vertices are hashed in chunks and bucketed
+// into partitions by the top bits of the hash. Each partition is deduplicated
+// independently and finally unique vertices are numbered in order of first
+// occurrence, resulting in the same output as `ufbxi_generate_indices()`.
+
+#define UFBXI_INDEX_PARTITION_COUNT (1u << UFBXI_INDEX_PARTITION_BITS)
+
+typedef struct ufbxi_index_task ufbxi_index_task;
+
+typedef struct {
+	ufbx_error *error;
+	ufbxi_allocator ator;
+	ufbxi_buf buf;
+	ufbxi_thread_pool thread_pool;
+
+	const ufbx_vertex_stream *streams;
+	size_t num_streams;
+	size_t num_indices;
+	size_t num_chunks;
+	size_t num_unique;
+
+	uint32_t *indices;
+	uint32_t *hashes;
+	uint32_t *order;
+	uint32_t *chunk_offsets;
+	uint32_t *partition_offsets;
+	size_t *table_offsets;
+	uint32_t *tables;
+	ufbxi_index_task *tasks;
+} ufbxi_index_context;
+
+struct ufbxi_index_task {
+	ufbxi_index_context *ic;
+	size_t index;
+};
+
+static ufbxi_forceinline uint32_t ufbxi_index_vertex_hash(const ufbx_vertex_stream *streams, size_t num_streams, size_t index)
+{
+	uint32_t hash = 0;
+	for (size_t si = 0; si < num_streams; si++) {
+		size_t size = streams[si].vertex_size;
+		hash = ufbxi_hash32(hash ^ ufbxi_hash_string((const char*)streams[si].data + index * size, size));
+	}
+	return hash;
+}
+
+static ufbxi_forceinline bool ufbxi_index_vertex_equal(const ufbx_vertex_stream *streams, size_t num_streams, size_t a, size_t b)
+{
+	for (size_t si = 0; si < num_streams; si++) {
+		size_t size = streams[si].vertex_size;
+		const char *data = (const char*)streams[si].data;
+		if (memcmp(data + a * size, data + b * size, size) != 0) return false;
+	}
+	return true;
+}
+
+static bool ufbxi_index_hash_task_fn(ufbxi_task *task)
+{
+	ufbxi_index_task *t = (ufbxi_index_task*)task->data;
+	ufbxi_index_context *ic = t->ic;
+	size_t begin = t->index * UFBXI_INDEX_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_INDEX_CHUNK_SIZE, ic->num_indices);
+	uint32_t *counts = ic->chunk_offsets + t->index * UFBXI_INDEX_PARTITION_COUNT;
+
+	for (size_t i = begin; i < end; i++) {
+		uint32_t hash = ufbxi_index_vertex_hash(ic->streams, ic->num_streams, i);
+		ic->hashes[i] = hash;
+		counts[hash >> (32u - UFBXI_INDEX_PARTITION_BITS)]++;
+	}
+
+	return true;
+}
+
+static bool ufbxi_index_scatter_task_fn(ufbxi_task *task)
+{
+	ufbxi_index_task *t = (ufbxi_index_task*)task->data;
+	ufbxi_index_context *ic = t->ic;
+	size_t begin = t->index * UFBXI_INDEX_CHUNK_SIZE;
+	size_t end = ufbxi_min_sz(begin + UFBXI_INDEX_CHUNK_SIZE, ic->num_indices);
+	uint32_t *offsets = ic->chunk_offsets + t->index * UFBXI_INDEX_PARTITION_COUNT;
+
+	for (size_t i = begin; i < end; i++) {
+		uint32_t partition = ic->hashes[i] >> (32u - UFBXI_INDEX_PARTITION_BITS);
+		ic->order[offsets[partition]++] = (uint32_t)i;
+	}
+
+	return true;
+}
+
+static bool ufbxi_index_dedup_task_fn(ufbxi_task *task)
+{
+	ufbxi_index_task *t = (ufbxi_index_task*)task->data;
+	ufbxi_index_context *ic = t->ic;
+	size_t begin = ic->partition_offsets[t->index];
+	size_t end = ic->partition_offsets[t->index + 1];
+	uint32_t *table = ic->tables + ic->table_offsets[t->index];
+	size_t mask = ic->table_offsets[t->index + 1] - ic->table_offsets[t->index] - 1;
+
+	// `order` is sorted within a partition so the first matching vertex
+	// found is always the earliest one. Table entries are `index + 1`.
+	for (size_t i = begin; i < end; i++) {
+		uint32_t index = ic->order[i];
+		uint32_t hash = ic->hashes[index];
+		size_t slot = hash & mask;
+		for (;;) {
+			uint32_t entry = table[slot];
+			if (entry == 0) {
+				table[slot] = index + 1;
+				ic->indices[index] = index;
+				break;
+			}
+			uint32_t other = entry - 1;
+			if (ic->hashes[other] == hash && ufbxi_index_vertex_equal(ic->streams, ic->num_streams, other, index)) {
+				ic->indices[index] = other;
+				break;
+			}
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	return true;
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_generate_indices_threaded_imp(ufbxi_index_context *ic)
+{
+	ufbx_error *error = ic->error;
+	size_t num_indices = ic->num_indices;
+
+	size_t vertex_size = 0;
+	for (size_t i = 0; i < ic->num_streams; i++) {
+		if (ic->streams[i].vertex_count < num_indices) {
+			ufbxi_fmt_err_info(error, "%zu", i);
+			ufbxi_fail_err_msg(error, "user_streams[i].vertex_count < num_indices", "Truncated vertex stream");
+		}
+		vertex_size += ic->streams[i].vertex_size;
+	}
+	ufbxi_check_err_msg(error, vertex_size != 0, "Zero vertex size");
+
+	size_t num_chunks = (num_indices + UFBXI_INDEX_CHUNK_SIZE - 1) / UFBXI_INDEX_CHUNK_SIZE;
+	ic->num_chunks = num_chunks;
+
+	ic->hashes = ufbxi_push(&ic->buf, uint32_t, num_indices);
+	ic->order = ufbxi_push(&ic->buf, uint32_t, num_indices);
+	ic->chunk_offsets = ufbxi_push_zero(&ic->buf, uint32_t, num_chunks * UFBXI_INDEX_PARTITION_COUNT);
+	ic->partition_offsets = ufbxi_push(&ic->buf, uint32_t, UFBXI_INDEX_PARTITION_COUNT + 1);
+	ic->table_offsets = ufbxi_push(&ic->buf, size_t, UFBXI_INDEX_PARTITION_COUNT + 1);
+	ic->tasks = ufbxi_push(&ic->buf, ufbxi_index_task, ufbxi_max_sz(num_chunks, UFBXI_INDEX_PARTITION_COUNT));
+	ufbxi_check_err(error, ic->hashes && ic->order && ic->chunk_offsets && ic->partition_offsets && ic->table_offsets && ic->tasks);
+
+	for (size_t i = 0; i < ufbxi_max_sz(num_chunks, UFBXI_INDEX_PARTITION_COUNT); i++) {
+		ic->tasks[i].ic = ic;
+		ic->tasks[i].index = i;
+	}
+
+	// Hash vertices and count them per partition for each chunk
+	for (size_t i = 0; i < num_chunks; i++) {
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(&ic->thread_pool, error, &ufbxi_index_hash_task_fn, &ic->tasks[i]));
+	}
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(&ic->thread_pool, error));
+
+	// Convert the counts to output offsets so that each partition is sorted by index
+	uint32_t offset = 0;
+	size_t table_offset = 0;
+	for (size_t part = 0; part < UFBXI_INDEX_PARTITION_COUNT; part++) {
+		ic->partition_offsets[part] = offset;
+		for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+			uint32_t *p_count = &ic->chunk_offsets[chunk * UFBXI_INDEX_PARTITION_COUNT + part];
+			uint32_t count = *p_count;
+			*p_count = offset;
+			offset += count;
+		}
+
+		size_t num_part = offset - ic->partition_offsets[part];
+		size_t table_size = 1;
+		while (table_size < num_part * 2) {
+			table_size *= 2;
+		}
+		ic->table_offsets[part] = table_offset;
+		table_offset += table_size;
+	}
+	ic->partition_offsets[UFBXI_INDEX_PARTITION_COUNT] = offset;
+	ic->table_offsets[UFBXI_INDEX_PARTITION_COUNT] = table_offset;
+
+	ic->tables = ufbxi_push_zero(&ic->buf, uint32_t, table_offset);
+	ufbxi_check_err(error, ic->tables);
+
+	for (size_t i = 0; i < num_chunks; i++) {
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(&ic->thread_pool, error, &ufbxi_index_scatter_task_fn, &ic->tasks[i]));
+	}
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(&ic->thread_pool, error));
+
+	// Resolve the first occurrence of each vertex
+	for (size_t i = 0; i < UFBXI_INDEX_PARTITION_COUNT; i++) {
+		ufbxi_check_err(error, ufbxi_thread_pool_dispatch(&ic->thread_pool, error, &ufbxi_index_dedup_task_fn, &ic->tasks[i]));
+	}
+	ufbxi_check_err(error, ufbxi_thread_pool_dispatch_wait(&ic->thread_pool, error));
+
+	// Number the unique vertices and compact the streams, the destination
+	// is always before the source so we never overwrite unread data.
+	uint32_t *indices = ic->indices;
+	size_t num_unique = 0;
+	for (size_t i = 0; i < num_indices; i++) {
+		uint32_t first = indices[i];
+		if (first == i) {
+			if (num_unique != i) {
+				for (size_t si = 0; si < ic->num_streams; si++) {
+					size_t size = ic->streams[si].vertex_size;
+					char *data = (char*)ic->streams[si].data;
+					memcpy(data + num_unique * size, data + i * size, size);
+				}
+			}
+			indices[i] = (uint32_t)num_unique++;
+		} else {
+			indices[i] = indices[first];
+		}
+	}
+	ic->num_unique = num_unique;
+
+	return 1;
+}
+
+static ufbxi_noinline size_t ufbxi_generate_indices_threaded(const ufbx_vertex_stream *streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_generate_indices_opts *opts, ufbx_error *error)
+{
+	const ufbx_thread_opts *thread_opts = &opts->thread_opts;
+	if (!(thread_opts->pool.run_fn && thread_opts->pool.wait_fn) || num_indices <= UFBXI_INDEX_CHUNK_SIZE || num_indices >= UINT32_MAX) {
+		return ufbxi_generate_indices(streams, num_streams, indices, num_indices, &opts->temp_allocator, error);
+	}
+
+	ufbxi_index_context ic; // ufbxi_uninit
+	memset(&ic, 0, sizeof(ic));
+	ic.error = error;
+	ic.streams = streams;
+	ic.num_streams = num_streams;
+	ic.indices = indices;
+	ic.num_indices = num_indices;
+
+	ufbxi_init_ator(error, &ic.ator, &opts->temp_allocator, "temp");
+	ic.buf.ator = &ic.ator;
+
+	size_t result_vertices = 0;
+	if (ufbxi_thread_pool_init(&ic.thread_pool, error, &ic.ator, thread_opts) && ufbxi_generate_indices_threaded_imp(&ic)) {
+		result_vertices = ic.num_unique;
+		ufbxi_clear_error(error);
+	} else {
+		ufbxi_fix_error_type(error, "Failed to generate indices", NULL);
+	}
+
+	ufbxi_thread_pool_free(&ic.thread_pool);
+	ufbxi_buf_free(&ic.buf);
+	ufbxi_free_ator(&ic.ator);
+
+	return result_vertices;
+}
+
 #else
 
 static ufbxi_noinline size_t ufbxi_generate_indices(const ufbx_vertex_stream *user_streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_allocator_opts *allocator, ufbx_error *error)
@@ -30238,11 +36340,309 @@ static ufbxi_noinline size_t ufbxi_generate_indices(const ufbx_vertex_stream *us
 	return 0;
 }
 
+static ufbxi_noinline size_t ufbxi_generate_indices_threaded(const ufbx_vertex_stream *streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_generate_indices_opts *opts, ufbx_error *error)
+{
+	return ufbxi_generate_indices(streams, num_streams, indices, num_indices, &opts->temp_allocator, error);
+}
+
+#endif
+
+#if UFBXI_FEATURE_TRIANGULATION
+
+// Round-to-nearest-even conversion to IEEE 754 half precision.
+// Converts directly from `double` as rounding through `float` first could
+// round twice, `float` inputs are widened exactly.
+static ufbxi_noinline uint16_t ufbxi_f64_to_f16(double value)
+{
+	uint64_t bits; // ufbxi_uninit
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t sign = (uint32_t)(bits >> 48u) & 0x8000u;
+	uint32_t exponent = (uint32_t)(bits >> 52u) & 0x7ffu;
+	uint64_t mantissa = bits & (((uint64_t)1 << 52u) - 1u);
+
+	if (exponent == 0x7ff) {
+		return (uint16_t)(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+	}
+
+	int32_t e = (int32_t)exponent - 1023 + 15;
+	if (e >= 31) {
+		return (uint16_t)(sign | 0x7c00u);
+	} else if (e <= 0) {
+		// Subnormal or zero
+		if (e < -10) return (uint16_t)sign;
+		mantissa |= (uint64_t)1 << 52u;
+		uint32_t shift = (uint32_t)(43 - e);
+		uint32_t half = (uint32_t)(mantissa >> shift);
+		uint64_t rem = mantissa & (((uint64_t)1 << shift) - 1u);
+		uint64_t mid = (uint64_t)1 << (shift - 1u);
+		if (rem > mid || (rem == mid && (half & 1u) != 0)) half++;
+		return (uint16_t)(sign | half);
+	} else {
+		// Rounding may carry to the exponent, which is the correct result
+		uint32_t half = (uint32_t)e << 10u | (uint32_t)(mantissa >> 42u);
+		uint64_t rem = mantissa & (((uint64_t)1 << 42u) - 1u);
+		uint64_t mid = (uint64_t)1 << 41u;
+		if (rem > mid || (rem == mid && (half & 1u) != 0)) half++;
+		return (uint16_t)(sign | half);
+	}
+}
+
+static ufbxi_forceinline ufbx_real ufbxi_clamp_real(ufbx_real v, ufbx_real min_v, ufbx_real max_v)
+{
+	// NOTE: Maps NaN to `min_v`
+	if (!(v >= min_v)) return min_v;
+	if (v > max_v) return max_v;
+	return v;
+}
+
+static const uint8_t ufbxi_vertex_format_size[] = { 4, 2, 2, 2, 1, 2, 1 };
+static const uint8_t ufbxi_vertex_attribute_components[] = { 3, 3, 3, 3, 2, 4, 4, 4 };
+
+ufbx_static_assert(vertex_format_size, ufbxi_arraycount(ufbxi_vertex_format_size) == UFBX_VERTEX_FORMAT_COUNT);
+ufbx_static_assert(vertex_attribute_components, ufbxi_arraycount(ufbxi_vertex_attribute_components) == UFBX_VERTEX_ATTRIBUTE_COUNT);
+
+typedef struct {
+	ufbx_vertex_attribute attribute;
+	ufbx_vertex_format format;
+	uint32_t num_components;
+	uint32_t offset;
+	const ufbx_vertex_attrib *attrib;
+} ufbxi_vertex_element;
+
+typedef struct {
+	ufbx_error error;
+	ufbxi_allocator ator_tmp;
+	ufbxi_buf tmp;
+
+	const ufbx_mesh *mesh;
+	const ufbx_mesh_part *part;
+	const ufbx_skin_deformer *skin;
+	ufbx_vertex_buffer_opts opts;
+
+	ufbxi_vertex_element *elements;
+	size_t num_elements;
+	size_t stride;
+
+	ufbx_vertex_buffer *dst;
+} ufbxi_vertex_buffer_context;
+
+static ufbxi_noinline void ufbxi_write_vertex_components(char *dst, ufbx_vertex_format format, const ufbx_real *values, uint32_t num_components)
+{
+	for (uint32_t i = 0; i < num_components; i++) {
+		ufbx_real v = values[i];
+		switch (format) {
+		case UFBX_VERTEX_FORMAT_F32: {
+			float f = (float)v;
+			memcpy(dst + i * 4, &f, 4);
+		} break;
+		case UFBX_VERTEX_FORMAT_F16: {
+			uint16_t h = ufbxi_f64_to_f16((double)v);
+			memcpy(dst + i * 2, &h, 2);
+		} break;
+		case UFBX_VERTEX_FORMAT_SNORM16: {
+			ufbx_real c = ufbxi_clamp_real(v, -1.0f, 1.0f) * 32767.0f;
+			int16_t n = (int16_t)(c >= 0.0f ? c + 0.5f : c - 0.5f);
+			memcpy(dst + i * 2, &n, 2);
+		} break;
+		case UFBX_VERTEX_FORMAT_UNORM16: {
+			uint16_t n = (uint16_t)(ufbxi_clamp_real(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+			memcpy(dst + i * 2, &n, 2);
+		} break;
+		case UFBX_VERTEX_FORMAT_UNORM8: {
+			dst[i] = (char)(uint8_t)(ufbxi_clamp_real(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+		} break;
+		case UFBX_VERTEX_FORMAT_U16: {
+			uint16_t n = (uint16_t)(ufbxi_clamp_real(v, 0.0f, 65535.0f) + 0.5f);
+			memcpy(dst + i * 2, &n, 2);
+		} break;
+		case UFBX_VERTEX_FORMAT_U8: {
+			dst[i] = (char)(uint8_t)(ufbxi_clamp_real(v, 0.0f, 255.0f) + 0.5f);
+		} break;
+		default:
+			ufbxi_unreachable("Bad vertex format");
+		}
+	}
+}
+
+static ufbxi_noinline void ufbxi_encode_vertex(ufbxi_vertex_buffer_context *vc, char *dst, uint32_t index)
+{
+	const ufbx_mesh *mesh = vc->mesh;
+	memset(dst, 0, vc->stride);
+
+	ufbxi_for(ufbxi_vertex_element, elem, vc->elements, vc->num_elements) {
+		ufbx_real values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		const ufbx_vertex_attrib *attrib = elem->attrib;
+
+		if (attrib) {
+			// NOTE: `UFBX_NO_INDEX` refers to the zero value before `values.data`
+			const ufbx_real *src = (const ufbx_real*)attrib->values.data + (int32_t)attrib->indices.data[index] * (ptrdiff_t)attrib->value_reals;
+			size_t num_reals = ufbxi_min_sz(attrib->value_reals, 4);
+			for (size_t i = 0; i < num_reals; i++) {
+				values[i] = src[i];
+			}
+		} else if (elem->attribute == UFBX_VERTEX_ATTRIBUTE_SKIN_INDICES || elem->attribute == UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS) {
+			const ufbx_skin_deformer *skin = vc->skin;
+			uint32_t vertex = mesh->vertex_indices.data[index];
+			if (skin && vertex < skin->vertices.count) {
+				ufbx_skin_vertex skin_vertex = skin->vertices.data[vertex];
+				uint32_t num_weights = ufbxi_min32(skin_vertex.num_weights, elem->num_components);
+				ufbx_real total = 0.0f;
+				for (uint32_t i = 0; i < num_weights; i++) {
+					ufbx_skin_weight weight = skin->weights.data[skin_vertex.weight_begin + i];
+					if (elem->attribute == UFBX_VERTEX_ATTRIBUTE_SKIN_INDICES) {
+						values[i] = (ufbx_real)weight.cluster_index;
+					} else {
+						values[i] = weight.weight;
+					}
+					total += weight.weight;
+				}
+				if (elem->attribute == UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS && !vc->opts.no_normalize_skin_weights && total > 0.0f) {
+					for (uint32_t i = 0; i < num_weights; i++) {
+						values[i] /= total;
+					}
+				}
+			}
+		}
+
+		ufbxi_write_vertex_components(dst + elem->offset, elem->format, values, elem->num_components);
+	}
+}
+
+ufbxi_nodiscard static ufbxi_noinline int ufbxi_build_vertex_buffer_imp(ufbxi_vertex_buffer_context *vc, const ufbx_vertex_layout *layout)
+{
+	const ufbx_mesh *mesh = vc->mesh;
+	const ufbx_mesh_part *part = vc->part;
+	ufbx_vertex_buffer *dst = vc->dst;
+
+	size_t stride = layout->stride;
+	ufbxi_check_err_msg(&vc->error, stride > 0, "Bad vertex layout");
+	vc->stride = stride;
+
+	vc->num_elements = layout->num_elements;
+	vc->elements = ufbxi_push(&vc->tmp, ufbxi_vertex_element, layout->num_elements);
+	ufbxi_check_err(&vc->error, vc->elements);
+
+	for (size_t i = 0; i < layout->num_elements; i++) {
+		const ufbx_vertex_element *src = &layout->elements[i];
+		ufbxi_vertex_element *elem = &vc->elements[i];
+
+		ufbxi_check_err_msg(&vc->error, (uint32_t)src->attribute < UFBX_VERTEX_ATTRIBUTE_COUNT, "Bad vertex layout");
+		ufbxi_check_err_msg(&vc->error, (uint32_t)src->format < UFBX_VERTEX_FORMAT_COUNT, "Bad vertex layout");
+		ufbxi_check_err_msg(&vc->error, src->num_components <= 4, "Bad vertex layout");
+
+		elem->attribute = src->attribute;
+		elem->format = src->format;
+		elem->offset = src->offset;
+		elem->num_components = src->num_components ? src->num_components : ufbxi_vertex_attribute_components[src->attribute];
+		elem->attrib = NULL;
+
+		size_t size = (size_t)elem->num_components * ufbxi_vertex_format_size[src->format];
+		ufbxi_check_err_msg(&vc->error, src->offset <= stride && stride - src->offset >= size, "Bad vertex layout");
+
+		const ufbx_vertex_attrib *attrib = NULL;
+		uint32_t set = src->set_index;
+		switch (src->attribute) {
+		case UFBX_VERTEX_ATTRIBUTE_POSITION:
+			attrib = (const ufbx_vertex_attrib*)&mesh->vertex_position;
+			break;
+		case UFBX_VERTEX_ATTRIBUTE_NORMAL:
+			attrib = (const ufbx_vertex_attrib*)&mesh->vertex_normal;
+			break;
+		case UFBX_VERTEX_ATTRIBUTE_TANGENT:
+			if (set < mesh->uv_sets.count) attrib = (const ufbx_vertex_attrib*)&mesh->uv_sets.data[set].vertex_tangent;
+			break;
+		case UFBX_VERTEX_ATTRIBUTE_BITANGENT:
+			if (set < mesh->uv_sets.count) attrib = (const ufbx_vertex_attrib*)&mesh->uv_sets.data[set].vertex_bitangent;
+			break;
+		case UFBX_VERTEX_ATTRIBUTE_UV:
+			if (set < mesh->uv_sets.count) attrib = (const ufbx_vertex_attrib*)&mesh->uv_sets.data[set].vertex_uv;
+			break;
+		case UFBX_VERTEX_ATTRIBUTE_COLOR:
+			if (set < mesh->color_sets.count) attrib = (const ufbx_vertex_attrib*)&mesh->color_sets.data[set].vertex_color;
+			break;
+		default:
+			break;
+		}
+
+		if (attrib && attrib->exists) {
+			elem->attrib = attrib;
+		}
+	}
+
+	if (mesh->skin_deformers.count > 0) {
+		vc->skin = mesh->skin_deformers.data[0];
+	}
+
+	size_t num_faces = part ? part->num_faces : mesh->num_faces;
+	size_t num_triangles = part ? part->num_triangles : mesh->num_triangles;
+	size_t max_indices = num_triangles * 3;
+	ufbxi_check_err_msg(&vc->error, dst->index_capacity >= max_indices, "Index buffer too small");
+
+	size_t max_vertices = ufbxi_min_sz(max_indices, dst->vertex_capacity);
+	size_t table_size = 1;
+	if (!vc->opts.no_deduplication) {
+		while (table_size < max_vertices * 2) {
+			table_size *= 2;
+		}
+	}
+	size_t table_mask = table_size - 1;
+
+	// Table of `vertex + 1` in `dst->vertices`, zero for empty slots
+	uint32_t *table = ufbxi_push_zero(&vc->tmp, uint32_t, table_size);
+	char *vertex = ufbxi_push(&vc->tmp, char, stride);
+	uint32_t *tri_indices = ufbxi_push(&vc->tmp, uint32_t, mesh->max_face_triangles * 3);
+	ufbxi_check_err(&vc->error, table && vertex && tri_indices);
+
+	char *dst_vertices = (char*)dst->vertices;
+	size_t num_vertices = 0, num_indices = 0;
+	for (size_t face_ix = 0; face_ix < num_faces; face_ix++) {
+		ufbx_face face = mesh->faces.data[part ? part->face_indices.data[face_ix] : face_ix];
+		uint32_t num_tris = ufbx_triangulate_face(tri_indices, mesh->max_face_triangles * 3, mesh, face);
+
+		for (size_t i = 0; i < (size_t)num_tris * 3; i++) {
+			ufbxi_encode_vertex(vc, vertex, tri_indices[i]);
+
+			size_t slot = SIZE_MAX;
+			uint32_t result = UINT32_MAX;
+			if (!vc->opts.no_deduplication) {
+				slot = ufbxi_hash_string(vertex, stride) & table_mask;
+				for (;;) {
+					uint32_t entry = table[slot];
+					if (entry == 0) break;
+					if (!memcmp(dst_vertices + (entry - 1) * stride, vertex, stride)) {
+						result = entry - 1;
+						break;
+					}
+					slot = (slot + 1) & table_mask;
+				}
+			}
+
+			if (result == UINT32_MAX) {
+				ufbxi_check_err_msg(&vc->error, num_vertices < dst->vertex_capacity, "Vertex buffer too small");
+				memcpy(dst_vertices + num_vertices * stride, vertex, stride);
+				result = (uint32_t)num_vertices++;
+				if (slot != SIZE_MAX) {
+					table[slot] = result + 1;
+				}
+			}
+
+			ufbx_assert(num_indices < max_indices);
+			dst->indices[num_indices++] = result;
+		}
+	}
+
+	dst->num_vertices = num_vertices;
+	dst->num_indices = num_indices;
+
+	return 1;
+}
+
 #endif
 
 static ufbxi_noinline void ufbxi_free_scene_imp(ufbxi_scene_imp *imp)
 {
 	ufbx_assert(imp->magic == UFBXI_SCENE_IMP_MAGIC);
+	ufbxi_unmap_files(imp->file_maps);
 	ufbxi_buf_free(&imp->string_buf);
 }
 
@@ -30507,6 +36907,8 @@ ufbx_abi ufbx_scene *ufbx_load_memory(const void *data, size_t size, const ufbx_
 	uc.data_begin = uc.data = (const char *)data;
 	uc.data_size = size;
 	uc.progress_bytes_total = size;
+	uc.source_data = (const char *)data;
+	uc.source_size = size;
 	return ufbxi_load(&uc, opts, error);
 }
 
@@ -30826,91 +37228,19 @@ ufbx_abi ufbxi_noinline ufbx_matrix ufbx_get_compatible_matrix_for_normals(const
 
 ufbx_abi ufbx_real ufbx_evaluate_curve(const ufbx_anim_curve *curve, double time, ufbx_real default_value)
 {
-	return ufbx_evaluate_curve_flags(curve, time, default_value, 0);
+	return ufbxi_evaluate_curve(curve, time, default_value, 0, NULL);
 }
 
 ufbx_abi ufbx_real ufbx_evaluate_curve_flags(const ufbx_anim_curve *curve, double time, ufbx_real default_value, uint32_t flags)
 {
-	if (!curve) return default_value;
-	if (curve->keyframes.count <= 1) {
-		if (curve->keyframes.count == 1) {
-			return curve->keyframes.data[0].value;
-		} else {
-			return default_value;
-		}
-	}
-
-	if ((flags & UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION) == 0) {
-		if (time < curve->min_time || time > curve->max_time) {
-			return ufbxi_extrapolate_curve(curve, time, flags);
-		}
-	}
-
-	size_t begin = 0;
-	size_t end = curve->keyframes.count;
-	const ufbx_keyframe *keys = curve->keyframes.data;
-	while (end - begin >= 8) {
-		size_t mid = (begin + end) >> 1;
-		if (keys[mid].time <= time) {
-			begin = mid + 1;
-		} else {
-			end = mid;
-		}
-	}
-
-	end = curve->keyframes.count;
-	for (; begin < end; begin++) {
-		const ufbx_keyframe *next = &keys[begin];
-		if (next->time <= time) continue;
-
-		// First keyframe
-		if (begin == 0) return next->value;
-
-		const ufbx_keyframe *prev = next - 1;
-
-		// Exact keyframe
-		if (prev->time == time) return prev->value;
-
-		double rcp_delta = 1.0 / (next->time - prev->time);
-		double t = (time - prev->time) * rcp_delta;
-
-		switch (prev->interpolation) {
-
-		case UFBX_INTERPOLATION_CONSTANT_PREV:
-			return prev->value;
-
-		case UFBX_INTERPOLATION_CONSTANT_NEXT:
-			return next->value;
-
-		case UFBX_INTERPOLATION_LINEAR:
-			return (ufbx_real)(prev->value*(1.0 - t) + next->value*t);
-
-		case UFBX_INTERPOLATION_CUBIC:
-		{
-			double x1 = prev->right.dx * rcp_delta;
-			double x2 = 1.0 - next->left.dx * rcp_delta;
-			t = ufbxi_find_cubic_bezier_t(x1, x2, t);
-
-			double t2 = t*t, t3 = t2*t;
-			double u = 1.0 - t, u2 = u*u, u3 = u2*u;
-
-			double y0 = prev->value;
-			double y3 = next->value;
-			double y1 = y0 + prev->right.dy;
-			double y2 = y3 - next->left.dy;
-
-			return (ufbx_real)(u3*y0 + 3.0 * (u2*t*y1 + u*t2*y2) + t3*y3);
-		}
-
-		default:
-			ufbxi_unreachable("Bad interpolation mode");
-			return 0.0f;
-
-		}
-	}
+	return ufbxi_evaluate_curve(curve, time, default_value, flags, NULL);
+}
 
-	// Last keyframe
-	return curve->keyframes.data[curve->keyframes.count - 1].value;
+ufbx_abi ufbx_real ufbx_evaluate_curve_cursor(ufbx_curve_cursor *cursor, double time, ufbx_real default_value, uint32_t flags)
+{
+	ufbx_assert(cursor);
+	if (!cursor) return default_value;
+	return ufbxi_evaluate_curve(cursor->curve, time, default_value, flags, &cursor->key_index);
 }
 
 ufbx_abi ufbxi_noinline ufbx_real ufbx_evaluate_anim_value_real(const ufbx_anim_value *anim_value, double time)
@@ -30941,85 +37271,27 @@ ufbx_abi ufbxi_noinline ufbx_vec3 ufbx_evaluate_anim_value_vec3_flags(const ufbx
 		return zero;
 	}
 
-	ufbx_vec3 res = anim_value->default_value;
-	if (anim_value->curves[0]) res.x = ufbx_evaluate_curve_flags(anim_value->curves[0], time, res.x, flags);
-	if (anim_value->curves[1]) res.y = ufbx_evaluate_curve_flags(anim_value->curves[1], time, res.y, flags);
-	if (anim_value->curves[2]) res.z = ufbx_evaluate_curve_flags(anim_value->curves[2], time, res.z, flags);
-	return res;
+	return ufbxi_evaluate_anim_value_vec3(anim_value, time, flags, NULL);
 }
 
 ufbx_abi ufbxi_noinline ufbx_prop ufbx_evaluate_prop_len(const ufbx_anim *anim, const ufbx_element *element, const char *name, size_t name_len, double time)
 {
-	return ufbx_evaluate_prop_flags_len(anim, element, name, name_len, time, 0);
+	return ufbxi_evaluate_prop(anim, element, name, name_len, time, 0, NULL);
 }
 
 ufbx_abi ufbxi_noinline ufbx_prop ufbx_evaluate_prop_flags_len(const ufbx_anim *anim, const ufbx_element *element, const char *name, size_t name_len, double time, uint32_t flags)
 {
-	ufbx_prop result;
-
-	ufbx_prop *prop = ufbx_find_prop_len(&element->props, name, name_len);
-	if (prop) {
-		result = *prop;
-	} else {
-		memset(&result, 0, sizeof(result));
-		result.name.data = name;
-		result.name.length = name_len;
-		result._internal_key = ufbxi_get_name_key(name, name_len);
-		result.flags = UFBX_PROP_FLAG_NOT_FOUND;
-		result.value_str.data = ufbxi_empty_char;
-		result.value_str.length = 0;
-		result.value_blob.data = NULL;
-		result.value_blob.size = 0;
-	}
-
-	if (anim->prop_overrides.count > 0) {
-		ufbxi_find_prop_override(&anim->prop_overrides, element->element_id, &result);
-		return result;
-	}
-
-	if ((result.flags & (UFBX_PROP_FLAG_ANIMATED|UFBX_PROP_FLAG_CONNECTED)) == 0) return result;
-
-	if ((prop->flags & UFBX_PROP_FLAG_CONNECTED) != 0 && !anim->ignore_connections) {
-		ufbxi_evaluate_connected_prop(&result, anim, element, prop->name.data, time, flags);
-	}
-
-	ufbxi_evaluate_props(anim, element, time, &result, 1, flags);
-
-	return result;
+	return ufbxi_evaluate_prop(anim, element, name, name_len, time, flags, NULL);
 }
 
 ufbx_abi ufbxi_noinline ufbx_props ufbx_evaluate_props(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *buffer, size_t buffer_size)
 {
-	return ufbx_evaluate_props_flags(anim, element, time, buffer, buffer_size, 0);
+	return ufbxi_evaluate_element_props(anim, element, time, buffer, buffer_size, 0, NULL);
 }
 
 ufbx_abi ufbxi_noinline ufbx_props ufbx_evaluate_props_flags(const ufbx_anim *anim, const ufbx_element *element, double time, ufbx_prop *buffer, size_t buffer_size, uint32_t flags)
 {
-	ufbx_props ret = { NULL };
-	if (!element) return ret;
-
-	size_t num_anim = 0;
-	ufbxi_prop_iter iter; // ufbxi_uninit
-	ufbxi_init_prop_iter(&iter, anim, element);
-	const ufbx_prop *prop = NULL;
-	while ((prop = ufbxi_next_prop(&iter)) != NULL) {
-		if (!(prop->flags & (UFBX_PROP_FLAG_ANIMATED|UFBX_PROP_FLAG_OVERRIDDEN|UFBX_PROP_FLAG_CONNECTED))) continue;
-		if (num_anim >= buffer_size) break;
-
-		ufbx_prop *dst = &buffer[num_anim++];
-		*dst = *prop;
-
-		if ((prop->flags & UFBX_PROP_FLAG_CONNECTED) != 0 && !anim->ignore_connections) {
-			ufbxi_evaluate_connected_prop(dst, anim, element, prop->name.data, time, flags);
-		}
-	}
-
-	ufbxi_evaluate_props(anim, element, time, buffer, num_anim, flags);
-
-	ret.props.data = buffer;
-	ret.props.count = ret.num_animated = num_anim;
-	ret.defaults = (ufbx_props*)&element->props;
-	return ret;
+	return ufbxi_evaluate_element_props(anim, element, time, buffer, buffer_size, flags, NULL);
 }
 
 ufbx_abi ufbxi_noinline ufbx_transform ufbx_evaluate_transform(const ufbx_anim *anim, const ufbx_node *node, double time)
@@ -31027,136 +37299,9 @@ ufbx_abi ufbxi_noinline ufbx_transform ufbx_evaluate_transform(const ufbx_anim *
 	return ufbx_evaluate_transform_flags(anim, node, time, 0);
 }
 
-static const char *const ufbxi_transform_props_all[] = {
-	ufbxi_Lcl_Rotation,
-	ufbxi_Lcl_Scaling,
-	ufbxi_Lcl_Translation,
-	ufbxi_PostRotation,
-	ufbxi_PreRotation,
-	ufbxi_RotationOffset,
-	ufbxi_RotationOrder,
-	ufbxi_RotationPivot,
-	ufbxi_ScalingOffset,
-	ufbxi_ScalingPivot,
-};
-
-static const char *const ufbxi_transform_props_rotation[] = {
-	ufbxi_Lcl_Rotation,
-	ufbxi_PostRotation,
-	ufbxi_PreRotation,
-	ufbxi_RotationOrder,
-};
-
-static const char *const ufbxi_transform_props_scale[] = {
-	ufbxi_Lcl_Scaling,
-};
-
-static const char *const ufbxi_transform_props_rotation_scale[] = {
-	ufbxi_Lcl_Rotation,
-	ufbxi_Lcl_Scaling,
-	ufbxi_PostRotation,
-	ufbxi_PreRotation,
-	ufbxi_RotationOrder,
-};
-
 ufbx_abi ufbxi_noinline ufbx_transform ufbx_evaluate_transform_flags(const ufbx_anim *anim, const ufbx_node *node, double time, uint32_t flags)
 {
-	ufbx_assert(anim);
-	ufbx_assert(node);
-	if (!node) return ufbx_identity_transform;
-	if (!anim) return node->local_transform;
-	if (node->is_root) return node->local_transform;
-
-	if ((flags & UFBX_TRANSFORM_FLAG_EXPLICIT_INCLUDES) == 0) {
-		flags |= UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION;
-	}
-
-	const char *const *prop_names = ufbxi_transform_props_all;
-	size_t num_prop_names = ufbxi_arraycount(ufbxi_transform_props_all);
-	uint32_t components = flags & (UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION);
-	if (components == (UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION|UFBX_TRANSFORM_FLAG_INCLUDE_SCALE)) {
-		prop_names = ufbxi_transform_props_rotation_scale;
-		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_rotation_scale);
-	} else if (components == UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION) {
-		prop_names = ufbxi_transform_props_rotation;
-		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_rotation);
-	} else if (components == UFBX_TRANSFORM_FLAG_INCLUDE_SCALE) {
-		prop_names = ufbxi_transform_props_scale;
-		num_prop_names = ufbxi_arraycount(ufbxi_transform_props_scale);
-	} else if (components == 0) {
-		return ufbx_identity_transform;
-	}
-
-	const ufbx_vec3 *translation_scale = NULL;
-	ufbx_prop helper_scale; // ufbxi_uninit
-	ufbx_vec3 scale_factor = ufbxi_one_vec3;
-	bool use_scale_factor = false;
-
-	if (node->parent && (flags & (UFBX_TRANSFORM_FLAG_INCLUDE_SCALE|UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION)) != 0) {
-		ufbx_node *parent = node->parent;
-
-		if ((flags & UFBX_TRANSFORM_FLAG_IGNORE_COMPONENTWISE_SCALE) == 0 && parent->inherit_scale_node) {
-			ufbx_node *p = parent->inherit_scale_node;
-
-			if (node->is_scale_helper) {
-				use_scale_factor = true;
-			}
-
-			while (p && p->scale_helper) {
-				ufbx_prop scale = ufbx_evaluate_prop(anim, &p->scale_helper->element, ufbxi_Lcl_Scaling, time);
-				scale_factor.x *= scale.value_vec3.x;
-				scale_factor.y *= scale.value_vec3.y;
-				scale_factor.z *= scale.value_vec3.z;
-				p = p->inherit_scale_node;
-			}
-		}
-
-		if (parent->scale_helper && (flags & UFBX_TRANSFORM_FLAG_IGNORE_SCALE_HELPER) == 0) {
-			helper_scale = ufbx_evaluate_prop(anim, &parent->scale_helper->element, ufbxi_Lcl_Scaling, time);
-			if (helper_scale.flags & UFBX_PROP_FLAG_NOT_FOUND) {
-				helper_scale.value_vec3.x = 1.0f;
-				helper_scale.value_vec3.y = 1.0f;
-				helper_scale.value_vec3.z = 1.0f;
-			}
-			helper_scale.value_vec3.x *= scale_factor.x;
-			helper_scale.value_vec3.y *= scale_factor.y;
-			helper_scale.value_vec3.z *= scale_factor.z;
-			translation_scale = &helper_scale.value_vec3;
-		}
-	}
-
-	uint32_t eval_flags = 0;
-	if (flags & UFBX_TRANSFORM_FLAG_NO_EXTRAPOLATION) {
-		eval_flags |= UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION;
-	}
-
-	ufbx_prop buf[ufbxi_arraycount(ufbxi_transform_props_all)]; // ufbxi_uninit
-	ufbx_props props = ufbxi_evaluate_selected_props(anim, &node->element, time, buf, prop_names, num_prop_names, eval_flags);
-	ufbx_rotation_order order = (ufbx_rotation_order)ufbxi_find_enum(&props, ufbxi_RotationOrder, UFBX_ROTATION_ORDER_XYZ, UFBX_ROTATION_ORDER_SPHERIC);
-
-	ufbx_transform transform; // ufbxi_uninit
-	if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_TRANSLATION) != 0) {
-		transform = ufbxi_get_transform(&props, order, node, translation_scale);
-	} else {
-		transform.translation = ufbx_zero_vec3;
-		if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_ROTATION) != 0) {
-			transform.rotation = ufbxi_get_rotation(&props, order, node);
-		} else {
-			transform.rotation = ufbx_identity_quat;
-		}
-		if ((components & UFBX_TRANSFORM_FLAG_INCLUDE_SCALE) != 0) {
-			transform.scale = ufbxi_get_scale(&props, node);
-		} else {
-			transform.scale = ufbxi_one_vec3;
-		}
-	}
-
-	if (use_scale_factor) {
-		transform.scale.x *= scale_factor.x;
-		transform.scale.y *= scale_factor.y;
-		transform.scale.z *= scale_factor.z;
-	}
-	return transform;
+	return ufbxi_evaluate_transform(anim, node, time, flags, NULL);
 }
 
 ufbx_abi ufbx_real ufbx_evaluate_blend_weight(const ufbx_anim *anim, const ufbx_blend_channel *channel, double time)
@@ -31171,7 +37316,7 @@ ufbx_abi ufbx_real ufbx_evaluate_blend_weight_flags(const ufbx_anim *anim, const
 	};
 
 	ufbx_prop buf[ufbxi_arraycount(prop_names)]; // ufbxi_uninit
-	ufbx_props props = ufbxi_evaluate_selected_props(anim, &channel->element, time, buf, prop_names, ufbxi_arraycount(prop_names), flags);
+	ufbx_props props = ufbxi_evaluate_selected_props(anim, &channel->element, time, buf, prop_names, ufbxi_arraycount(prop_names), flags, NULL);
 	return ufbxi_find_real(&props, ufbxi_DeformPercent, channel->weight * (ufbx_real)100.0) * (ufbx_real)0.01;
 }
 
@@ -31191,6 +37336,23 @@ ufbx_abi ufbx_scene *ufbx_evaluate_scene(const ufbx_scene *scene, const ufbx_ani
 #endif
 }
 
+ufbx_abi bool ufbx_evaluate_scene_update(ufbx_scene *scene, const ufbx_anim *anim, double time, const ufbx_evaluate_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_return(false, opts, error);
+	ufbx_assert(scene);
+#if UFBXI_FEATURE_SCENE_EVALUATION
+	ufbxi_eval_context ec = { 0 };
+	return ufbxi_evaluate_scene_update(&ec, scene, anim, time, opts, error);
+#else
+	if (error) {
+		memset(error, 0, sizeof(ufbx_error));
+		ufbxi_fmt_err_info(error, "UFBX_ENABLE_SCENE_EVALUATION");
+		ufbxi_report_err_msg(error, "UFBXI_FEATURE_SCENE_EVALUATION", "Feature disabled");
+	}
+	return false;
+#endif
+}
+
 ufbx_abi ufbx_anim *ufbx_create_anim(const ufbx_scene *scene, const ufbx_anim_opts *opts, ufbx_error *error)
 {
 	ufbxi_check_opts_ptr(ufbx_anim, opts, error);
@@ -31239,6 +37401,239 @@ ufbx_abi void ufbx_retain_anim(ufbx_anim *anim)
 	ufbxi_retain_ref(&imp->refcount);
 }
 
+ufbx_abi ufbx_anim_cursor *ufbx_create_anim_cursor(const ufbx_scene *scene, const ufbx_anim *anim, const ufbx_anim_cursor_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_ptr(ufbx_anim_cursor, opts, error);
+	ufbx_assert(scene);
+
+	ufbxi_create_anim_cursor_context cc = { UFBX_ERROR_NONE };
+	if (opts) {
+		cc.opts = *opts;
+	}
+
+	cc.scene = scene;
+	cc.anim = anim ? anim : scene->anim;
+
+	int ok = ufbxi_create_anim_cursor_imp(&cc);
+
+	if (ok) {
+		ufbxi_clear_error(error);
+		ufbxi_anim_cursor_imp *imp = cc.imp;
+		return &imp->cursor;
+	} else {
+		ufbxi_fix_error_type(&cc.error, "Failed to create anim cursor", error);
+		ufbxi_buf_free(&cc.result);
+		ufbxi_free_ator(&cc.ator_result);
+		return NULL;
+	}
+}
+
+ufbx_abi void ufbx_free_anim_cursor(ufbx_anim_cursor *cursor)
+{
+	if (!cursor) return;
+
+	ufbxi_anim_cursor_imp *imp = ufbxi_get_imp(ufbxi_anim_cursor_imp, cursor);
+	ufbx_assert(imp->magic == UFBXI_ANIM_CURSOR_IMP_MAGIC);
+	if (imp->magic != UFBXI_ANIM_CURSOR_IMP_MAGIC) return;
+	ufbxi_release_ref(&imp->refcount);
+}
+
+ufbx_abi void ufbx_retain_anim_cursor(ufbx_anim_cursor *cursor)
+{
+	if (!cursor) return;
+
+	ufbxi_anim_cursor_imp *imp = ufbxi_get_imp(ufbxi_anim_cursor_imp, cursor);
+	ufbx_assert(imp->magic == UFBXI_ANIM_CURSOR_IMP_MAGIC);
+	if (imp->magic != UFBXI_ANIM_CURSOR_IMP_MAGIC) return;
+	ufbxi_retain_ref(&imp->refcount);
+}
+
+ufbx_abi ufbxi_noinline ufbx_prop ufbx_evaluate_prop_cursor_len(ufbx_anim_cursor *cursor, const ufbx_element *element, const char *name, size_t name_len, double time, uint32_t flags)
+{
+	ufbx_assert(cursor);
+	return ufbxi_evaluate_prop(cursor->anim, element, name, name_len, time, flags, &cursor->curve_keys);
+}
+
+ufbx_abi ufbxi_noinline ufbx_props ufbx_evaluate_props_cursor(ufbx_anim_cursor *cursor, const ufbx_element *element, double time, ufbx_prop *buffer, size_t buffer_size, uint32_t flags)
+{
+	ufbx_assert(cursor);
+	return ufbxi_evaluate_element_props(cursor->anim, element, time, buffer, buffer_size, flags, &cursor->curve_keys);
+}
+
+ufbx_abi ufbxi_noinline ufbx_transform ufbx_evaluate_transform_cursor(ufbx_anim_cursor *cursor, const ufbx_node *node, double time, uint32_t flags)
+{
+	ufbx_assert(cursor);
+	return ufbxi_evaluate_transform(cursor->anim, node, time, flags, &cursor->curve_keys);
+}
+
+// Evaluate curves `[begin, end)` of `imp->curves` belonging to `group`, matches `ufbxi_evaluate_curve()`.
+static ufbxi_forceinline void ufbxi_evaluate_compiled_curves(ufbxi_compiled_anim_imp *imp, size_t begin, size_t end, double time, ufbxi_compiled_curve_group group)
+{
+	ufbx_real *values = (ufbx_real*)imp->values;
+	bool extrapolate = (imp->evaluate_flags & UFBX_EVALUATE_FLAG_NO_EXTRAPOLATION) == 0;
+
+	for (size_t i = begin; i < end; i++) {
+		ufbxi_compiled_curve *curve = &imp->curves[i];
+		const double *times = imp->key_time + curve->key_begin;
+		const ufbx_real *key_values = imp->key_value + curve->key_begin;
+		size_t count = curve->key_count;
+
+		if (extrapolate && (time < times[0] || time > times[count - 1])) {
+			values[curve->dst] = ufbxi_extrapolate_curve(imp->src_curves[i], time, imp->evaluate_flags);
+			continue;
+		}
+
+		size_t index = ufbxi_find_key_time((const char*)times, sizeof(double), count, time, curve->cursor);
+		curve->cursor = (uint32_t)index;
+
+		ufbx_real value;
+		if (index == count) {
+			value = key_values[count - 1];
+		} else if (index == 0) {
+			value = key_values[0];
+		} else if (times[index - 1] == time) {
+			value = key_values[index - 1];
+		} else {
+			size_t prev = index - 1;
+			double rcp_delta = 1.0 / (times[index] - times[prev]);
+			double t = (time - times[prev]) * rcp_delta;
+
+			ufbx_interpolation interpolation = ufbxi_compiled_curve_group_interpolation(group);
+			if (group == UFBXI_COMPILED_CURVE_MIXED) {
+				interpolation = (ufbx_interpolation)imp->key_interpolation[curve->key_begin + prev];
+			}
+
+			switch (interpolation) {
+
+			case UFBX_INTERPOLATION_CONSTANT_PREV:
+				value = key_values[prev];
+				break;
+
+			case UFBX_INTERPOLATION_CONSTANT_NEXT:
+				value = key_values[index];
+				break;
+
+			case UFBX_INTERPOLATION_LINEAR:
+				value = (ufbx_real)(key_values[prev]*(1.0 - t) + key_values[index]*t);
+				break;
+
+			case UFBX_INTERPOLATION_CUBIC:
+			{
+				const ufbxi_compiled_cubic *cubic = &imp->key_cubic[curve->key_begin + prev];
+				t = ufbxi_find_cubic_bezier_t(cubic->x1, cubic->x2, t);
+
+				double t2 = t*t, t3 = t2*t;
+				double u = 1.0 - t, u2 = u*u, u3 = u2*u;
+
+				double y0 = key_values[prev];
+				double y3 = key_values[index];
+				value = (ufbx_real)(u3*y0 + 3.0 * (u2*t*cubic->y1 + u*t2*cubic->y2) + t3*y3);
+			} break;
+
+			default:
+				ufbxi_unreachable("Bad interpolation mode");
+				value = 0.0f;
+				break;
+			}
+		}
+
+		values[curve->dst] = value;
+	}
+}
+
+ufbx_abi ufbx_compiled_anim *ufbx_compile_anim(const ufbx_scene *scene, const ufbx_anim *anim, const ufbx_compile_anim_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_ptr(ufbx_compiled_anim, opts, error);
+	ufbx_assert(scene);
+
+	ufbxi_compile_anim_context cc = { UFBX_ERROR_NONE };
+	if (opts) {
+		cc.opts = *opts;
+	}
+
+	cc.scene = scene;
+	cc.anim = anim ? anim : scene->anim;
+
+	int ok = ufbxi_compile_anim_imp(&cc);
+
+	for (size_t i = 0; i < UFBXI_COMPILED_CURVE_GROUP_COUNT; i++) {
+		ufbxi_buf_free(&cc.tmp_curves[i]);
+		ufbxi_buf_free(&cc.tmp_compiled_curves[i]);
+	}
+	ufbxi_free_ator(&cc.ator_tmp);
+
+	if (ok) {
+		ufbxi_clear_error(error);
+		ufbxi_compiled_anim_imp *imp = cc.imp;
+		return &imp->compiled;
+	} else {
+		ufbxi_fix_error_type(&cc.error, "Failed to compile anim", error);
+		ufbxi_buf_free(&cc.result);
+		ufbxi_free_ator(&cc.ator_result);
+		return NULL;
+	}
+}
+
+ufbx_abi void ufbx_free_compiled_anim(ufbx_compiled_anim *compiled)
+{
+	if (!compiled) return;
+
+	ufbxi_compiled_anim_imp *imp = ufbxi_get_imp(ufbxi_compiled_anim_imp, compiled);
+	ufbx_assert(imp->magic == UFBXI_COMPILED_ANIM_IMP_MAGIC);
+	if (imp->magic != UFBXI_COMPILED_ANIM_IMP_MAGIC) return;
+	ufbxi_release_ref(&imp->refcount);
+}
+
+ufbx_abi void ufbx_retain_compiled_anim(ufbx_compiled_anim *compiled)
+{
+	if (!compiled) return;
+
+	ufbxi_compiled_anim_imp *imp = ufbxi_get_imp(ufbxi_compiled_anim_imp, compiled);
+	ufbx_assert(imp->magic == UFBXI_COMPILED_ANIM_IMP_MAGIC);
+	if (imp->magic != UFBXI_COMPILED_ANIM_IMP_MAGIC) return;
+	ufbxi_retain_ref(&imp->refcount);
+}
+
+ufbx_abi ufbxi_noinline size_t ufbx_evaluate_compiled_anim(ufbx_compiled_anim *compiled, double time, ufbx_transform *transforms, size_t num_transforms)
+{
+	ufbx_assert(compiled);
+	if (!compiled) return 0;
+
+	ufbxi_compiled_anim_imp *imp = ufbxi_get_imp(ufbxi_compiled_anim_imp, compiled);
+	ufbx_assert(imp->magic == UFBXI_COMPILED_ANIM_IMP_MAGIC);
+	if (imp->magic != UFBXI_COMPILED_ANIM_IMP_MAGIC) return 0;
+
+	// Evaluate each group separately so the interpolation mode is known in the inner loop
+	uint32_t begin = 0;
+	for (size_t group = 0; group < UFBXI_COMPILED_CURVE_GROUP_COUNT; group++) {
+		uint32_t end = imp->group_end[group];
+		switch (group) {
+		case UFBXI_COMPILED_CURVE_MIXED: ufbxi_evaluate_compiled_curves(imp, begin, end, time, UFBXI_COMPILED_CURVE_MIXED); break;
+		case UFBXI_COMPILED_CURVE_CUBIC: ufbxi_evaluate_compiled_curves(imp, begin, end, time, UFBXI_COMPILED_CURVE_CUBIC); break;
+		case UFBXI_COMPILED_CURVE_LINEAR: ufbxi_evaluate_compiled_curves(imp, begin, end, time, UFBXI_COMPILED_CURVE_LINEAR); break;
+		case UFBXI_COMPILED_CURVE_CONSTANT_PREV: ufbxi_evaluate_compiled_curves(imp, begin, end, time, UFBXI_COMPILED_CURVE_CONSTANT_PREV); break;
+		case UFBXI_COMPILED_CURVE_CONSTANT_NEXT: ufbxi_evaluate_compiled_curves(imp, begin, end, time, UFBXI_COMPILED_CURVE_CONSTANT_NEXT); break;
+		default: ufbxi_unreachable("Bad curve group"); break;
+		}
+		begin = end;
+	}
+
+	size_t num_nodes = ufbxi_min_sz(compiled->nodes.count, num_transforms);
+	for (size_t i = 0; i < num_nodes; i++) {
+		const ufbxi_compiled_node *cn = &imp->nodes[i];
+		const ufbx_node *node = compiled->nodes.data[i];
+		if (cn->fallback) {
+			transforms[i] = ufbxi_evaluate_transform(compiled->anim, node, time, imp->transform_flags, &imp->fallback_curve_keys);
+		} else if (cn->animated) {
+			transforms[i] = ufbxi_get_transform_from_values(&imp->values[i], cn->rotation_order, node, NULL);
+		} else {
+			transforms[i] = cn->transform;
+		}
+	}
+
+	return num_nodes;
+}
+
 ufbx_abi ufbx_baked_anim *ufbx_bake_anim(const ufbx_scene *scene, const ufbx_anim *anim, const ufbx_bake_opts *opts, ufbx_error *error)
 {
 	ufbx_assert(scene);
@@ -31257,15 +37652,10 @@ ufbx_abi ufbx_baked_anim *ufbx_bake_anim(const ufbx_scene *scene, const ufbx_ani
 
 	int ok = ufbxi_bake_anim_imp(&bc, anim);
 
-	ufbxi_buf_free(&bc.tmp);
-	ufbxi_buf_free(&bc.tmp_prop);
-	ufbxi_buf_free(&bc.tmp_times);
-	ufbxi_buf_free(&bc.tmp_bake_props);
-	ufbxi_buf_free(&bc.tmp_nodes);
-	ufbxi_buf_free(&bc.tmp_elements);
-	ufbxi_buf_free(&bc.tmp_props);
-	ufbxi_buf_free(&bc.tmp_bake_stack);
-	ufbxi_free(&bc.ator_tmp, char, bc.tmp_arr, bc.tmp_arr_size);
+	// Wait for any tasks left running on failure before freeing their contexts
+	ufbxi_thread_pool_free(&bc.thread_pool);
+	ufbxi_bake_free_tasks(&bc);
+	ufbxi_bake_free_tmp_bufs(&bc);
 	ufbxi_free_ator(&bc.ator_tmp);
 
 	if (ok) {
@@ -32017,6 +38407,23 @@ ufbx_abi ufbxi_noinline ufbx_matrix ufbx_catch_get_skin_vertex_matrix(ufbx_panic
 	return mat;
 }
 
+ufbx_abi bool ufbx_skin_vertices(const ufbx_skin_deformer *skin,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_skin_vertices_opts *opts, ufbx_error *error)
+{
+	ufbx_error local_error; // ufbxi_uninit
+	if (!error) {
+		error = &local_error;
+	}
+	memset(error, 0, sizeof(ufbx_error));
+	ufbxi_check_opts_return(false, opts, error);
+
+	ufbx_assert(skin);
+	if (!skin) return false;
+
+	return ufbxi_skin_vertices(skin, positions_in, positions_out, normals_in, normals_out, count, opts, error);
+}
+
 ufbx_abi ufbxi_noinline uint32_t ufbx_get_blend_shape_offset_index(const ufbx_blend_shape *shape, size_t vertex)
 {
 	ufbx_assert(shape);
@@ -32399,81 +38806,31 @@ ufbx_abi ufbxi_noinline uint32_t ufbx_catch_triangulate_face(ufbx_panic *panic,
 	if (ufbxi_panicf(panic, face.index_begin < mesh->num_indices, "Face index begin (%u) out of bounds (%zu)", face.index_begin, mesh->num_indices)) return 0;
 	if (ufbxi_panicf(panic, mesh->num_indices - face.index_begin >= face.num_indices, "Face index end (%u + %u) out of bounds (%zu)", face.index_begin, face.num_indices, mesh->num_indices)) return 0;
 
-	if (face.num_indices == 3) {
-		// Fast case: Already a triangle
-		indices[0] = face.index_begin + 0;
-		indices[1] = face.index_begin + 1;
-		indices[2] = face.index_begin + 2;
-		return 1;
-	} else if (face.num_indices == 4) {
-		// Quad: Split along the shortest axis unless a vertex crosses the axis
-		uint32_t i0 = face.index_begin + 0;
-		uint32_t i1 = face.index_begin + 1;
-		uint32_t i2 = face.index_begin + 2;
-		uint32_t i3 = face.index_begin + 3;
-		ufbx_vec3 v0 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i0]];
-		ufbx_vec3 v1 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i1]];
-		ufbx_vec3 v2 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i2]];
-		ufbx_vec3 v3 = mesh->vertex_position.values.data[mesh->vertex_position.indices.data[i3]];
-
-		ufbx_vec3 a = ufbxi_sub3(v2, v0);
-		ufbx_vec3 b = ufbxi_sub3(v3, v1);
-
-		ufbx_vec3 na1 = ufbxi_normalize3(ufbxi_cross3(a, ufbxi_sub3(v1, v0)));
-		ufbx_vec3 na3 = ufbxi_normalize3(ufbxi_cross3(a, ufbxi_sub3(v0, v3)));
-		ufbx_vec3 nb0 = ufbxi_normalize3(ufbxi_cross3(b, ufbxi_sub3(v1, v0)));
-		ufbx_vec3 nb2 = ufbxi_normalize3(ufbxi_cross3(b, ufbxi_sub3(v2, v1)));
-
-		ufbx_real dot_aa = ufbxi_dot3(a, a);
-		ufbx_real dot_bb = ufbxi_dot3(b, b);
-		ufbx_real dot_na = ufbxi_dot3(na1, na3);
-		ufbx_real dot_nb = ufbxi_dot3(nb0, nb2);
-
-		bool split_a = dot_aa <= dot_bb;
-
-		if (dot_na < 0.0f || dot_nb < 0.0f) {
-			split_a = dot_na >= dot_nb;
-		}
-
-		if (split_a) {
-			indices[0] = i0;
-			indices[1] = i1;
-			indices[2] = i2;
-			indices[3] = i2;
-			indices[4] = i3;
-			indices[5] = i0;
-		} else {
-			indices[0] = i1;
-			indices[1] = i2;
-			indices[2] = i3;
-			indices[3] = i3;
-			indices[4] = i0;
-			indices[5] = i1;
-		}
-
-		return 2;
-	} else {
-		ufbxi_ngon_context nc = { 0 };
-		nc.positions = mesh->vertex_position;
-		nc.face = face;
-
-		uint32_t num_indices_u32 = num_indices < UINT32_MAX ? (uint32_t)num_indices : UINT32_MAX;
-
-		uint32_t local_indices[12]; // ufbxi_uninit
-		if (num_indices_u32 < 12) {
-			uint32_t num_tris = ufbxi_triangulate_ngon(&nc, local_indices, 12);
-			memcpy(indices, local_indices, num_tris * 3 * sizeof(uint32_t));
-			return num_tris;
-		} else {
-			return ufbxi_triangulate_ngon(&nc, indices, num_indices_u32);
-		}
-	}
+	return ufbxi_triangulate_face(mesh, face, indices, num_indices);
 #else
 	ufbxi_panicf_imp(panic, "Triangulation disabled");
 	return 0;
 #endif
 }
 
+ufbx_abi size_t ufbx_triangulate_mesh(const ufbx_mesh *mesh, uint32_t *indices, size_t num_indices, const ufbx_triangulate_opts *opts, ufbx_error *error)
+{
+	ufbx_error local_error; // ufbxi_uninit
+	if (!error) {
+		error = &local_error;
+	}
+	memset(error, 0, sizeof(ufbx_error));
+	ufbxi_check_opts_return(0, opts, error);
+	ufbx_assert(mesh);
+
+	ufbx_triangulate_opts local_opts; // ufbxi_uninit
+	if (!opts) {
+		memset(&local_opts, 0, sizeof(local_opts));
+		opts = &local_opts;
+	}
+	return ufbxi_triangulate_mesh(mesh, indices, num_indices, opts, error);
+}
+
 ufbx_abi void ufbx_catch_compute_topology(ufbx_panic *panic, const ufbx_mesh *mesh, ufbx_topo_edge *indices, size_t num_indices)
 {
 	if (ufbxi_panicf(panic, num_indices >= mesh->num_indices, "Required mesh.num_indices (%zu) indices, got %zu", mesh->num_indices, num_indices)) return;
@@ -32646,6 +39003,69 @@ ufbx_abi void ufbx_retain_mesh(ufbx_mesh *mesh)
 	ufbxi_retain_ref(&imp->refcount);
 }
 
+ufbx_abi ufbx_subdivision_stencils *ufbx_create_subdivision_stencils(const ufbx_mesh *mesh, size_t level, const ufbx_subdivision_stencils_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_ptr(ufbx_subdivision_stencils, opts, error);
+	ufbx_assert(mesh);
+
+	ufbxi_subdivision_stencils_context sc = { UFBX_ERROR_NONE };
+	if (opts) {
+		sc.opts = *opts;
+	}
+
+	sc.mesh = mesh;
+	sc.level = level;
+
+	int ok = ufbxi_create_subdivision_stencils_imp(&sc);
+
+	ufbx_free_mesh(sc.sub_mesh);
+
+	if (ok) {
+		ufbxi_clear_error(error);
+		ufbxi_subdivision_stencils_imp *imp = sc.imp;
+		return &imp->stencils;
+	} else {
+		ufbxi_fix_error_type(&sc.error, "Failed to create subdivision stencils", error);
+		ufbxi_buf_free(&sc.result);
+		ufbxi_free_ator(&sc.ator_result);
+		return NULL;
+	}
+}
+
+ufbx_abi void ufbx_free_subdivision_stencils(ufbx_subdivision_stencils *stencils)
+{
+	if (!stencils) return;
+
+	ufbxi_subdivision_stencils_imp *imp = ufbxi_get_imp(ufbxi_subdivision_stencils_imp, stencils);
+	ufbx_assert(imp->magic == UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC);
+	if (imp->magic != UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC) return;
+	ufbxi_release_ref(&imp->refcount);
+}
+
+ufbx_abi void ufbx_retain_subdivision_stencils(ufbx_subdivision_stencils *stencils)
+{
+	if (!stencils) return;
+
+	ufbxi_subdivision_stencils_imp *imp = ufbxi_get_imp(ufbxi_subdivision_stencils_imp, stencils);
+	ufbx_assert(imp->magic == UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC);
+	if (imp->magic != UFBXI_SUBDIVISION_STENCILS_IMP_MAGIC) return;
+	ufbxi_retain_ref(&imp->refcount);
+}
+
+ufbx_abi void ufbx_apply_subdivision_stencils(const ufbx_subdivision_stencils *stencils, const ufbx_vec3 *src, ufbx_vec3 *dst)
+{
+	ufbx_assert(stencils);
+	ufbxi_apply_subdivision_stencils_imp(stencils, src, dst, 0, stencils->num_vertices);
+}
+
+ufbx_abi void ufbx_apply_subdivision_stencils_range(const ufbx_subdivision_stencils *stencils, const ufbx_vec3 *src, ufbx_vec3 *dst, size_t begin, size_t count)
+{
+	ufbx_assert(stencils);
+	ufbx_assert(begin <= stencils->num_vertices && count <= stencils->num_vertices - begin);
+	if (begin > stencils->num_vertices || count > stencils->num_vertices - begin) return;
+	ufbxi_apply_subdivision_stencils_imp(stencils, src, dst, begin, begin + count);
+}
+
 ufbx_abi ufbx_geometry_cache *ufbx_load_geometry_cache(
 	const char *filename,
 	const ufbx_geometry_cache_opts *opts, ufbx_error *error)
@@ -32693,6 +39113,22 @@ typedef struct {
 	ufbx_real dst[UFBXI_GEOMETRY_CACHE_BUFFER_SIZE];
 } ufbxi_geometry_cache_buffer;
 
+#if UFBXI_FEATURE_GEOMETRY_CACHE
+static ufbxi_forceinline size_t ufbxi_cache_read_frame_bytes(ufbx_stream *stream, const char **p_retained, size_t *p_retained_left, void *dst, size_t size)
+{
+	if (*p_retained) {
+		size_t to_copy = ufbxi_min_sz(size, *p_retained_left);
+		memcpy(dst, *p_retained, to_copy);
+		*p_retained += to_copy;
+		*p_retained_left -= to_copy;
+		return to_copy;
+	} else {
+		size_t num_read = stream->read_fn(stream->user, dst, size);
+		return num_read != SIZE_MAX ? num_read : 0;
+	}
+}
+#endif
+
 ufbx_abi ufbxi_noinline size_t ufbx_read_geometry_cache_real(const ufbx_cache_frame *frame, ufbx_real *data, size_t count, const ufbx_geometry_cache_data_opts *user_opts)
 {
 #if UFBXI_FEATURE_GEOMETRY_CACHE
@@ -32745,110 +39181,69 @@ ufbx_abi ufbxi_noinline size_t ufbx_read_geometry_cache_real(const ufbx_cache_fr
 	if (src_count == 0) return 0;
 	src_count = ufbxi_min_sz(src_count, count);
 
-	ufbx_stream stream = { 0 };
-	if (!ufbxi_open_file(&opts.open_file_cb, &stream, frame->filename.data, frame->filename.length, NULL, NULL, UFBX_OPEN_FILE_GEOMETRY_CACHE)) {
-		return 0;
-	}
+	// Frames retained in memory are read directly without opening the file
+	const char *retained = (const char*)frame->data.data;
+	size_t retained_left = frame->data.size;
 
-	// Skip to the correct point in the file
-	uint64_t offset = frame->data_offset;
-	if (stream.skip_fn) {
-		while (offset > 0) {
-			size_t to_skip = (size_t)ufbxi_min64(offset, UFBXI_MAX_SKIP_SIZE);
-			if (!stream.skip_fn(stream.user, to_skip)) break;
-			offset -= to_skip;
+	ufbx_stream stream = { 0 };
+	if (!retained) {
+		if (!ufbxi_open_file(&opts.open_file_cb, &stream, frame->filename.data, frame->filename.length, NULL, NULL, UFBX_OPEN_FILE_GEOMETRY_CACHE)) {
+			return 0;
 		}
-	} else {
-		char buffer[4096]; // ufbxi_uninit
-		while (offset > 0) {
-			size_t to_skip = (size_t)ufbxi_min64(offset, sizeof(buffer));
-			size_t num_read = stream.read_fn(stream.user, buffer, to_skip);
-			if (num_read != to_skip) break;
-			offset -= to_skip;
+
+		// Skip to the correct point in the file
+		if (!ufbxi_cache_skip_stream(&stream, frame->data_offset)) {
+			if (stream.close_fn) {
+				stream.close_fn(stream.user);
+			}
+			return 0;
 		}
 	}
 
-	// Failed to skip all the way
-	if (offset > 0) {
-		if (stream.close_fn) {
-			stream.close_fn(stream.user);
+	// Scale and mirror are folded into per-component factors so each chunk
+	// is transformed and weighted in a single pass.
+	ufbx_real scale[3] = { 1.0f, 1.0f, 1.0f };
+	if (!opts.ignore_transform) {
+		scale[0] = scale[1] = scale[2] = frame->scale_factor;
+		if (frame->mirror_axis) {
+			scale[frame->mirror_axis - 1] = -frame->scale_factor;
 		}
-		return 0;
 	}
+	ufbx_real weight = opts.use_weight ? opts.weight : 1.0f;
+	bool swap_endian = src_big_endian != dst_big_endian;
 
 	ufbx_real *dst = data;
-	size_t mirror_ix = (size_t)frame->mirror_axis - 1;
+	size_t phase = 0;
 	ufbxi_geometry_cache_buffer buffer; // ufbxi_uninit
 	while (src_count > 0) {
 		size_t to_read = ufbxi_min_sz(src_count, UFBXI_GEOMETRY_CACHE_BUFFER_SIZE);
 		src_count -= to_read;
 		size_t num_read = 0;
+		const ufbx_real *src = NULL;
 		if (use_double) {
-			size_t bytes_read = stream.read_fn(stream.user, buffer.src.f64, to_read * sizeof(double));
-			if (bytes_read == SIZE_MAX) bytes_read = 0;
+			size_t bytes_read = ufbxi_cache_read_frame_bytes(&stream, &retained, &retained_left, buffer.src.f64, to_read * sizeof(double));
 			num_read = bytes_read / sizeof(double);
-			if (src_big_endian != dst_big_endian) {
-				for (size_t i = 0; i < num_read; i++) {
-					char t, *v = (char*)&buffer.src.f64[i];
-					t = v[0]; v[0] = v[7]; v[7] = t;
-					t = v[1]; v[1] = v[6]; v[6] = t;
-					t = v[2]; v[2] = v[5]; v[5] = t;
-					t = v[3]; v[3] = v[4]; v[4] = t;
-				}
-			}
-			ufbxi_nounroll for (size_t i = 0; i < num_read; i++) {
-				buffer.dst[i] = (ufbx_real)buffer.src.f64[i];
+			if (swap_endian) {
+				ufbxi_bswap_64(buffer.src.f64, buffer.src.f64, num_read);
 			}
+			src = ufbxi_convert_f64_to_real(buffer.dst, buffer.src.f64, num_read);
 		} else {
-			size_t bytes_read = stream.read_fn(stream.user, buffer.src.f32, to_read * sizeof(float));
-			if (bytes_read == SIZE_MAX) bytes_read = 0;
+			size_t bytes_read = ufbxi_cache_read_frame_bytes(&stream, &retained, &retained_left, buffer.src.f32, to_read * sizeof(float));
 			num_read = bytes_read / sizeof(float);
-			if (src_big_endian != dst_big_endian) {
-				for (size_t i = 0; i < num_read; i++) {
-					char t, *v = (char*)&buffer.src.f32[i];
-					t = v[0]; v[0] = v[3]; v[3] = t;
-					t = v[1]; v[1] = v[2]; v[2] = t;
-				}
-			}
-			ufbxi_nounroll for (size_t i = 0; i < num_read; i++) {
-				buffer.dst[i] = (ufbx_real)buffer.src.f32[i];
+			if (swap_endian) {
+				ufbxi_bswap_32(buffer.src.f32, buffer.src.f32, num_read);
 			}
+			src = ufbxi_convert_f32_to_real(buffer.dst, buffer.src.f32, num_read);
 		}
 
-		if (!opts.ignore_transform) {
-			ufbx_real scale = frame->scale_factor;
-			if (scale != 1.0f) {
-				for (size_t i = 0; i < num_read; i++) {
-					buffer.dst[i] *= scale;
-				}
-			}
-			if (frame->mirror_axis) {
-				while (mirror_ix < num_read) {
-					buffer.dst[mirror_ix] = -buffer.dst[mirror_ix];
-					mirror_ix += 3;
-				}
-				mirror_ix -= num_read;
-			}
-		}
-
-		if (dst) {
-			ufbx_real weight = opts.use_weight ? opts.weight : 1.0f;
-			if (opts.additive) {
-				ufbxi_nounroll for (size_t i = 0; i < num_read; i++) {
-					dst[i] += buffer.dst[i] * weight;
-				}
-			} else {
-				ufbxi_nounroll for (size_t i = 0; i < num_read; i++) {
-					dst[i] = buffer.dst[i] * weight;
-				}
-			}
-			dst += num_read;
-		}
+		ufbxi_scale_weight_vec3_real(dst, src, num_read, scale, phase, weight, opts.additive);
+		phase = (phase + num_read) % 3;
+		dst += num_read;
 
 		if (num_read != to_read) break;
 	}
 
-	if (stream.close_fn) {
+	if (!retained && stream.close_fn) {
 		stream.close_fn(stream.user);
 	}
 
@@ -32954,6 +39349,75 @@ ufbx_abi ufbxi_noinline size_t ufbx_sample_geometry_cache_vec3(const ufbx_cache_
 #endif
 }
 
+ufbx_abi ufbx_cache_player *ufbx_create_cache_player(const ufbx_cache_channel *channel, const ufbx_cache_player_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_ptr(ufbx_cache_player, opts, error);
+	ufbx_assert(channel);
+	if (!channel) return NULL;
+
+	ufbx_cache_player_opts local_opts; // ufbxi_uninit
+	if (!opts) {
+		memset(&local_opts, 0, sizeof(local_opts));
+		opts = &local_opts;
+	}
+	return ufbxi_create_cache_player(channel, opts, error);
+}
+
+ufbx_abi void ufbx_free_cache_player(ufbx_cache_player *player)
+{
+#if UFBXI_FEATURE_GEOMETRY_CACHE
+	if (!player) return;
+
+	ufbxi_cache_player_imp *imp = (ufbxi_cache_player_imp*)player;
+	ufbx_assert(imp->magic == UFBXI_CACHE_PLAYER_IMP_MAGIC);
+	if (imp->magic != UFBXI_CACHE_PLAYER_IMP_MAGIC) return;
+	imp->magic = 0;
+	ufbxi_free_cache_player_imp(imp);
+#else
+	(void)player;
+#endif
+}
+
+ufbx_abi ufbxi_noinline size_t ufbx_sample_cache_player_real(ufbx_cache_player *player, double time, ufbx_real *data, size_t count, const ufbx_geometry_cache_data_opts *user_opts)
+{
+#if UFBXI_FEATURE_GEOMETRY_CACHE
+	ufbxi_check_opts_return_no_error(0, user_opts);
+	if (!player || count == 0) return 0;
+	ufbx_assert(data);
+	if (!data) return 0;
+	if (player->channel->frames.count == 0) return 0;
+
+	ufbxi_cache_player_imp *imp = (ufbxi_cache_player_imp*)player;
+	ufbx_assert(imp->magic == UFBXI_CACHE_PLAYER_IMP_MAGIC);
+	if (imp->magic != UFBXI_CACHE_PLAYER_IMP_MAGIC) return 0;
+
+	ufbx_geometry_cache_data_opts opts; // ufbxi_uninit
+	if (user_opts) {
+		opts = *user_opts;
+	} else {
+		memset(&opts, 0, sizeof(opts));
+	}
+
+	size_t num_read = 0;
+	if (!ufbxi_cache_player_sample_imp(imp, time, data, count, &opts, &num_read)) return 0;
+	return num_read;
+#else
+	return 0;
+#endif
+}
+
+ufbx_abi ufbxi_noinline size_t ufbx_sample_cache_player_vec3(ufbx_cache_player *player, double time, ufbx_vec3 *data, size_t count, const ufbx_geometry_cache_data_opts *opts)
+{
+#if UFBXI_FEATURE_GEOMETRY_CACHE
+	if (!player || count == 0) return 0;
+	ufbx_assert(data);
+	if (!data) return 0;
+	return ufbx_sample_cache_player_real(player, time, (ufbx_real*)data, count * 3, opts) / 3;
+#else
+	return 0;
+#endif
+}
+
 ufbx_abi ufbx_dom_node *ufbx_dom_find_len(const ufbx_dom_node *parent, const char *name, size_t name_len)
 {
 	ufbx_string ref = ufbxi_safe_string(name, name_len);
@@ -32973,6 +39437,68 @@ ufbx_abi size_t ufbx_generate_indices(const ufbx_vertex_stream *streams, size_t
 	return ufbxi_generate_indices(streams, num_streams, indices, num_indices, allocator, error);
 }
 
+ufbx_abi size_t ufbx_generate_indices_threaded(const ufbx_vertex_stream *streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_generate_indices_opts *opts, ufbx_error *error)
+{
+	ufbx_error local_error; // ufbxi_uninit
+	if (!error) {
+		error = &local_error;
+	}
+	memset(error, 0, sizeof(ufbx_error));
+	ufbxi_check_opts_return(0, opts, error);
+
+	ufbx_generate_indices_opts local_opts; // ufbxi_uninit
+	if (!opts) {
+		memset(&local_opts, 0, sizeof(local_opts));
+		opts = &local_opts;
+	}
+	return ufbxi_generate_indices_threaded(streams, num_streams, indices, num_indices, opts, error);
+}
+
+ufbx_abi bool ufbx_build_vertex_buffer(const ufbx_mesh *mesh, const ufbx_mesh_part *part, const ufbx_vertex_layout *layout, ufbx_vertex_buffer *dst, const ufbx_vertex_buffer_opts *opts, ufbx_error *error)
+{
+	ufbxi_check_opts_return(false, opts, error);
+	ufbx_assert(mesh && layout && dst);
+	dst->num_vertices = 0;
+	dst->num_indices = 0;
+
+#if UFBXI_FEATURE_TRIANGULATION
+	ufbxi_vertex_buffer_context vc = { UFBX_ERROR_NONE };
+	if (opts) {
+		vc.opts = *opts;
+	}
+	vc.mesh = mesh;
+	vc.part = part;
+	vc.dst = dst;
+
+	ufbxi_init_ator(&vc.error, &vc.ator_tmp, &vc.opts.temp_allocator, "temp");
+	vc.tmp.ator = &vc.ator_tmp;
+
+	int ok = ufbxi_build_vertex_buffer_imp(&vc, layout);
+
+	ufbxi_buf_free(&vc.tmp);
+	ufbxi_free_ator(&vc.ator_tmp);
+
+	if (ok) {
+		if (error) {
+			ufbxi_clear_error(error);
+		}
+		return true;
+	} else {
+		ufbxi_fix_error_type(&vc.error, "Failed to build vertex buffer", error);
+		dst->num_vertices = 0;
+		dst->num_indices = 0;
+		return false;
+	}
+#else
+	if (error) {
+		memset(error, 0, sizeof(ufbx_error));
+		ufbxi_fmt_err_info(error, "UFBX_ENABLE_TRIANGULATION");
+		ufbxi_report_err_msg(error, "UFBXI_FEATURE_TRIANGULATION", "Feature disabled");
+	}
+	return false;
+#endif
+}
+
 ufbx_abi void ufbx_thread_pool_run_task(ufbx_thread_pool_context ctx, uint32_t index)
 {
 	ufbxi_thread_pool_execute((ufbxi_thread_pool*)ctx, index);
@@ -33154,6 +39680,7 @@ ufbx_abi ufbx_material *ufbx_find_material(const ufbx_scene *scene, const char *
 ufbx_abi ufbx_anim_prop *ufbx_find_anim_prop(const ufbx_anim_layer *layer, const ufbx_element *element, const char *prop) { return ufbx_find_anim_prop_len(layer, element, prop, strlen(prop)); }
 ufbx_abi ufbx_prop ufbx_evaluate_prop(const ufbx_anim *anim, const ufbx_element *element, const char *name, double time) { return ufbx_evaluate_prop_len(anim, element, name, strlen(name), time); }
 ufbx_abi ufbx_prop ufbx_evaluate_prop_flags(const ufbx_anim *anim, const ufbx_element *element, const char *name, double time, uint32_t flags) { return ufbx_evaluate_prop_flags_len(anim, element, name, strlen(name), time, flags); }
+ufbx_abi ufbx_prop ufbx_evaluate_prop_cursor(ufbx_anim_cursor *cursor, const ufbx_element *element, const char *name, double time, uint32_t flags) { return ufbx_evaluate_prop_cursor_len(cursor, element, name, strlen(name), time, flags); }
 ufbx_abi ufbx_texture *ufbx_find_prop_texture(const ufbx_material *material, const char *name) { return ufbx_find_prop_texture_len(material, name, strlen(name)); }
 ufbx_abi ufbx_string ufbx_find_shader_prop(const ufbx_shader *shader, const char *name) { return ufbx_find_shader_prop_len(shader, name, strlen(name)); }
 ufbx_abi ufbx_shader_prop_binding_list ufbx_find_shader_prop_bindings(const ufbx_shader *shader, const char *name) { return ufbx_find_shader_prop_bindings_len(shader, name, strlen(name)); }
@@ -1178,6 +1178,26 @@ typedef struct ufbx_subdivision_result {
 
 } ufbx_subdivision_result;
 
+// Subdivision weights from source mesh vertices to subdivided vertices stored as
+// a sparse matrix in compressed sparse row format. Create with `ufbx_create_subdivision_stencils()`
+// and compute subdivided positions from deformed vertices with `ufbx_apply_subdivision_stencils()`.
+typedef struct ufbx_subdivision_stencils {
+	size_t num_source_vertices; // < Number of vertices in the source mesh, `ufbx_mesh.num_vertices`
+	size_t num_vertices;        // < Number of subdivided vertices
+
+	// Stencil of subdivided vertex `i` is stored in `indices/weights[offsets[i] .. offsets[i + 1]]`.
+	ufbx_uint32_list offsets;
+	ufbx_uint32_list indices; // < Source vertex indices
+	ufbx_real_list weights;   // < Source vertex weights
+
+	// Vertex indices of the subdivided mesh, matches `ufbx_mesh.vertex_indices`
+	// of the mesh returned by `ufbx_subdivide_mesh()`.
+	ufbx_uint32_list vertex_indices;
+} ufbx_subdivision_stencils;
+
+// Retained topology of a mesh, see `ufbx_load_opts.retain_topology`.
+typedef struct ufbx_mesh_topology ufbx_mesh_topology;
+
 typedef enum ufbx_subdivision_display_mode UFBX_ENUM_REPR {
 	UFBX_SUBDIVISION_DISPLAY_DISABLED,
 	UFBX_SUBDIVISION_DISPLAY_HULL,
@@ -1375,6 +1395,9 @@ struct ufbx_mesh {
 
 	// Tessellation (result)
 	bool from_tessellated_nurbs;
+
+	// Precomputed topology, only if loaded with `ufbx_load_opts.retain_topology`.
+	ufbx_nullable ufbx_mesh_topology *topology;
 };
 
 // The kind of light source
@@ -2195,6 +2218,11 @@ typedef struct ufbx_cache_frame {
 	uint32_t data_count;                    // < Number of data elements
 	uint32_t data_element_bytes;            // < Size of a single data element in bytes
 	uint64_t data_total_bytes;              // < Size of the whole data blob in bytes
+
+	// Raw data of the frame in `data_encoding`, only present if the cache was loaded
+	// with `ufbx_geometry_cache_opts.retain_file_data`.
+	// Frames with retained data are read without opening `filename` again.
+	ufbx_blob data;
 } ufbx_cache_frame;
 
 UFBX_LIST_TYPE(ufbx_cache_frame_list, ufbx_cache_frame);
@@ -2232,6 +2260,22 @@ typedef struct ufbx_geometry_cache {
 	ufbx_string_list extra_info;
 } ufbx_geometry_cache;
 
+// Prefetching playback state for a single cache channel.
+// Created with `ufbx_create_cache_player()`, keeps a window of decoded frames
+// ahead of the playhead so sampling only needs to blend in memory.
+typedef struct ufbx_cache_player {
+	const ufbx_cache_channel *channel;
+
+	// Number of frames read ahead of the current playback position.
+	size_t window_size;
+
+	// Playback advances towards earlier frames.
+	bool reverse;
+
+	// Maximum number of `ufbx_real` values in a single frame of `channel`.
+	size_t max_values;
+} ufbx_cache_player;
+
 struct ufbx_cache_deformer {
 	union { ufbx_element element; struct {
 		ufbx_string name;
@@ -3235,6 +3279,41 @@ struct ufbx_anim_curve {
 	double max_time;
 };
 
+// Cursor for evaluating a single curve at (mostly) monotonically changing times.
+// Remembers the last keyframe segment so that playback evaluates in amortized
+// constant time, seeking falls back to binary search.
+// Initialize with `ufbx_curve_cursor cursor = { curve };`.
+typedef struct ufbx_curve_cursor {
+	const ufbx_anim_curve *curve;
+	uint32_t key_index; // < Internal, index of the last evaluated keyframe segment.
+} ufbx_curve_cursor;
+
+// Cursor for evaluating `anim` at (mostly) monotonically changing times.
+// Remembers the last keyframe segment of each curve in the scene.
+// Create with `ufbx_create_anim_cursor()`, a cursor must not be used from multiple threads at once.
+typedef struct ufbx_anim_cursor {
+	const ufbx_anim *anim;
+
+	// Last evaluated keyframe segment per `ufbx_anim_curve.typed_id`.
+	ufbx_uint32_list curve_keys;
+} ufbx_anim_cursor;
+
+// Node transform animation resolved into a flat table of curves.
+// Create with `ufbx_compile_anim()` and evaluate with `ufbx_evaluate_compiled_anim()`.
+typedef struct ufbx_compiled_anim {
+	const ufbx_anim *anim;
+
+	// Nodes in the order of the transforms written by `ufbx_evaluate_compiled_anim()`.
+	ufbx_node_list nodes;
+
+	// Number of animation curves evaluated directly.
+	size_t num_curves;
+
+	// Number of nodes that need the full `ufbx_evaluate_transform()` path,
+	// eg. due to blended layers, property overrides, connections or scale helpers.
+	size_t num_fallback_nodes;
+} ufbx_compiled_anim;
+
 // -- Collections
 
 // Collection of nodes to hide/freeze
@@ -3750,6 +3829,99 @@ typedef struct ufbx_thumbnail {
 	ufbx_blob data;
 } ufbx_thumbnail;
 
+// Phases of loading a scene, see `ufbx_load_stats.phase_time[]`.
+typedef enum ufbx_load_phase UFBX_ENUM_REPR {
+
+	// Opening the file and setting up the load.
+	UFBX_LOAD_PHASE_OPEN,
+
+	// Parsing the file structure (binary or ASCII FBX, .obj, .mtl).
+	// For .obj and .mtl files this includes creating all the elements.
+	UFBX_LOAD_PHASE_PARSE,
+
+	// Decompressing DEFLATE arrays on the loading thread.
+	// NOTE: Arrays decompressed in thread pool tasks are counted in `ufbx_load_stats.task_time`.
+	UFBX_LOAD_PHASE_INFLATE,
+
+	// Reading FBX objects into elements (meshes, nodes, curves, etc).
+	UFBX_LOAD_PHASE_READ_ELEMENTS,
+
+	// Resolving connections and building the final element lists.
+	UFBX_LOAD_PHASE_FINALIZE,
+
+	// Axis/unit conversion, geometry modification, and other post-processing.
+	UFBX_LOAD_PHASE_POSTPROCESS,
+
+	// Loading external files, see `ufbx_load_opts.load_external_files`.
+	UFBX_LOAD_PHASE_EXTERNAL_FILES,
+
+	// Evaluating skinning, see `ufbx_load_opts.evaluate_skinning`.
+	UFBX_LOAD_PHASE_SKINNING,
+
+	UFBX_ENUM_FORCE_WIDTH(UFBX_LOAD_PHASE)
+} ufbx_load_phase;
+
+UFBX_ENUM_TYPE(ufbx_load_phase, UFBX_LOAD_PHASE, UFBX_LOAD_PHASE_SKINNING);
+
+// Profiling information about loading the scene.
+// Only collected if loaded with `ufbx_load_opts.collect_stats`.
+// NOTE: Times are in seconds and only measured if `ufbx_load_opts.stats_clock_cb` is specified.
+typedef struct ufbx_load_stats {
+
+	// Statistics were collected for this scene.
+	bool enabled;
+
+	// Total time spent in `ufbx_load_*()`.
+	double total_time;
+
+	// Time spent in each phase of loading on the loading thread.
+	double phase_time[UFBX_LOAD_PHASE_COUNT];
+
+	// Number of thread pool tasks used during loading.
+	size_t num_tasks;
+
+	// Time spent executing thread pool tasks, summed over all threads.
+	double task_time;
+
+	// Time the loading thread spent waiting for thread pool tasks to finish.
+	double task_wait_time;
+
+	// Estimated speedup from using the thread pool: the time loading would
+	// have taken on a single thread divided by `total_time`.
+	double parallel_speedup;
+
+	// Binary FBX DEFLATE compressed arrays.
+	size_t num_deflate_arrays; // < Number of compressed arrays
+	size_t num_deflate_tasks;  // < Number of arrays decompressed in thread pool tasks
+	uint64_t deflate_bytes_in;  // < Compressed size of the arrays
+	uint64_t deflate_bytes_out; // < Decompressed size of the arrays
+
+	// Number of ASCII FBX arrays parsed in thread pool tasks.
+	size_t num_ascii_array_tasks;
+
+	// Number of sections of ASCII FBX `Objects` lexed in thread pool tasks.
+	size_t num_ascii_section_tasks;
+
+	// Number of chunks of .obj files parsed in thread pool tasks.
+	size_t num_obj_chunk_tasks;
+
+	// Size of the main file if it was memory mapped via `ufbx_load_opts.use_memory_map`.
+	uint64_t memory_mapped_bytes;
+
+	// Arrays referenced from user memory via `ufbx_load_opts.no_copy_arrays`.
+	size_t num_no_copy_arrays;
+	uint64_t no_copy_array_bytes;
+
+	// Peak memory usage of the temporary and result allocators.
+	size_t temp_memory_peak;
+	size_t result_memory_peak;
+
+	// String interning, `num_string_hits` strings were already in the pool.
+	size_t num_string_lookups;
+	size_t num_string_hits;
+
+} ufbx_load_stats;
+
 // Miscellaneous data related to the loaded file
 typedef struct ufbx_metadata {
 
@@ -3849,6 +4021,9 @@ typedef struct ufbx_metadata {
 	// See `UFBX_SPACE_CONVERSION_MODIFY_GEOMETRY`.
 	ufbx_real geometry_scale;
 
+	// Profiling information, see `ufbx_load_opts.collect_stats`.
+	ufbx_load_stats load_stats;
+
 } ufbx_metadata;
 
 typedef enum ufbx_time_mode UFBX_ENUM_REPR {
@@ -4064,6 +4239,18 @@ typedef struct ufbx_topo_edge {
 	ufbx_topo_flags flags;
 } ufbx_topo_edge;
 
+UFBX_LIST_TYPE(ufbx_topo_edge_list, ufbx_topo_edge);
+
+struct ufbx_mesh_topology {
+	// Result of `ufbx_compute_topology()`.
+	ufbx_topo_edge_list edges;
+
+	// Result of `ufbx_generate_normal_mapping()` with `assume_smooth = false`,
+	// `num_normals` is the return value.
+	ufbx_uint32_list normal_indices;
+	size_t num_normals;
+};
+
 // Vertex data array for `ufbx_generate_indices()`.
 // NOTE: `ufbx_generate_indices()` compares the vertices using `memcmp()`, so
 // any padding should be cleared to zero.
@@ -4073,6 +4260,67 @@ typedef struct ufbx_vertex_stream {
 	size_t vertex_size;  // < Size of a vertex in bytes.
 } ufbx_vertex_stream;
 
+// Source of a vertex element in `ufbx_build_vertex_buffer()`.
+typedef enum ufbx_vertex_attribute UFBX_ENUM_REPR {
+	UFBX_VERTEX_ATTRIBUTE_POSITION,     // < `ufbx_mesh.vertex_position`, 3 components.
+	UFBX_VERTEX_ATTRIBUTE_NORMAL,       // < `ufbx_mesh.vertex_normal`, 3 components.
+	UFBX_VERTEX_ATTRIBUTE_TANGENT,      // < `ufbx_uv_set.vertex_tangent`, 3 components.
+	UFBX_VERTEX_ATTRIBUTE_BITANGENT,    // < `ufbx_uv_set.vertex_bitangent`, 3 components.
+	UFBX_VERTEX_ATTRIBUTE_UV,           // < `ufbx_uv_set.vertex_uv`, 2 components.
+	UFBX_VERTEX_ATTRIBUTE_COLOR,        // < `ufbx_color_set.vertex_color`, 4 components.
+	UFBX_VERTEX_ATTRIBUTE_SKIN_INDICES, // < Cluster indices of the strongest skin weights, 4 components.
+	UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS, // < Strongest skin weights, 4 components.
+
+	UFBX_ENUM_FORCE_WIDTH(UFBX_VERTEX_ATTRIBUTE)
+} ufbx_vertex_attribute;
+
+UFBX_ENUM_TYPE(ufbx_vertex_attribute, UFBX_VERTEX_ATTRIBUTE, UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS);
+
+// Format of a single component of a vertex element.
+typedef enum ufbx_vertex_format UFBX_ENUM_REPR {
+	UFBX_VERTEX_FORMAT_F32,     // < 32-bit float.
+	UFBX_VERTEX_FORMAT_F16,     // < 16-bit half float.
+	UFBX_VERTEX_FORMAT_SNORM16, // < `int16_t` mapping [-1, 1] to [-32767, 32767].
+	UFBX_VERTEX_FORMAT_UNORM16, // < `uint16_t` mapping [0, 1] to [0, 65535].
+	UFBX_VERTEX_FORMAT_UNORM8,  // < `uint8_t` mapping [0, 1] to [0, 255].
+	UFBX_VERTEX_FORMAT_U16,     // < `uint16_t` integer, for skin indices.
+	UFBX_VERTEX_FORMAT_U8,      // < `uint8_t` integer, for skin indices.
+
+	UFBX_ENUM_FORCE_WIDTH(UFBX_VERTEX_FORMAT)
+} ufbx_vertex_format;
+
+UFBX_ENUM_TYPE(ufbx_vertex_format, UFBX_VERTEX_FORMAT, UFBX_VERTEX_FORMAT_U8);
+
+// Single element of an interleaved vertex, see `ufbx_vertex_layout`.
+typedef struct ufbx_vertex_element {
+	ufbx_vertex_attribute attribute;
+	ufbx_vertex_format format;
+	uint32_t num_components; // < Number of components to write (1-4), zero for the attribute default.
+	uint32_t set_index;      // < UV or color set index for `TANGENT/BITANGENT/UV/COLOR`.
+	uint32_t offset;         // < Byte offset of the element within a vertex.
+} ufbx_vertex_element;
+
+// Interleaved vertex layout for `ufbx_build_vertex_buffer()`.
+// Bytes of the vertex not covered by any element are cleared to zero.
+typedef struct ufbx_vertex_layout {
+	const ufbx_vertex_element *elements;
+	size_t num_elements;
+	size_t stride; // < Size of a vertex in bytes.
+} ufbx_vertex_layout;
+
+// Destination buffers for `ufbx_build_vertex_buffer()`.
+// In the worst case both buffers need space for `3 * num_triangles` entries
+// of the mesh or mesh part.
+typedef struct ufbx_vertex_buffer {
+	void *vertices;         // < Vertex data of `vertex_capacity * layout.stride` bytes.
+	size_t vertex_capacity; // < Maximum number of vertices that fit in `vertices`.
+	uint32_t *indices;      // < Triangle list index data.
+	size_t index_capacity;  // < Maximum number of indices that fit in `indices`.
+
+	size_t num_vertices;    // < Number of vertices written.
+	size_t num_indices;     // < Number of indices written.
+} ufbx_vertex_buffer;
+
 // -- Memory callbacks
 
 // You can optionally provide an allocator to ufbx, the default is to use the
@@ -4401,6 +4649,19 @@ typedef struct ufbx_progress_cb {
 		(progress))
 } ufbx_progress_cb;
 
+// Returns the current time in seconds, only differences between calls are used.
+// NOTE: May be called from multiple threads concurrently when using a thread pool.
+typedef double ufbx_clock_fn(void *user);
+
+typedef struct ufbx_clock_cb {
+	ufbx_clock_fn *fn;
+	void *user;
+
+	UFBX_CALLBACK_IMPL(ufbx_clock_cb, ufbx_clock_fn, double,
+		(void *user),
+		())
+} ufbx_clock_cb;
+
 // -- Inflate
 
 typedef struct ufbx_inflate_input ufbx_inflate_input;
@@ -4619,6 +4880,9 @@ typedef struct ufbx_thread_pool_info {
 } ufbx_thread_pool_info;
 
 // Initialize the thread pool.
+// Called once per thread pool context, eg. for each `ufbx_load_file()` or `ufbx_create_cache_player()`.
+// Task indices start from zero in each context and multiple contexts may be alive at the same time,
+// so keep per-context state via `ufbx_thread_pool_set_user_ptr()` instead of in `user`.
 // Return `true` on success.
 typedef bool ufbx_thread_pool_init_fn(void *user, ufbx_thread_pool_context ctx, const ufbx_thread_pool_info *info);
 
@@ -4718,6 +4982,10 @@ typedef struct ufbx_load_opts {
 	// Don't fail loading if external files are not found.
 	bool ignore_missing_external_files;
 
+	// Keep the frame data of external geometry caches in memory.
+	// See `ufbx_geometry_cache_opts.retain_file_data`.
+	bool retain_geometry_cache_data;
+
 	// Don't compute `ufbx_skin_deformer` `vertices` and `weights` arrays saving
 	// a bit of memory and time if not needed
 	bool skip_skin_vertices;
@@ -4775,6 +5043,21 @@ typedef struct ufbx_load_opts {
 	// Ignore `open_file_cb` when loading the main file.
 	bool open_main_file_with_default;
 
+	// Map the main file into memory in `ufbx_load_file()` instead of reading it
+	// through stdio, letting it be parsed like `ufbx_load_memory()` data.
+	// Only used with the default `open_file_cb`, silently falls back to stdio if
+	// the file cannot be mapped or the platform does not support `mmap()`.
+	bool use_memory_map;
+
+	// Reference uncompressed binary FBX vertex attribute index arrays directly from
+	// the memory passed to `ufbx_load_memory()` instead of copying them.
+	// The memory must stay alive and unmodified as long as the scene is used!
+	// Arrays are only referenced if their alignment and endianness match, and they
+	// are copied if ufbx needs to modify them, eg. to fix invalid indices.
+	// NOTE: Vertex attribute values are always copied as they are padded with zeroes
+	// to make `UFBX_NO_INDEX` safe to use.
+	bool no_copy_arrays;
+
 	// Path separator character, defaults to '\' on Windows and '/' otherwise.
 	char path_separator;
 
@@ -4803,6 +5086,12 @@ typedef struct ufbx_load_opts {
 	ufbx_progress_cb progress_cb;
 	uint64_t progress_interval_hint; // < Bytes between progress report calls
 
+	// Collect profiling information to `ufbx_metadata.load_stats`.
+	// Timings require specifying `stats_clock_cb`.
+	// NOTE: Not supported if compiled with `UFBX_NO_LOAD_STATS`.
+	bool collect_stats;
+	ufbx_clock_cb stats_clock_cb;
+
 	// External file callbacks (defaults to stdio.h)
 	ufbx_open_file_cb open_file_cb;
 
@@ -4885,6 +5174,10 @@ typedef struct ufbx_load_opts {
 	// Retain the raw document structure using `ufbx_dom_node`.
 	bool retain_dom;
 
+	// Compute and retain mesh topology and normal mapping in `ufbx_mesh.topology`.
+	// Used by skinning evaluation and subdivision instead of recomputing them.
+	bool retain_topology;
+
 	// Force a specific file format instead of detecting it.
 	ufbx_file_format file_format;
 
@@ -4958,9 +5251,30 @@ typedef struct ufbx_evaluate_opts {
 	// External file callbacks (defaults to stdio.h)
 	ufbx_open_file_cb open_file_cb;
 
+	// Threading options, meshes are skinned in parallel if a thread pool is provided.
+	ufbx_thread_opts thread_opts;
+
 	uint32_t _end_zero;
 } ufbx_evaluate_opts;
 
+// Options for `ufbx_skin_vertices()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_skin_vertices_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator; // < Allocator used for the packed cluster data
+
+	// Index of the first vertex in `ufbx_skin_deformer.vertices[]` to deform.
+	size_t vertex_offset;
+
+	// Matrix used for vertices that have no valid skin weights, defaults to identity.
+	// See the `fallback` parameter of `ufbx_get_skin_vertex_matrix()`.
+	bool use_fallback_matrix;
+	ufbx_matrix fallback_matrix;
+
+	uint32_t _end_zero;
+} ufbx_skin_vertices_opts;
+
 UFBX_LIST_TYPE(ufbx_const_uint32_list, const uint32_t);
 UFBX_LIST_TYPE(ufbx_const_real_list, const ufbx_real);
 
@@ -5008,6 +5322,34 @@ typedef struct ufbx_anim_opts {
 	uint32_t _end_zero;
 } ufbx_anim_opts;
 
+// Options for `ufbx_create_anim_cursor()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_anim_cursor_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts result_allocator; // < Allocator used to create the `ufbx_anim_cursor`
+
+	uint32_t _end_zero;
+} ufbx_anim_cursor_opts;
+
+// Options for `ufbx_compile_anim()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_compile_anim_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator;   // < Allocator used during compilation
+	ufbx_allocator_opts result_allocator; // < Allocator used to create the `ufbx_compiled_anim`
+
+	// Nodes to evaluate, corresponding to `ufbx_scene.nodes[]`, aka `ufbx_node.typed_id`.
+	// Empty list uses all the nodes in the scene.
+	ufbx_const_uint32_list node_ids;
+
+	// Flags passed to `ufbx_evaluate_transform_flags()`, see `ufbx_transform_flags`.
+	uint32_t transform_flags;
+
+	uint32_t _end_zero;
+} ufbx_compile_anim_opts;
+
 // Specifies how to handle stepped tangents.
 typedef enum ufbx_bake_step_handling UFBX_ENUM_REPR {
 
@@ -5113,6 +5455,12 @@ typedef struct ufbx_bake_opts {
 	// Default: `4`
 	size_t key_reduction_passes;
 
+	// Threading options, nodes and elements are baked in parallel if a thread pool is provided.
+	// Scale helper nodes are always baked first as other nodes depend on them.
+	// NOTE: Tasks allocate memory from `temp_allocator` concurrently so it must be thread-safe.
+	// The `memory_limit` and `allocation_limit` of `temp_allocator` are split between the tasks.
+	ufbx_thread_opts thread_opts;
+
 	uint32_t _end_zero;
 } ufbx_bake_opts;
 
@@ -5190,9 +5538,31 @@ typedef struct ufbx_subdivide_opts {
 	// Index of the skin deformer to use for `evaluate_skin_weights`.
 	size_t skin_deformer_index;
 
+	// Threading options, faces, edges and vertices of large meshes are subdivided
+	// in parallel if a thread pool is provided. The result is identical to the serial one.
+	// NOTE: Tasks allocate memory from `temp_allocator` concurrently so it must be thread-safe.
+	// The `memory_limit` and `allocation_limit` of `temp_allocator` are split between the tasks.
+	ufbx_thread_opts thread_opts;
+
 	uint32_t _end_zero;
 } ufbx_subdivide_opts;
 
+// Options for `ufbx_create_subdivision_stencils()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_subdivision_stencils_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator;   // < Allocator used during subdivision
+	ufbx_allocator_opts result_allocator; // < Allocator used for the stencils
+
+	ufbx_subdivision_boundary boundary;
+
+	// Limit source vertices per subdivided vertex.
+	size_t max_source_vertices;
+
+	uint32_t _end_zero;
+} ufbx_subdivision_stencils_opts;
+
 // Options for `ufbx_load_geometry_cache()`
 // NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
 typedef struct ufbx_geometry_cache_opts {
@@ -5216,6 +5586,12 @@ typedef struct ufbx_geometry_cache_opts {
 	// Factor to scale the geometry by.
 	ufbx_real scale_factor;
 
+	// Keep the data of all frames available while loading the cache.
+	// Reading frames then uses `ufbx_cache_frame.data` instead of re-opening the cache files.
+	// With the default `open_file_cb` the files are memory mapped where supported,
+	// otherwise the data of the frames is read into memory.
+	bool retain_file_data;
+
 	uint32_t _end_zero;
 } ufbx_geometry_cache_opts;
 
@@ -5237,6 +5613,74 @@ typedef struct ufbx_geometry_cache_data_opts {
 	uint32_t _end_zero;
 } ufbx_geometry_cache_data_opts;
 
+// Options for `ufbx_create_cache_player()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_cache_player_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts result_allocator; // < Allocator used for the player and decoded frames
+
+	// Threading options, frames are prefetched as `ufbx_thread_pool` tasks.
+	// If not set frames are read synchronously when needed.
+	ufbx_thread_opts thread_opts;
+
+	// External file callbacks (defaults to stdio.h)
+	ufbx_open_file_cb open_file_cb;
+
+	// Ignore scene transform.
+	bool ignore_transform;
+
+	// Number of frames to prefetch ahead of the playhead (default 4).
+	size_t window_size;
+
+	// Prefetch frames before the playhead instead of after it.
+	bool reverse;
+
+	uint32_t _end_zero;
+} ufbx_cache_player_opts;
+
+// Options for `ufbx_generate_indices_threaded()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_generate_indices_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator; // < Allocator used during index generation
+
+	// Threading options, falls back to `ufbx_generate_indices()` if not set.
+	ufbx_thread_opts thread_opts;
+
+	uint32_t _end_zero;
+} ufbx_generate_indices_opts;
+
+// Options for `ufbx_triangulate_mesh()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_triangulate_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator; // < Allocator used for threading
+
+	// Threading options, ranges of faces are triangulated in parallel if a thread pool is provided.
+	ufbx_thread_opts thread_opts;
+
+	uint32_t _end_zero;
+} ufbx_triangulate_opts;
+
+// Options for `ufbx_build_vertex_buffer()`
+// NOTE: Initialize to zero with `{ 0 }` (C) or `{ }` (C++)
+typedef struct ufbx_vertex_buffer_opts {
+	uint32_t _begin_zero;
+
+	ufbx_allocator_opts temp_allocator; // < Allocator used during building
+
+	// Do not merge identical vertices, every index refers to a unique vertex.
+	bool no_deduplication;
+
+	// Do not normalize `UFBX_VERTEX_ATTRIBUTE_SKIN_WEIGHTS` to sum to one.
+	bool no_normalize_skin_weights;
+
+	uint32_t _end_zero;
+} ufbx_vertex_buffer_opts;
+
 typedef struct ufbx_panic {
 	bool did_panic;
 	size_t message_length;
@@ -5428,6 +5872,10 @@ ufbx_unsafe ufbx_abi bool ufbx_open_memory_ctx(ufbx_stream *stream, ufbx_open_fi
 ufbx_abi ufbx_real ufbx_evaluate_curve(const ufbx_anim_curve *curve, double time, ufbx_real default_value);
 ufbx_abi ufbx_real ufbx_evaluate_curve_flags(const ufbx_anim_curve *curve, double time, ufbx_real default_value, uint32_t flags);
 
+// Evaluate `cursor->curve` at `time` starting the keyframe search from the previous evaluation.
+// Returns the same values as `ufbx_evaluate_curve_flags()`.
+ufbx_abi ufbx_real ufbx_evaluate_curve_cursor(ufbx_curve_cursor *cursor, double time, ufbx_real default_value, uint32_t flags);
+
 // Evaluate a value from bundled animation curves.
 ufbx_abi ufbx_real ufbx_evaluate_anim_value_real(const ufbx_anim_value *anim_value, double time);
 ufbx_abi ufbx_vec3 ufbx_evaluate_anim_value_vec3(const ufbx_anim_value *anim_value, double time);
@@ -5486,6 +5934,34 @@ ufbx_abi ufbx_transform ufbx_evaluate_transform_flags(const ufbx_anim *anim, con
 ufbx_abi ufbx_real ufbx_evaluate_blend_weight(const ufbx_anim *anim, const ufbx_blend_channel *channel, double time);
 ufbx_abi ufbx_real ufbx_evaluate_blend_weight_flags(const ufbx_anim *anim, const ufbx_blend_channel *channel, double time, uint32_t flags);
 
+// Create a cursor for evaluating `anim` repeatedly, `NULL` uses the default `scene->anim`.
+// The cursor retains `scene` (and `anim` if created with `ufbx_create_anim()`).
+ufbx_abi ufbx_anim_cursor *ufbx_create_anim_cursor(const ufbx_scene *scene, const ufbx_anim *anim, const ufbx_anim_cursor_opts *opts, ufbx_error *error);
+
+// Free a cursor returned by `ufbx_create_anim_cursor()`.
+ufbx_abi void ufbx_free_anim_cursor(ufbx_anim_cursor *cursor);
+ufbx_abi void ufbx_retain_anim_cursor(ufbx_anim_cursor *cursor);
+
+// Evaluation functions using `cursor->anim`, results match the non-cursor versions.
+ufbx_abi ufbx_prop ufbx_evaluate_prop_cursor_len(ufbx_anim_cursor *cursor, const ufbx_element *element, const char *name, size_t name_len, double time, uint32_t flags);
+ufbx_abi ufbx_prop ufbx_evaluate_prop_cursor(ufbx_anim_cursor *cursor, const ufbx_element *element, const char *name, double time, uint32_t flags);
+ufbx_abi ufbx_props ufbx_evaluate_props_cursor(ufbx_anim_cursor *cursor, const ufbx_element *element, double time, ufbx_prop *buffer, size_t buffer_size, uint32_t flags);
+ufbx_abi ufbx_transform ufbx_evaluate_transform_cursor(ufbx_anim_cursor *cursor, const ufbx_node *node, double time, uint32_t flags);
+
+// Compile the transform animation of nodes in `anim` for repeated evaluation, `NULL` uses the default `scene->anim`.
+// All property lookups are resolved up front, evaluation only needs to evaluate the animation curves.
+ufbx_abi ufbx_compiled_anim *ufbx_compile_anim(const ufbx_scene *scene, const ufbx_anim *anim, const ufbx_compile_anim_opts *opts, ufbx_error *error);
+
+// Free an animation returned by `ufbx_compile_anim()`.
+ufbx_abi void ufbx_free_compiled_anim(ufbx_compiled_anim *compiled);
+ufbx_abi void ufbx_retain_compiled_anim(ufbx_compiled_anim *compiled);
+
+// Evaluate the local transforms of `compiled->nodes` at `time` into `transforms[]`.
+// Results match `ufbx_evaluate_transform_flags()`, returns the number of transforms written.
+// NOTE: Not thread safe, `compiled` contains cursors for playback, use a separate
+// `ufbx_compiled_anim` per thread.
+ufbx_abi size_t ufbx_evaluate_compiled_anim(ufbx_compiled_anim *compiled, double time, ufbx_transform *transforms, size_t num_transforms);
+
 // Evaluate the whole `scene` at a specific `time` in the animation `anim`.
 // The returned scene behaves as if it had been exported at a specific time
 // in the specified animation, except that animated elements' properties contain
@@ -5495,6 +5971,18 @@ ufbx_abi ufbx_real ufbx_evaluate_blend_weight_flags(const ufbx_anim *anim, const
 // scene cannot be freed until all evaluated scenes are freed.
 ufbx_abi ufbx_scene *ufbx_evaluate_scene(const ufbx_scene *scene, const ufbx_anim *anim, double time, const ufbx_evaluate_opts *opts, ufbx_error *error);
 
+// Re-evaluate a scene returned by `ufbx_evaluate_scene()` in place at `time`.
+// `anim` must refer to the original scene, `NULL` uses the default `scene->anim`.
+// Animated properties, transforms and skinned vertices are overwritten without
+// reallocating. Elements without keyframes in `anim` are only evaluated again
+// when the layers, overrides or `ignore_connections` of `anim` or `opts->evaluate_flags` change.
+// `opts->evaluate_skinning` evaluates skinning into retained buffers, reusing
+// the topology and normal mapping of the previous evaluation.
+// NOTE: `opts->result_allocator` is ignored, the evaluated scene's allocator is used.
+// NOTE: Not thread safe, `scene` must not be accessed during the update.
+// Returns `false` on error, in which case the contents of `scene` are undefined.
+ufbx_abi bool ufbx_evaluate_scene_update(ufbx_scene *scene, const ufbx_anim *anim, double time, const ufbx_evaluate_opts *opts, ufbx_error *error);
+
 // Create a custom animation descriptor.
 // `ufbx_anim_opts` is used to specify animation layers and weights.
 // HINT: You can also leave `ufbx_anim_opts.layer_ids[]` empty and only specify
@@ -5602,6 +6090,15 @@ ufbx_inline ufbx_matrix ufbx_get_skin_vertex_matrix(const ufbx_skin_deformer *sk
 	return ufbx_catch_get_skin_vertex_matrix(NULL, skin, vertex, fallback);
 }
 
+// Deform `count` vertices using the skin deformer, starting from `ufbx_skin_deformer.vertices[opts->vertex_offset]`.
+// Equivalent to transforming each vertex by `ufbx_get_skin_vertex_matrix()` but faster
+// as the cluster transforms are packed once and blended using SIMD where available.
+// Normals are transformed using `ufbx_matrix_for_normals()` of the blended matrix and normalized.
+// Either `positions_in/out` or `normals_in/out` may be `NULL`, input and output arrays may be equal.
+ufbx_abi bool ufbx_skin_vertices(const ufbx_skin_deformer *skin,
+	const ufbx_vec3 *positions_in, ufbx_vec3 *positions_out, const ufbx_vec3 *normals_in, ufbx_vec3 *normals_out,
+	size_t count, const ufbx_skin_vertices_opts *opts, ufbx_error *error);
+
 // Resolve the index into `ufbx_blend_shape.position_offsets[]` given a vertex.
 // Returns `UFBX_NO_INDEX` if the vertex is not included in the blend shape.
 ufbx_abi uint32_t ufbx_get_blend_shape_offset_index(const ufbx_blend_shape *shape, size_t vertex);
@@ -5656,6 +6153,11 @@ ufbx_abi uint32_t ufbx_find_face_index(ufbx_mesh *mesh, size_t index);
 ufbx_abi uint32_t ufbx_catch_triangulate_face(ufbx_panic *panic, uint32_t *indices, size_t num_indices, const ufbx_mesh *mesh, ufbx_face face);
 ufbx_abi uint32_t ufbx_triangulate_face(uint32_t *indices, size_t num_indices, const ufbx_mesh *mesh, ufbx_face face);
 
+// Triangulate all faces of `mesh`, returning the number of triangles.
+// The triangles are identical to calling `ufbx_triangulate_face()` for each face in order.
+// NOTE: You need space for `mesh->num_triangles * 3` indices!
+ufbx_abi size_t ufbx_triangulate_mesh(const ufbx_mesh *mesh, uint32_t *indices, size_t num_indices, const ufbx_triangulate_opts *opts, ufbx_error *error);
+
 // Generate the half-edge representation of `mesh` to `topo[mesh->num_indices]`
 ufbx_abi void ufbx_catch_compute_topology(ufbx_panic *panic, const ufbx_mesh *mesh, ufbx_topo_edge *topo, size_t num_topo);
 ufbx_abi void ufbx_compute_topology(const ufbx_mesh *mesh, ufbx_topo_edge *topo, size_t num_topo);
@@ -5703,6 +6205,24 @@ ufbx_abi void ufbx_free_mesh(ufbx_mesh *mesh);
 // Increase the mesh reference count.
 ufbx_abi void ufbx_retain_mesh(ufbx_mesh *mesh);
 
+// Precompute the weights of subdividing `mesh` `level` times.
+// Use this to re-subdivide deformed vertices without recomputing the topology and weights.
+// NOTE: May be O(n^2) if `max_source_vertices` is not specified!
+ufbx_abi ufbx_subdivision_stencils *ufbx_create_subdivision_stencils(const ufbx_mesh *mesh, size_t level, const ufbx_subdivision_stencils_opts *opts, ufbx_error *error);
+
+// Free stencils returned by `ufbx_create_subdivision_stencils()`.
+ufbx_abi void ufbx_free_subdivision_stencils(ufbx_subdivision_stencils *stencils);
+
+// Increase the stencils reference count.
+ufbx_abi void ufbx_retain_subdivision_stencils(ufbx_subdivision_stencils *stencils);
+
+// Compute `stencils->num_vertices` subdivided positions to `dst` from
+// `stencils->num_source_vertices` source vertex positions in `src`.
+ufbx_abi void ufbx_apply_subdivision_stencils(const ufbx_subdivision_stencils *stencils, const ufbx_vec3 *src, ufbx_vec3 *dst);
+
+// Compute subdivided positions `dst[begin .. begin + count]`, eg. to split the work between threads.
+ufbx_abi void ufbx_apply_subdivision_stencils_range(const ufbx_subdivision_stencils *stencils, const ufbx_vec3 *src, ufbx_vec3 *dst, size_t begin, size_t count);
+
 // Geometry caches
 
 // Load geometry cache information from a file.
@@ -5727,6 +6247,16 @@ ufbx_abi size_t ufbx_read_geometry_cache_vec3(const ufbx_cache_frame *frame, ufb
 ufbx_abi size_t ufbx_sample_geometry_cache_real(const ufbx_cache_channel *channel, double time, ufbx_real *data, size_t num_data, const ufbx_geometry_cache_data_opts *opts);
 ufbx_abi size_t ufbx_sample_geometry_cache_vec3(const ufbx_cache_channel *channel, double time, ufbx_vec3 *data, size_t num_data, const ufbx_geometry_cache_data_opts *opts);
 
+// Create a player that prefetches upcoming frames of `channel` in the direction of playback.
+// NOTE: `channel` must outlive the player.
+ufbx_abi ufbx_cache_player *ufbx_create_cache_player(const ufbx_cache_channel *channel, const ufbx_cache_player_opts *opts, ufbx_error *error);
+// Free a player returned from `ufbx_create_cache_player()`.
+ufbx_abi void ufbx_free_cache_player(ufbx_cache_player *player);
+// Sample the channel of `player`, equivalent to `ufbx_sample_geometry_cache_TYPE()`.
+// Only `additive`, `use_weight` and `weight` are used from `opts`.
+ufbx_abi size_t ufbx_sample_cache_player_real(ufbx_cache_player *player, double time, ufbx_real *data, size_t num_data, const ufbx_geometry_cache_data_opts *opts);
+ufbx_abi size_t ufbx_sample_cache_player_vec3(ufbx_cache_player *player, double time, ufbx_vec3 *data, size_t num_data, const ufbx_geometry_cache_data_opts *opts);
+
 // DOM
 
 // Find a DOM node given a name.
@@ -5740,6 +6270,19 @@ ufbx_abi ufbx_dom_node *ufbx_dom_find(const ufbx_dom_node *parent, const char *n
 // This function compacts the data within `streams` in-place, writing the deduplicated indices to `indices`.
 ufbx_abi size_t ufbx_generate_indices(const ufbx_vertex_stream *streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_allocator_opts *allocator, ufbx_error *error);
 
+// Multithreaded version of `ufbx_generate_indices()` using `opts->thread_opts`.
+// The output is identical to `ufbx_generate_indices()`, vertices are numbered in
+// the order they first appear in `streams`.
+ufbx_abi size_t ufbx_generate_indices_threaded(const ufbx_vertex_stream *streams, size_t num_streams, uint32_t *indices, size_t num_indices, const ufbx_generate_indices_opts *opts, ufbx_error *error);
+
+// Build an interleaved triangle list vertex buffer for `mesh` or `part` (optional).
+// Faces are triangulated using `ufbx_triangulate_face()` and identical vertices
+// (after conversion to `layout`) are merged, vertices are written in order of
+// first use. Missing attributes are written as zero.
+// Skin attributes use the first skin deformer of the mesh.
+// Fails if the vertices or indices don't fit in `dst`.
+ufbx_abi bool ufbx_build_vertex_buffer(const ufbx_mesh *mesh, const ufbx_mesh_part *part, const ufbx_vertex_layout *layout, ufbx_vertex_buffer *dst, const ufbx_vertex_buffer_opts *opts, ufbx_error *error);
+
 // Thread pool
 
 // Run a single thread pool task.
@@ -5881,6 +6424,12 @@ template<> struct ufbx_type_traits<ufbx_mesh> {
 	static void free(ufbx_mesh *ptr) { ufbx_free_mesh(ptr); }
 };
 
+template<> struct ufbx_type_traits<ufbx_subdivision_stencils> {
+	enum { valid = 1 };
+	static void retain(ufbx_subdivision_stencils *ptr) { ufbx_retain_subdivision_stencils(ptr); }
+	static void free(ufbx_subdivision_stencils *ptr) { ufbx_free_subdivision_stencils(ptr); }
+};
+
 template<> struct ufbx_type_traits<ufbx_line_curve> {
 	enum { valid = 1 };
 	static void retain(ufbx_line_curve *ptr) { ufbx_retain_line_curve(ptr); }
@@ -5899,6 +6448,18 @@ template<> struct ufbx_type_traits<ufbx_anim> {
 	static void free(ufbx_anim *ptr) { ufbx_free_anim(ptr); }
 };
 
+template<> struct ufbx_type_traits<ufbx_anim_cursor> {
+	enum { valid = 1 };
+	static void retain(ufbx_anim_cursor *ptr) { ufbx_retain_anim_cursor(ptr); }
+	static void free(ufbx_anim_cursor *ptr) { ufbx_free_anim_cursor(ptr); }
+};
+
+template<> struct ufbx_type_traits<ufbx_compiled_anim> {
+	enum { valid = 1 };
+	static void retain(ufbx_compiled_anim *ptr) { ufbx_retain_compiled_anim(ptr); }
+	static void free(ufbx_compiled_anim *ptr) { ufbx_free_compiled_anim(ptr); }
+};
+
 template<> struct ufbx_type_traits<ufbx_baked_anim> {
 	enum { valid = 1 };
 	static void retain(ufbx_baked_anim *ptr) { ufbx_retain_baked_anim(ptr); }